@@ -1,6 +1,7 @@
 #include "CodeToolApp.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <fstream>
 #include <functional> 
@@ -8,6 +9,7 @@
 #include <locale>
 #include <sstream>
 #include <shlwapi.h>
+#include <thread>
 #include <windows.h>
 #include <iostream>
 
@@ -62,6 +64,7 @@ void CodeToolApplication::SetArguments(char** args, int nargs)
 	mXCodeProjectPath = argsMap["xcode_project"];
 	mNeedReset = argsMap.find("reset") != argsMap.end() || argsMap.find("r") != argsMap.end();
 	mVerbose = argsMap.find("verbose") != argsMap.end() || argsMap.find("v") != argsMap.end();
+	mThreadsCount = atoi(argsMap["threads"].c_str());
 
 	mCache.parentProjects = Split(argsMap["parent_projects"], ' ');
 }
@@ -505,29 +508,71 @@ void CodeToolApplication::UpdateProjectFilesFilter()
 
 void CodeToolApplication::UpdateCodeReflection()
 {
-	mParser = new CppSyntaxParser();
-
 	// get all files in sources path
 	mSourceFiles = GetFolderFiles(mSourcesPath);
 
-	// parse all headers
+	map<string, SyntaxFile*> cachedFiles;
+	for (auto cacheFile : mCache.originalFiles)
+		cachedFiles[cacheFile->GetPath()] = cacheFile;
+
+	// collect headers with changed edit date
+	vector<SourceParseTask> tasks;
 	for (auto fileInfo : mSourceFiles)
 	{
 		if (!EndsWith(fileInfo.first, ".h"))
 			continue;
 
-		ParseSource(fileInfo.first, fileInfo.second);
+		SourceParseTask task;
+		task.path = fileInfo.first;
+		task.editDate = fileInfo.second;
+
+		auto fnd = cachedFiles.find(fileInfo.first);
+		if (fnd != cachedFiles.end())
+		{
+			if (fnd->second->GetLastEditedDate() == fileInfo.second)
+				continue;
+
+			task.cachedFile = fnd->second;
+		}
+
+		tasks.push_back(task);
+	}
+
+	// parse all changed headers
+	ParseSources(tasks);
+
+	for (auto& task : tasks)
+	{
+		if (!task.parsedFile)
+		{
+			task.cachedFile->mLastEditedDate = task.editDate;
+			VerboseLog("Skipped %s, data wasn't changed\n", task.path.c_str());
+			continue;
+		}
+
+		if (task.cachedFile)
+		{
+			mCache.originalFiles.erase(find(mCache.originalFiles.begin(), mCache.originalFiles.end(), task.cachedFile));
+			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), task.cachedFile));
+			delete task.cachedFile;
+		}
+
+		mParsedFiles.push_back(task.parsedFile);
+		mCache.originalFiles.push_back(task.parsedFile);
+		mCache.files.push_back(task.parsedFile);
+
+		VerboseLog("Parsed %s\n", task.path.c_str());
 	}
 
 	// remove old sources from cache
 	for (auto parseFileInfo = mCache.originalFiles.begin(); parseFileInfo != mCache.originalFiles.end();)
 	{
-		auto fnd = find_if(mSourceFiles.begin(), mSourceFiles.end(), [&](auto x) { return x.first == (*parseFileInfo)->GetPath(); });
-		if (fnd == mSourceFiles.end())
+		if (mSourceFiles.find((*parseFileInfo)->GetPath()) == mSourceFiles.end())
 		{
-			delete *parseFileInfo;
+			SyntaxFile* removedFile = *parseFileInfo;
 			parseFileInfo = mCache.originalFiles.erase(parseFileInfo);
-			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), *parseFileInfo));
+			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), removedFile));
+			delete removedFile;
 		}
 		else ++parseFileInfo;
 	}
@@ -537,37 +582,39 @@ void CodeToolApplication::UpdateCodeReflection()
 	// update reflection
 	for (auto file : mParsedFiles)
 		UpdateSourceReflection(file);
-
-	delete mParser;
 }
 
-void CodeToolApplication::ParseSource(const string& path, const TimeStamp& editDate)
+void CodeToolApplication::ParseSources(vector<SourceParseTask>& tasks)
 {
-	// check edit date
-	for (auto cacheFile : mCache.originalFiles)
+	int threadsCount = mThreadsCount > 0 ? mThreadsCount : (int)thread::hardware_concurrency();
+	threadsCount = max(1, min(threadsCount, (int)tasks.size()));
+
+	atomic<int> nextTask(0);
+
+	auto parseTasks = [&]()
 	{
-		if (path == cacheFile->GetPath())
+		CppSyntaxParser parser;
+		for (int i = nextTask++; i < (int)tasks.size(); i = nextTask++)
 		{
-			if (editDate == cacheFile->GetLastEditedDate())
-				return;
+			SourceParseTask& task = tasks[i];
+			string data = ReadFile(task.path);
 
-			delete cacheFile;
-			mCache.originalFiles.erase(find(mCache.originalFiles.begin(), mCache.originalFiles.end(), cacheFile));
-			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), cacheFile));
+			if (task.cachedFile && task.cachedFile->GetContentHash() == GetDataHash(data))
+				continue;
 
-			break;
+			task.parsedFile = new SyntaxFile();
+			parser.ParseFile(*task.parsedFile, task.path, data, task.editDate);
 		}
-	}
+	};
 
-	// parse source
-	SyntaxFile* syntaxFile = new SyntaxFile();
-	mParser->ParseFile(*syntaxFile, path, editDate);
-	mParsedFiles.push_back(syntaxFile);
+	vector<thread> threads;
+	for (int i = 1; i < threadsCount; i++)
+		threads.emplace_back(parseTasks);
 
-	mCache.originalFiles.push_back(syntaxFile);
-	mCache.files.push_back(syntaxFile);
+	parseTasks();
 
-	VerboseLog("Parsed %s\n", path.c_str());
+	for (auto& parseThread : threads)
+		parseThread.join();
 }
 
 void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
@@ -669,6 +716,7 @@ void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
 	{
 		WriteFile(file->GetPath(), hSource);
 		file->mLastEditedDate = GetFileEditedDate(file->GetPath());
+		file->mContentHash = GetDataHash(hSource);
 	}
 
 	VerboseLog("Reflection generated for %s\n", file->GetPath().c_str());
@@ -86,6 +86,16 @@ public:
 	// Outs string to log if verbose move is enabled
 	static void VerboseLog(const char* format, ...);
 
+protected:
+	// Header parsing task. Performed on parsing thread
+	struct SourceParseTask
+	{
+		string      path;                 // Header path
+		TimeStamp   editDate;             // Header last edited date
+		SyntaxFile* cachedFile = nullptr; // Header syntax file from cache
+		SyntaxFile* parsedFile = nullptr; // Parsed header syntax file. Null when header's data wasn't changed
+	};
+
 protected:
 	string                 mCachePath = "CodeToolCache.xml";
 					       
@@ -93,9 +103,9 @@ protected:
 	string                 mMSVCProjectPath;
 	string                 mXCodeProjectPath;
 	bool                   mNeedReset = true;
+	int                    mThreadsCount = 0;
 	static bool            mVerbose;
 					       
-	CppSyntaxParser*       mParser;
 	vector<SyntaxFile*>    mParsedFiles;
 	CodeToolCache          mCache;
 	map<string, TimeStamp> mSourceFiles;
@@ -140,8 +150,8 @@ protected:
 	// Updates code reflection
 	void UpdateCodeReflection();
 
-	// Parses source file
-	void ParseSource(const string& path, const TimeStamp& editDate);
+	// Parses changed headers on parsing threads. Headers with same data as in cache aren't parsed
+	void ParseSources(vector<SourceParseTask>& tasks);
 
 	// Updates reflection for classes in source
 	void UpdateSourceReflection(SyntaxFile* file);
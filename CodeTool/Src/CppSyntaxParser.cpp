@@ -92,6 +92,18 @@ vector<string> Split(const string &s, char delim)
 	return elems;
 }
 
+unsigned long long GetDataHash(const string& data)
+{
+	unsigned long long hash = 14695981039346656037ull;
+	for (char c : data)
+	{
+		hash ^= (unsigned char)c;
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
 CppSyntaxParser::CppSyntaxParser()
 {
 	InitializeParsers();
@@ -140,18 +152,30 @@ void CppSyntaxParser::InitializeParsers()
 
 void CppSyntaxParser::ParseFile(SyntaxFile& file, const string& filePath, const TimeStamp& fileEditDate)
 {
-	file.mPath = filePath;
-	file.mLastEditedDate = fileEditDate;
-
 	ifstream fin;
 	fin.open(filePath.c_str());
 	if (!fin.is_open())
+	{
+		file.mPath = filePath;
+		file.mLastEditedDate = fileEditDate;
 		return;
+	}
 
-	file.mData = string((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+	string data = string((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
 
 	fin.close();
 
+	ParseFile(file, filePath, data, fileEditDate);
+}
+
+void CppSyntaxParser::ParseFile(SyntaxFile& file, const string& filePath, const string& fileData,
+								const TimeStamp& fileEditDate)
+{
+	file.mPath = filePath;
+	file.mLastEditedDate = fileEditDate;
+	file.mData = fileData;
+	file.mContentHash = GetDataHash(fileData);
+
 	if (file.mData.find("@CODETOOLIGNORE") != string::npos)
 		return;
 
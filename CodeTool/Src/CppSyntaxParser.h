@@ -9,6 +9,7 @@ string& TrimEnd(string &str, const string& chars = " ");
 string& TrimStart(string &str, const string& chars = " ");
 void Split(const string &s, char delim, vector<string> &elems);
 vector<string> Split(const string &s, char delim);
+unsigned long long GetDataHash(const string& data);
 
 class CppSyntaxParser
 {
@@ -18,6 +19,8 @@ public:
 
 	void ParseFile(SyntaxFile& file, const string& filePath, const TimeStamp& fileEditDate);
 
+	void ParseFile(SyntaxFile& file, const string& filePath, const string& fileData, const TimeStamp& fileEditDate);
+
 protected:
 	typedef void(CppSyntaxParser::*ParserDelegate)(SyntaxSection&, int&, SyntaxProtectionSection&);
 
@@ -26,6 +26,11 @@ const TimeStamp& SyntaxFile::GetLastEditedDate() const
 	return mLastEditedDate;
 }
 
+unsigned long long SyntaxFile::GetContentHash() const
+{
+	return mContentHash;
+}
+
 SyntaxNamespace* SyntaxFile::GetGlobalNamespace() const
 {
 	return mGlobalNamespace;
@@ -34,6 +39,7 @@ SyntaxNamespace* SyntaxFile::GetGlobalNamespace() const
 void SyntaxFile::SaveTo(pugi::xml_node& node) const
 {
 	node.append_attribute("path") = mPath.c_str();
+	node.append_attribute("hash") = mContentHash;
 	mLastEditedDate.SaveTo(node.append_child("date"));
 	mGlobalNamespace->SaveTo(node.append_child("globalNamespace"));
 }
@@ -41,6 +47,7 @@ void SyntaxFile::SaveTo(pugi::xml_node& node) const
 void SyntaxFile::LoadFrom(pugi::xml_node& node)
 {
 	mPath = node.attribute("path").as_string();
+	mContentHash = node.attribute("hash").as_ullong();
 	mLastEditedDate.LoadFrom(node.child("date"));
 
 	delete mGlobalNamespace;
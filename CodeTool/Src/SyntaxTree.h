@@ -74,6 +74,9 @@ public:
 	// Returns file last edit date
 	const TimeStamp& GetLastEditedDate() const;
 
+	// Returns hash of file's data
+	unsigned long long GetContentHash() const;
+
 	// Returns global syntax namespace in this file
 	SyntaxNamespace* GetGlobalNamespace() const;
 
@@ -84,10 +87,11 @@ public:
 	void LoadFrom(pugi::xml_node& node);
 
 protected:
-	string           mPath;                      // File path
-	string           mData;                      // File data
-	TimeStamp        mLastEditedDate;            // Last file edited date
-	SyntaxNamespace* mGlobalNamespace = nullptr; // Global syntax namespace in file
+	string             mPath;                      // File path
+	string             mData;                      // File data
+	TimeStamp          mLastEditedDate;            // Last file edited date
+	unsigned long long mContentHash = 0;           // Hash of file data. File isn't parsed again when date changed, but data is same
+	SyntaxNamespace*   mGlobalNamespace = nullptr; // Global syntax namespace in file
 
 	friend class CppSyntaxParser;
 	friend class CodeToolApplication;
@@ -10,6 +10,7 @@
 #include "o2/Scene/UI/Widgets/Label.h"
 #include "o2/Scene/UI/Widgets/MenuPanel.h"
 #include "o2/Scene/UI/Widgets/VerticalLayout.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Editor/EditorScope.h"
 #include "o2/Utils/Math/Curve.h"
 #include "o2Editor/AnimationWindow/AnimationWindow.h"
@@ -100,6 +101,10 @@ namespace Editor
 		});
 
 		mMenuPanel->AddItem("Debug/Dump memory", [&]() { o2Memory.DumpInfo(); });
+
+		mMenuPanel->AddItem("Debug/Profiler/Start capture", [&]() { o2Profiler.StartCapture(); });
+		mMenuPanel->AddItem("Debug/Profiler/Save capture", [&]() { o2Profiler.SaveChromeTrace("profile.json"); });
+		mMenuPanel->AddToggleItem("Debug/Profiler/Show overlay", false, [&](bool x) { o2Profiler.SetOverlayEnabled(x); });
 	}
 
 	MenuPanel::~MenuPanel()
@@ -0,0 +1,177 @@
+#include "o2/stdafx.h"
+
+#include <vector>
+#include "o2/Utils/Function.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+// ------------------------------------------------------------------------------------------------
+// Delegate as it was before slots storage: one functor is stored inside, when second functor added
+// all of them are cloned into heap and stored in std::vector. Used as baseline for benchmarks
+// ------------------------------------------------------------------------------------------------
+template <typename UnusedType>
+class LegacyFunction;
+
+template<typename _res_type, typename ... _args>
+class LegacyFunction<_res_type(_args ...)>
+{
+	static constexpr UInt oneFunctionCapacity = sizeof(std::vector<void*>) - sizeof(void*);
+
+public:
+	// Default constructor
+	LegacyFunction() {}
+
+	// Copy-constructor
+	LegacyFunction(const LegacyFunction& other)
+	{
+		if (other.mOneFunction)
+			Add(*other.mOneFunction);
+
+		for (auto func : other.mFunctions)
+			Add(*func);
+	}
+
+	// Destructor
+	~LegacyFunction()
+	{
+		Clear();
+	}
+
+	// Adds lambda
+	template<typename _lambda_type>
+	LegacyFunction& operator+=(const _lambda_type& lambda)
+	{
+		Add(SharedLambda<_lambda_type, _res_type, _args ...>(lambda));
+		return *this;
+	}
+
+	// Adds function. First function is stored inside, others are cloned into heap
+	void Add(const IFunction<_res_type(_args ...)>& func)
+	{
+		if (!mOneFunction && mFunctions.empty() && func.GetSizeOf() <= oneFunctionCapacity)
+		{
+			mOneFunction = func.Clone(mOneFunctionData);
+			return;
+		}
+
+		if (mOneFunction)
+		{
+			mFunctions.push_back(mOneFunction->Clone());
+			mOneFunction->~IFunction();
+			mOneFunction = nullptr;
+		}
+
+		mFunctions.push_back(func.Clone());
+	}
+
+	// Removes all functions
+	void Clear()
+	{
+		if (mOneFunction)
+		{
+			mOneFunction->~IFunction();
+			mOneFunction = nullptr;
+		}
+
+		for (auto func : mFunctions)
+			delete func;
+
+		mFunctions.clear();
+	}
+
+	// Invokes functions
+	void Invoke(_args ... args) const
+	{
+		if (mOneFunction)
+			mOneFunction->Invoke(args ...);
+
+		for (auto func : mFunctions)
+			func->Invoke(args ...);
+	}
+
+protected:
+	alignas(std::max_align_t) Byte mOneFunctionData[oneFunctionCapacity]; // Inside function memory
+
+	IFunction<_res_type(_args ...)>*              mOneFunction = nullptr; // Function inside, null when empty or functions are in heap
+	std::vector<IFunction<_res_type(_args ...)>*> mFunctions;             // Functions in heap
+};
+
+// ------------------------------------------------------------------
+// Test subscriber, lambdas and object functions are subscribed on it
+// ------------------------------------------------------------------
+struct Subscriber
+{
+	int counter = 0; // Invocations counter
+
+	// Increases counter
+	void OnEvent(int value) { counter += value; }
+};
+
+// Adds count of subscribers into delegate: lambdas and object functions alternately
+template<typename _delegate_type>
+void Subscribe(_delegate_type& delegate, Subscriber& subscriber, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (i%2 == 0)
+			delegate += [&subscriber, i](int value) { subscriber.counter += value + i; };
+		else
+			delegate.Add(ObjFunctionPtr<Subscriber, void, int>(&subscriber, &Subscriber::OnEvent));
+	}
+}
+
+// Runs benchmark and prints nanoseconds per iteration
+template<typename _func_type>
+void Measure(const char* name, int iterations, const _func_type& func)
+{
+	Timer timer;
+	for (int i = 0; i < iterations; i++)
+		func();
+
+	float time = timer.GetTime();
+	printf("%-40s %10.1f ns\n", name, time*1e9f/iterations);
+}
+
+// Runs construction, copy and invocation benchmarks for delegate type with count of subscribers
+template<typename _delegate_type>
+void RunBenchmarks(const char* delegateName, int subscribersCount)
+{
+	const int iterations = 200000;
+	char name[256];
+	Subscriber subscriber;
+
+	sprintf(name, "%s construction, %i subscribers", delegateName, subscribersCount);
+	Measure(name, iterations, [&]()
+	{
+		_delegate_type delegate;
+		Subscribe(delegate, subscriber, subscribersCount);
+	});
+
+	_delegate_type source;
+	Subscribe(source, subscriber, subscribersCount);
+
+	sprintf(name, "%s copy, %i subscribers", delegateName, subscribersCount);
+	Measure(name, iterations, [&]()
+	{
+		_delegate_type copy(source);
+	});
+
+	sprintf(name, "%s invocation, %i subscribers", delegateName, subscribersCount);
+	Measure(name, iterations*10, [&]() { source.Invoke(1); });
+
+	if (subscriber.counter == 0)
+		printf("Subscribers weren't invoked\n");
+}
+
+int main()
+{
+	for (int subscribersCount : { 1, 2, 4, 8, 16 })
+	{
+		RunBenchmarks<LegacyFunction<void(int)>>("Legacy", subscribersCount);
+		RunBenchmarks<Function<void(int)>>("Function", subscribersCount);
+		printf("\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,118 @@
+#include "o2/stdafx.h"
+
+#include "o2/Application/Application.h"
+#include "o2/Render/Font.h"
+#include "o2/Render/Text.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+using namespace o2;
+
+// ----------------------------------------------------------------------------------------
+// Font with generated monospace characters. Doesn't load anything, so layout isn't limited
+// by glyphs rasterization
+// ----------------------------------------------------------------------------------------
+class BenchmarkFont: public Font
+{
+public:
+	// Constructor, generates printable ASCII characters for height
+	BenchmarkFont(int height)
+	{
+		for (UInt16 id = 32; id < 127; id++)
+		{
+			Character ch;
+			ch.mId = id;
+			ch.mHeight = height;
+			ch.mSize = Vec2F(height*0.5f, (float)height);
+			ch.mOrigin = Vec2F(0, (float)height);
+			ch.mAdvance = height*0.6f;
+			ch.mTexSrc = RectF((id%16)/16.0f, (id/16)/8.0f, (id%16 + 1)/16.0f, (id/16 + 1)/8.0f);
+			AddCharacter(ch);
+		}
+
+		mReady = true;
+	}
+
+	// Returns base height in pixels for font with size
+	float GetHeightPx(int height) const override { return (float)height; }
+
+	// Returns line height in pixels for font with size
+	float GetLineHeightPx(int height) const override { return height*1.2f; }
+};
+
+// Runs benchmark and prints microseconds per iteration
+template<typename _func_type>
+void Measure(const char* name, int iterations, const _func_type& func)
+{
+	Timer timer;
+	for (int i = 0; i < iterations; i++)
+		func(i);
+
+	float time = timer.GetTime();
+	printf("%-50s %10.2f us\n", name, time*1e6f/iterations);
+}
+
+// Runs text update benchmark with and without glyph runs cache
+template<typename _func_type>
+void MeasureCached(const char* name, int iterations, Text& text, const _func_type& func)
+{
+	char caseName[256];
+
+	sprintf(caseName, "%s, no cache", name);
+	Measure(caseName, iterations, [&](int i) { text.GetSymbolsSet().ResetCache(); func(i); });
+
+	sprintf(caseName, "%s, cached", name);
+	Measure(caseName, iterations, func);
+}
+
+int main()
+{
+	Application application;
+	application.Initialize();
+
+	const int height = 12;
+	BenchmarkFont* font = mnew BenchmarkFont(height);
+
+	WString paragraph = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt "
+		"ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi "
+		"ut aliquip ex ea commodo consequat. ";
+
+	{
+		Text label(font);
+		label.SetHeight(height);
+		label.SetSize(Vec2F(200, 20));
+
+		MeasureCached("Single line label counter", 20000, label,
+					  [&](int i) { label.SetText((WString)"Score: " + (WString)(i%1000) + (WString)" points"); });
+	}
+
+	{
+		Text area(font);
+		area.SetHeight(height);
+		area.SetSize(Vec2F(400, 600));
+		area.SetWordWrap(true);
+
+		WString text = paragraph + paragraph + paragraph + "\n" + paragraph + paragraph + "\n" + paragraph;
+		WString editedText = text;
+		editedText.Insert((WString)"edited ", text.Length()/2);
+
+		MeasureCached("Word wrapped area, one word edited", 2000, area,
+					  [&](int i) { area.SetText(i%2 == 0 ? editedText : text); });
+
+		MeasureCached("Word wrapped area, last line edited", 2000, area,
+					  [&](int i) { area.SetText(text + (WString)(i%1000)); });
+	}
+
+	{
+		Text dots(font);
+		dots.SetHeight(height);
+		dots.SetSize(Vec2F(150, 20));
+		dots.SetDotsEngings(true);
+
+		MeasureCached("Dots ending label", 20000, dots,
+					  [&](int i) { dots.SetText((WString)"Item " + (WString)(i%1000) + (WString)" with long description"); });
+	}
+
+	delete font;
+
+	return 0;
+}
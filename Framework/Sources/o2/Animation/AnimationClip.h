@@ -1,4 +1,5 @@
 #pragma once
+#include "o2/Utils/Reflection/CompiledFieldPath.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
 namespace o2
@@ -111,6 +112,8 @@ namespace o2
 		float mDuration = 0.0f;   // Animation duration @SERIALIZABLE
 		Loop  mLoop = Loop::None; // Animation loop type @SERIALIZABLE
 
+		Map<const Type*, Vector<CompiledFieldPath>> mCompiledTracksPaths; // Tracks paths compiled by players targets types, same indices as tracks @IGNORE
+
 	protected:
 		// Returns Animation track by path
 		template<typename _type>
@@ -144,7 +147,7 @@ namespace o2
 		for (auto track : mTracks)
 		{
 			if (track->path == path)
-				return dynamic_cast<AnimationTrack<_type>*>(val.animatedValue);
+				return dynamic_cast<AnimationTrack<_type>*>(track);
 		}
 
 		return nullptr;
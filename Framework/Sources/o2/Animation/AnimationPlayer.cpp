@@ -81,8 +81,8 @@ namespace o2
 		const ObjectType* type = dynamic_cast<const ObjectType*>(&mTarget->GetType());
 		void* castedTarget = type->DynamicCastFromIObject(mTarget);
 
-		for (auto track : mClip->mTracks)
-			BindTrack(type, castedTarget, track, errors);
+		for (int i = 0; i < mClip->mTracks.Count(); i++)
+			BindTrack(type, castedTarget, mClip->mTracks[i], i, errors);
 
 		mLoop = mClip->mLoop;
 		mDuration = mClip->GetDuration();
@@ -90,10 +90,27 @@ namespace o2
 		mEndTime = mDuration;
 	}
 
-	void AnimationPlayer::BindTrack(const ObjectType* type, void* castedTarget, IAnimationTrack * track, bool errors)
+	void AnimationPlayer::BindTrack(const ObjectType* type, void* castedTarget, IAnimationTrack* track, int trackIdx, bool errors)
 	{
 		const FieldInfo* fieldInfo = nullptr;
-		auto targetPtr = type->GetFieldPtr(castedTarget, track->path, fieldInfo);
+		void* targetPtr = nullptr;
+
+		// Path is compiled once for clip track and target type, then other targets of same type are bound without names searching.
+		// Not compilable path isn't compiled again, it is resolved by names
+		auto& compiledPaths = mClip->mCompiledTracksPaths[type];
+		if (compiledPaths.Count() < mClip->mTracks.Count())
+			compiledPaths.Resize(mClip->mTracks.Count());
+
+		CompiledFieldPath& compiledPath = compiledPaths[trackIdx];
+		if (compiledPath.GetPath() != track->path || (!compiledPath.IsCompiled() && !compiledPath.IsNotCompilable()))
+			compiledPath.Compile(type, castedTarget, track->path);
+
+		if (compiledPath.IsCompiled())
+			targetPtr = compiledPath.GetFieldPtr(castedTarget, fieldInfo);
+
+		// Path can't be compiled or target's objects chain is different from compiled
+		if (!fieldInfo)
+			targetPtr = type->GetFieldPtr(castedTarget, track->path, fieldInfo);
 
 		if (!fieldInfo)
 		{
@@ -121,7 +138,8 @@ namespace o2
 		const ObjectType* type = dynamic_cast<const ObjectType*>(&mTarget->GetType());
 		void* castedTarget = type->DynamicCastFromIObject(mTarget);
 
-		BindTrack(type, castedTarget, track, false);
+		// Tracks are always added to the end of clip
+		BindTrack(type, castedTarget, track, mClip->mTracks.Count() - 1, false);
 	}
 
 	void AnimationPlayer::OnClipTrackRemove(IAnimationTrack* track)
@@ -55,8 +55,8 @@ namespace o2
 		// Creates clip tracks players and bind to properties from target
 		void BindTracks(bool errors);
 
-		// Binds animation track
-		void BindTrack(const ObjectType* type, void* castedTarget, IAnimationTrack* track, bool errors);
+		// Binds animation track with index in clip
+		void BindTrack(const ObjectType* type, void* castedTarget, IAnimationTrack* track, int trackIdx, bool errors);
 
 		// It is called when added new track in clip
 		void OnClipTrackAdded(IAnimationTrack* track);
@@ -98,7 +98,7 @@ CLASS_METHODS_META(o2::AnimationPlayer)
 	PUBLIC_FUNCTION(const Vector<IAnimationTrack::IPlayer*>&, GetTrackPlayers);
 	PROTECTED_FUNCTION(void, Evaluate);
 	PROTECTED_FUNCTION(void, BindTracks, bool);
-	PROTECTED_FUNCTION(void, BindTrack, const ObjectType*, void*, IAnimationTrack*, bool);
+	PROTECTED_FUNCTION(void, BindTrack, const ObjectType*, void*, IAnimationTrack*, int, bool);
 	PROTECTED_FUNCTION(void, OnClipTrackAdded, IAnimationTrack*);
 	PROTECTED_FUNCTION(void, OnClipTrackRemove, IAnimationTrack*);
 	PROTECTED_FUNCTION(void, OnClipDurationChanged, float);
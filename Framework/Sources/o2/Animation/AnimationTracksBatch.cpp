@@ -0,0 +1,161 @@
+#include "o2/stdafx.h"
+#include "AnimationTracksBatch.h"
+
+#include "o2/Scene/Components/AnimationComponent.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/Tasks/TaskManager.h"
+
+namespace o2
+{
+	int AnimationTracksBatch::mCollectingDepth = 0;
+	int AnimationTracksBatch::mParallelEvaluationThreshold = 256;
+
+	Vector<AnimationTrack<float>::Player*> AnimationTracksBatch::mFloatPlayers;
+	Vector<AnimationTrack<Vec2F>::Player*> AnimationTracksBatch::mVec2FPlayers;
+	Vector<AnimationComponent*>            AnimationTracksBatch::mComponents;
+
+	void AnimationTracksBatch::Begin()
+	{
+		mCollectingDepth++;
+	}
+
+	void AnimationTracksBatch::End()
+	{
+		if (mCollectingDepth == 0 || --mCollectingDepth > 0)
+			return;
+
+		PROFILE_SCOPE("AnimationTracksBatch::End");
+
+		// Curves evaluation changes only players' own values and keys caches, so it can be done in parallel
+		Evaluate(mFloatPlayers.Count(), [](int idx) {
+			if (auto player = mFloatPlayers[idx])
+				player->EvaluateValue();
+		});
+
+		Evaluate(mVec2FPlayers.Count(), [](int idx) {
+			if (auto player = mVec2FPlayers[idx])
+				player->EvaluateValue();
+		});
+
+		// Targets are assigned on main thread, because it invokes changing events. Players destroyed
+		// by this events are set to null in arrays
+		for (int i = 0; i < mFloatPlayers.Count(); i++)
+		{
+			if (auto player = mFloatPlayers[i])
+			{
+				player->mBatchIdx = -1;
+				player->AssignValue();
+			}
+		}
+
+		for (int i = 0; i < mVec2FPlayers.Count(); i++)
+		{
+			if (auto player = mVec2FPlayers[i])
+			{
+				player->mBatchIdx = -1;
+				player->AssignValue();
+			}
+		}
+
+		for (int i = 0; i < mComponents.Count(); i++)
+		{
+			if (auto component = mComponents[i])
+			{
+				component->mBatchIdx = -1;
+				component->UpdateMixers();
+			}
+		}
+
+		mFloatPlayers.Clear();
+		mVec2FPlayers.Clear();
+		mComponents.Clear();
+	}
+
+	bool AnimationTracksBatch::IsCollecting()
+	{
+		return mCollectingDepth > 0;
+	}
+
+	void AnimationTracksBatch::SetParallelEvaluationThreshold(int count)
+	{
+		mParallelEvaluationThreshold = count;
+	}
+
+	int AnimationTracksBatch::GetParallelEvaluationThreshold()
+	{
+		return mParallelEvaluationThreshold;
+	}
+
+	bool AnimationTracksBatch::Add(AnimationTrack<float>::Player* player)
+	{
+		if (mCollectingDepth == 0)
+			return false;
+
+		if (player->mBatchIdx < 0)
+		{
+			player->mBatchIdx = mFloatPlayers.Count();
+			mFloatPlayers.Add(player);
+		}
+
+		return true;
+	}
+
+	bool AnimationTracksBatch::Add(AnimationTrack<Vec2F>::Player* player)
+	{
+		if (mCollectingDepth == 0)
+			return false;
+
+		if (player->mBatchIdx < 0)
+		{
+			player->mBatchIdx = mVec2FPlayers.Count();
+			mVec2FPlayers.Add(player);
+		}
+
+		return true;
+	}
+
+	bool AnimationTracksBatch::Add(AnimationComponent* component)
+	{
+		if (mCollectingDepth == 0)
+			return false;
+
+		if (component->mBatchIdx < 0)
+		{
+			component->mBatchIdx = mComponents.Count();
+			mComponents.Add(component);
+		}
+
+		return true;
+	}
+
+	void AnimationTracksBatch::Remove(AnimationTrack<float>::Player* player)
+	{
+		mFloatPlayers[player->mBatchIdx] = nullptr;
+		player->mBatchIdx = -1;
+	}
+
+	void AnimationTracksBatch::Remove(AnimationTrack<Vec2F>::Player* player)
+	{
+		mVec2FPlayers[player->mBatchIdx] = nullptr;
+		player->mBatchIdx = -1;
+	}
+
+	void AnimationTracksBatch::Remove(AnimationComponent* component)
+	{
+		mComponents[component->mBatchIdx] = nullptr;
+		component->mBatchIdx = -1;
+	}
+
+	void AnimationTracksBatch::Evaluate(int count, const Function<void(int)>& func)
+	{
+		if (count >= mParallelEvaluationThreshold && TaskManager::IsSingletonInitialzed())
+		{
+			const int grainSize = 64;
+			o2Tasks.ParallelFor(0, count, func, grainSize);
+			return;
+		}
+
+		for (int i = 0; i < count; i++)
+			func(i);
+	}
+}
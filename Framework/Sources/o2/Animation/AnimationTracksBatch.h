@@ -0,0 +1,70 @@
+#pragma once
+
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
+#include "o2/Animation/Tracks/AnimationVec2FTrack.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class AnimationComponent;
+
+	// -----------------------------------------------------------------------------------------------------------
+	// Batched animation tracks evaluation. While batch is collecting, float and Vec2F tracks players aren't
+	// evaluated immediately, they are gathered into arrays by type. At the end of batch their curves are evaluated
+	// on worker threads, then values are assigned to targets and animation components mixers are updated on
+	// main thread in one pass
+	// -----------------------------------------------------------------------------------------------------------
+	class AnimationTracksBatch
+	{
+	public:
+		// Begins collecting tracks players. Batches can be nested, players are evaluated at the end of outer batch
+		static void Begin();
+
+		// Evaluates collected tracks players, assigns values and updates animation components mixers
+		static void End();
+
+		// Returns true when batch is collecting players
+		static bool IsCollecting();
+
+		// Sets minimal count of collected tracks players, that are evaluated on worker threads
+		static void SetParallelEvaluationThreshold(int count);
+
+		// Returns minimal count of collected tracks players, that are evaluated on worker threads
+		static int GetParallelEvaluationThreshold();
+
+	protected:
+		static int mCollectingDepth;              // Depth of nested batches. Players are collected when it's greater than zero
+		static int mParallelEvaluationThreshold;  // Minimal count of players, that are evaluated on worker threads
+
+		static Vector<AnimationTrack<float>::Player*> mFloatPlayers; // Collected float tracks players
+		static Vector<AnimationTrack<Vec2F>::Player*> mVec2FPlayers; // Collected Vec2F tracks players
+		static Vector<AnimationComponent*>            mComponents;   // Collected animation components, their mixers are updated after players
+
+	protected:
+		// Collects float track player. Returns false when batch isn't collecting and player must be evaluated immediately
+		static bool Add(AnimationTrack<float>::Player* player);
+
+		// Collects Vec2F track player. Returns false when batch isn't collecting and player must be evaluated immediately
+		static bool Add(AnimationTrack<Vec2F>::Player* player);
+
+		// Collects animation component. Returns false when batch isn't collecting and mixers must be updated immediately
+		static bool Add(AnimationComponent* component);
+
+		// Removes destroying collected float track player from batch. Player's slot is set to null, so indices of
+		// other players are kept
+		static void Remove(AnimationTrack<float>::Player* player);
+
+		// Removes destroying collected Vec2F track player from batch. Player's slot is set to null
+		static void Remove(AnimationTrack<Vec2F>::Player* player);
+
+		// Removes destroying collected animation component from batch. Component's slot is set to null
+		static void Remove(AnimationComponent* component);
+
+		// Calls function for each index of collected players, on worker threads when there are enough players
+		static void Evaluate(int count, const Function<void(int)>& func);
+
+		friend class AnimationComponent;
+		friend class AnimationTrack<float>::Player;
+		friend class AnimationTrack<Vec2F>::Player;
+	};
+}
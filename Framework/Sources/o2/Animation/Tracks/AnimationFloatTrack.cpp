@@ -2,6 +2,7 @@
 #include "AnimationFloatTrack.h"
 
 #include "o2/Animation/AnimationState.h"
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Scene/Components/AnimationComponent.h"
 
 namespace o2
@@ -202,6 +203,9 @@ namespace o2
 
 	AnimationTrack<float>::Player::~Player()
 	{
+		if (mBatchIdx >= 0)
+			AnimationTracksBatch::Remove(this);
+
 		if (mTargetProxy)
 			delete mTargetProxy;
 	}
@@ -279,13 +283,28 @@ namespace o2
 	}
 
 	void AnimationTrack<float>::Player::Evaluate()
+	{
+		if (!mTrack)
+			return;
+
+		if (AnimationTracksBatch::Add(this))
+			return;
+
+		EvaluateValue();
+		AssignValue();
+	}
+
+	void AnimationTrack<float>::Player::EvaluateValue()
 	{
 		if (!mTrack)
 			return;
 
 		mCurrentValue = mTrack->curve.Evaluate(mInDurationTime, mInDurationTime > mPrevInDurationTime, mPrevKey, mPrevKeyApproximation);
 		mPrevInDurationTime = mInDurationTime;
+	}
 
+	void AnimationTrack<float>::Player::AssignValue()
+	{
 		if (mTarget)
 		{
 			*mTarget = mCurrentValue;
@@ -2,6 +2,7 @@
 #include "AnimationVec2FTrack.h"
 
 #include "o2/Animation/AnimationState.h"
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Scene/Components/AnimationComponent.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Math/Interpolation.h"
@@ -516,6 +517,9 @@ namespace o2
 
 	AnimationTrack<Vec2F>::Player::~Player()
 	{
+		if (mBatchIdx >= 0)
+			AnimationTracksBatch::Remove(this);
+
 		if (mTargetProxy)
 			delete mTargetProxy;
 	}
@@ -594,11 +598,28 @@ namespace o2
 
 	void AnimationTrack<Vec2F>::Player::Evaluate()
 	{
+		if (!mTrack)
+			return;
+
+		if (AnimationTracksBatch::Add(this))
+			return;
+
+		EvaluateValue();
+		AssignValue();
+	}
+
+	void AnimationTrack<Vec2F>::Player::EvaluateValue()
+	{
+		if (!mTrack)
+			return;
+
 		mCurrentValue = mTrack->GetValue(mInDurationTime, mInDurationTime > mPrevInDurationTime, 
 										 mPrevKey, mPrevKeyApproximation);
-
 		mPrevInDurationTime = mInDurationTime;
+	}
 
+	void AnimationTrack<Vec2F>::Player::AssignValue()
+	{
 		if (mTarget)
 		{
 			*mTarget = mCurrentValue;
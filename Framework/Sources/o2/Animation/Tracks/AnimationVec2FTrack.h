@@ -197,12 +197,22 @@ namespace o2
 			Function<void()>    mTargetDelegate;        // Animation target value change event
 			IValueProxy<Vec2F>* mTargetProxy = nullptr; // Animation target proxy pointer
 
+			int mBatchIdx = -1; // Index in animation tracks batch, where player waits evaluation. -1 when it isn't collected @IGNORE
+
 		protected:
-			// Evaluates value
+			// Evaluates value. When animation tracks batch is collecting, player is collected and evaluated at batch end
 			void Evaluate() override;
 
+			// Evaluates current value by time. Doesn't touch target, so it can be called on worker thread
+			void EvaluateValue();
+
+			// Assigns current value to target
+			void AssignValue();
+
 			// Registering this in animatable value agent
 			void RegMixer(AnimationState* state, const String& path) override;
+
+			friend class AnimationTracksBatch;
 		};
 
 	public:
@@ -366,6 +376,8 @@ CLASS_METHODS_META(o2::AnimationTrack<o2::Vec2F>::Player)
 	PUBLIC_FUNCTION(IAnimationTrack*, GetTrack);
 	PUBLIC_FUNCTION(Vec2F, GetValue);
 	PROTECTED_FUNCTION(void, Evaluate);
+	PROTECTED_FUNCTION(void, EvaluateValue);
+	PROTECTED_FUNCTION(void, AssignValue);
 	PROTECTED_FUNCTION(void, RegMixer, AnimationState*, const String&);
 }
 END_META;
@@ -15,6 +15,7 @@
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
 #include "o2/Utils/Debug/Log/FileLogStream.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Debug/StackTrace.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Time.h"
@@ -82,12 +83,12 @@ namespace o2
 
 		mProjectConfig = mnew ProjectConfig();
 
+		mTaskManager = mnew TaskManager();
+
 		mAssets = mnew Assets();
 
 		mInput = mnew Input();
 
-		mTaskManager = mnew TaskManager();
-
 		mTimer = mnew Timer();
 		mTimer->Reset();
 
@@ -122,6 +123,8 @@ namespace o2
 		if (!mReady)
 			return;
 
+		o2Profiler.BeginFrame();
+
 		if (mCursorInfiniteModeEnabled)
 			CheckCursorInfiniteMode();
 
@@ -129,8 +132,15 @@ namespace o2
 
 		float realdDt = mTimer->GetDeltaTime();
 
+#if defined PLATFORM_LINUX
+		if (mFixedFrameDeltaTime > 0.0f)
+			realdDt = mFixedFrameDeltaTime;
+		else if (realdDt < maxFPSDeltaTime)
+#else
 		if (realdDt < maxFPSDeltaTime)
+#endif
 		{
+			PROFILE_SCOPE("Application::WaitFrame");
 			std::this_thread::sleep_for(std::chrono::milliseconds((int)((maxFPSDeltaTime - realdDt)*1000.0f)));
 			realdDt = maxFPSDeltaTime;
 		}
@@ -141,18 +151,28 @@ namespace o2
 
 		mTime->Update(realdDt);
 		o2Debug.Update(dt);
-		mTaskManager->Update(dt);
+
+		{
+			PROFILE_SCOPE("Application::UpdateTasks");
+			mTaskManager->Update(dt);
+		}
+
 		UpdateEventSystem();
 
 		mRender->Begin();
 
-		OnUpdate(dt);
-		UpdateScene(dt);
+		{
+			PROFILE_SCOPE("Application::Update");
+			OnUpdate(dt);
+			UpdateScene(dt);
+		}
 
 		mAccumulatedDT += dt;
 		float fixedDT = 1.0f/(float)fixedFPS;
 		while (mAccumulatedDT > fixedDT)
 		{
+			PROFILE_SCOPE("Application::FixedUpdate");
+
 			OnFixedUpdate(fixedDT);
 			FixedUpdateScene(fixedDT);
 
@@ -165,16 +185,23 @@ namespace o2
 
 		PostUpdateEventSystem();
 
-		OnDraw();
-		DrawScene();
+		{
+			PROFILE_SCOPE("Application::Draw");
+
+			OnDraw();
+			DrawScene();
 
-		DrawUIManager();
+			DrawUIManager();
 
-		o2Debug.Draw();
+			o2Debug.Draw();
+			o2Profiler.DrawOverlay();
+		}
 
 		mRender->End();
 
 		mInput->Update(dt);
+
+		o2Profiler.EndFrame();
 	}
 
 	void Application::DrawScene()
@@ -266,5 +293,6 @@ namespace o2
 
 	MemoryManager* MemoryManager::mInstance = new MemoryManager();
 	template<> Debug* Singleton<Debug>::mInstance = mnew Debug();
+	template<> Profiler* Singleton<Profiler>::mInstance = mnew Profiler();
 	template<> FileSystem* Singleton<FileSystem>::mInstance = mnew FileSystem();
 }
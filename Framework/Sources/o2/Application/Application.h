@@ -12,6 +12,8 @@
 #include "o2/Application/Android/ApplicationBase.h"
 #include <jni.h>
 #include <android/asset_manager.h>
+#elif defined PLATFORM_LINUX
+#include "o2/Application/Linux/ApplicationBase.h"
 #endif
 
 // Application access macros
@@ -147,7 +149,7 @@ namespace o2
 		// Returns is application ready to use
 		static bool IsReady();
 
-#if defined PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS || defined PLATFORM_LINUX
 
 		// Initializes engine application
 		virtual void Initialize();
@@ -10,7 +10,7 @@ namespace o2
 
 	Input::Input()
 	{
-		if (GetEnginePlatform() == Platform::Windows)
+		if (GetEnginePlatform() == Platform::Windows || GetEnginePlatform() == Platform::Linux)
 		{
 			mCursors.Add(Cursor());
 			mCursors.Last().isPressed = false;
@@ -351,7 +351,7 @@ namespace o2
 
 	void Input::OnCursorPressedMsgApply(const Vec2F& pos, CursorId id /*= 0*/)
 	{
-		if (id == 0 && o2Config.GetPlatform() == Platform::Windows)
+		if (id == 0 && (o2Config.GetPlatform() == Platform::Windows || o2Config.GetPlatform() == Platform::Linux))
 		{
 			mCursors[0].position = pos;
 			mCursors[0].isPressed = true;
@@ -392,7 +392,7 @@ namespace o2
 			{
 				releasedCursor = cursor;
 
-				if (id == 0 && o2Config.GetPlatform() == Platform::Windows)
+				if (id == 0 && (o2Config.GetPlatform() == Platform::Windows || o2Config.GetPlatform() == Platform::Linux))
 					cursor.isPressed = false;
 				else
 					mCursors.Remove(cursor);
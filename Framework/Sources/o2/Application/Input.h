@@ -6,7 +6,7 @@
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Singleton.h"
 
-#ifdef PLATFORM_ANDROID
+#if defined PLATFORM_ANDROID || defined PLATFORM_LINUX
 #include "o2/Application/Android/VKCodes.h"
 #elif PLATFORM_WINDOWS
 #include <windows.h>
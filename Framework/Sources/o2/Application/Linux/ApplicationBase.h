@@ -0,0 +1,55 @@
+#pragma once
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+	class Application;
+
+	// --------------------------------------------------------------------------------------------------
+	// Linux headless application base fields. There is no window: content size is virtual and frames are
+	// processed in loop until frames limit is reached or Quit() is called
+	// --------------------------------------------------------------------------------------------------
+	class ApplicationBase
+	{
+	protected:
+		Vec2I  mContentSize = Vec2I(1280, 720); // Virtual window content size
+		Vec2I  mWindowedPos;                    // Virtual window position
+		String mWndCaption;                     // Window caption
+		bool   mWindowed = true;                // True if app in windowed mode, false if in fullscreen mode
+		bool   mWindowResizible = true;         // True, if window can be sized by user
+		bool   mActive = true;                  // True, if application is active
+
+		int   mFramesLimit = -1;           // Count of frames processed by Launch(). Infinite when negative
+		int   mProcessedFrames = 0;        // Count of frames processed by Launch()
+		float mFixedFrameDeltaTime = 0.0f; // Frame delta time used instead of real time, when positive. Frames are processed without waiting
+		bool  mQuitRequested = false;      // Is exit from application cycle requested
+
+	public:
+		// Sets count of frames processed by Launch(). Negative value - infinite cycle
+		void SetFramesLimit(int frames);
+
+		// Returns frames limit
+		int GetFramesLimit() const;
+
+		// Returns count of frames processed by Launch()
+		int GetProcessedFramesCount() const;
+
+		// Sets frame delta time used instead of real time. Makes frames updates deterministic. Zero - real time is used
+		void SetFixedFrameDeltaTime(float dt);
+
+		// Returns frame delta time used instead of real time
+		float GetFixedFrameDeltaTime() const;
+
+		// Requests exit from application cycle after current frame
+		void Quit();
+
+		friend class Render;
+		friend class FileSystem;
+	};
+}
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,193 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Application/Application.h"
+#include "o2/Events/EventSystem.h"
+#include "o2/Render/Render.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include <limits.h>
+#include <unistd.h>
+
+namespace o2
+{
+	void ApplicationBase::SetFramesLimit(int frames)
+	{
+		mFramesLimit = frames;
+	}
+
+	int ApplicationBase::GetFramesLimit() const
+	{
+		return mFramesLimit;
+	}
+
+	int ApplicationBase::GetProcessedFramesCount() const
+	{
+		return mProcessedFrames;
+	}
+
+	void ApplicationBase::SetFixedFrameDeltaTime(float dt)
+	{
+		mFixedFrameDeltaTime = dt;
+	}
+
+	float ApplicationBase::GetFixedFrameDeltaTime() const
+	{
+		return mFixedFrameDeltaTime;
+	}
+
+	void ApplicationBase::Quit()
+	{
+		mQuitRequested = true;
+	}
+
+	void Application::Initialize()
+	{
+		BasicInitialize();
+	}
+
+	void Application::InitializePlatform()
+	{
+		mLog->Out("Initializing headless application, content size: %ix%i", mContentSize.x, mContentSize.y);
+	}
+
+	void Application::Shutdown()
+	{
+		Quit();
+	}
+
+	void Application::SetFullscreen(bool fullscreen /*= true*/)
+	{
+		mWindowed = !fullscreen;
+	}
+
+	void Application::CheckCursorInfiniteMode()
+	{}
+
+	void Application::Launch()
+	{
+		mLog->Out("Application launched!");
+
+		OnStarted();
+		onStarted.Invoke();
+		o2Events.OnApplicationStarted();
+
+		mProcessedFrames = 0;
+		mQuitRequested = false;
+
+		while (!mQuitRequested && (mFramesLimit < 0 || mProcessedFrames < mFramesLimit))
+		{
+			ProcessFrame();
+			mProcessedFrames++;
+		}
+
+		o2Events.OnApplicationClosing();
+		OnClosing();
+		onClosing.Invoke();
+	}
+
+	bool Application::IsFullScreen() const
+	{
+		return !mWindowed;
+	}
+
+	void Application::Maximize()
+	{}
+
+	bool Application::IsMaximized() const
+	{
+		return false;
+	}
+
+	void Application::SetResizible(bool resizible)
+	{
+		mWindowResizible = resizible;
+	}
+
+	bool Application::IsResizible() const
+	{
+		return mWindowResizible;
+	}
+
+	void Application::SetWindowSize(const Vec2I& size)
+	{
+		SetContentSize(size);
+	}
+
+	Vec2I Application::GetWindowSize() const
+	{
+		return mContentSize;
+	}
+
+	void Application::SetWindowPosition(const Vec2I& position)
+	{
+		mWindowedPos = position;
+		OnMoved();
+		onMoving.Invoke();
+	}
+
+	Vec2I Application::GetWindowPosition() const
+	{
+		return mWindowedPos;
+	}
+
+	void Application::SetWindowCaption(const String& caption)
+	{
+		mWndCaption = caption;
+	}
+
+	String Application::GetWindowCaption() const
+	{
+		return mWndCaption;
+	}
+
+	void Application::SetContentSize(const Vec2I& size)
+	{
+		if (size == mContentSize)
+			return;
+
+		mContentSize = size;
+
+		// Content size can be set before initialization, systems will take it on initialization
+		if (!mReady)
+			return;
+
+		mLog->Out("Set Content Size: %ix%i", size.x, size.y);
+
+		mRender->OnFrameResized();
+
+		OnResizing();
+		onResizing.Invoke();
+		o2Events.OnApplicationSized();
+	}
+
+	Vec2I Application::GetContentSize() const
+	{
+		return mContentSize;
+	}
+
+	Vec2I Application::GetScreenResolution() const
+	{
+		return mContentSize;
+	}
+
+	void Application::SetCursor(CursorType type)
+	{}
+
+	void Application::SetCursorPosition(const Vec2F& position)
+	{}
+
+	String Application::GetBinPath() const
+	{
+		char buf[PATH_MAX];
+		ssize_t length = readlink("/proc/self/exe", buf, PATH_MAX - 1);
+		if (length < 0)
+			return "";
+
+		buf[length] = '\0';
+		return o2FileSystem.CanonicalizePath(o2FileSystem.GetParentPath((String)buf));
+	}
+}
+
+#endif // PLATFORM_LINUX
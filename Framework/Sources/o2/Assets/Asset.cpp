@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "Asset.h"
 
+#include "o2/Assets/AssetLoadRequest.h"
 #include "o2/Assets/Assets.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
@@ -166,6 +167,21 @@ namespace o2
 		data.SaveToFile(path);
 	}
 
+	bool Asset::ReadDataAsync(const String& path, AssetLoadRequest& request)
+	{
+		return request.data.LoadFromFile(path);
+	}
+
+	void Asset::CompleteAsyncLoading(AssetLoadRequest& request)
+	{
+		Deserialize(request.data);
+	}
+
+	void Asset::LoadResourcesAsync(AssetLoadRequest& request, const Function<void()>& onLoaded)
+	{
+		onLoaded();
+	}
+
 }
 
 DECLARE_CLASS(o2::Asset);
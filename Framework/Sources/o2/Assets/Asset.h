@@ -11,6 +11,8 @@
 
 namespace o2
 {
+	class AssetLoadRequest;
+
 	// -------------------------------------------------------------------------------------------------
 	// Basic asset interface. Contains copy of asset, without caching. For regular use assets references
 	// -------------------------------------------------------------------------------------------------
@@ -120,6 +122,17 @@ namespace o2
 		// Saves asset data, using DataValue and serialization
 		virtual void SaveData(const String& path) const;
 
+		// Reads asset data on worker thread into request. Must not change shared engine objects, read data is applied
+		// in CompleteAsyncLoading. Returns false when data can't be read asynchronously, then it is loaded by LoadData
+		virtual bool ReadDataAsync(const String& path, AssetLoadRequest& request);
+
+		// Applies data, read in ReadDataAsync. Called on main thread
+		virtual void CompleteAsyncLoading(AssetLoadRequest& request);
+
+		// Loads resources required by asset, such as textures, and stores them in request. Called on main thread,
+		// onLoaded must be called on main thread when resources are ready
+		virtual void LoadResourcesAsync(AssetLoadRequest& request, const Function<void()>& onLoaded);
+
 		friend class AssetRef;
 		friend class Assets;
 		friend class AssetsBuilder;
@@ -194,6 +207,9 @@ CLASS_METHODS_META(o2::Asset)
 	PROTECTED_FUNCTION(void, Load, const AssetInfo&);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(bool, ReadDataAsync, const String&, AssetLoadRequest&);
+	PROTECTED_FUNCTION(void, CompleteAsyncLoading, AssetLoadRequest&);
+	PROTECTED_FUNCTION(void, LoadResourcesAsync, AssetLoadRequest&, const Function<void()>&);
 }
 END_META;
 
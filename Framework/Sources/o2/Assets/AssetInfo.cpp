@@ -13,7 +13,7 @@ namespace o2
 	}
 
 	AssetInfo::AssetInfo(const AssetInfo& other):
-		path(other.path), editTime(other.editTime), tree(other.tree), 
+		path(other.path), editTime(other.editTime), contentHash(other.contentHash), tree(other.tree), 
 		meta(other.meta ? other.meta->CloneAs<AssetMeta>() : nullptr),
 		ownChildren(false), children(other.children)
 	{}
@@ -57,6 +57,7 @@ namespace o2
 		meta = other.meta;
 		path = other.path;
 		editTime = other.editTime;
+		contentHash = other.contentHash;
 		tree = other.tree;
 		children = other.children;
 		ownChildren = false;
@@ -0,0 +1,46 @@
+#include "o2/stdafx.h"
+#include "AssetLoadRequest.h"
+
+namespace o2
+{
+	AssetLoadRequest::AssetLoadRequest(const AssetInfo& info, int priority):
+		mState(State::Queued), mPriority(priority), mAssetId(info.meta->ID()), mAsset(nullptr), mDataRead(false)
+	{}
+
+	AssetLoadRequest::State AssetLoadRequest::GetState() const
+	{
+		return mState;
+	}
+
+	bool AssetLoadRequest::IsDone() const
+	{
+		State state = mState;
+		return state == State::Completed || state == State::Canceled;
+	}
+
+	const UID& AssetLoadRequest::GetAssetId() const
+	{
+		return mAssetId;
+	}
+
+	const AssetRef& AssetLoadRequest::GetAsset() const
+	{
+		return mAssetRef;
+	}
+
+	void AssetLoadRequest::SetPriority(int priority)
+	{
+		mPriority = priority;
+	}
+
+	int AssetLoadRequest::GetPriority() const
+	{
+		return mPriority;
+	}
+
+	void AssetLoadRequest::Cancel()
+	{
+		if (!IsDone())
+			mState = State::Canceled;
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "o2/Assets/AssetRef.h"
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Serialization/DataValue.h"
+
+namespace o2
+{
+	// ------------------------------------------------------------------------------------------------
+	// Asynchronous asset loading request. Asset data is read on worker thread, then it is applied and
+	// asset's resources are uploaded on main thread. Keep request to hold loaded asset and resources
+	// ------------------------------------------------------------------------------------------------
+	class AssetLoadRequest
+	{
+	public:
+		enum class State { Queued, Reading, LoadingResources, Completed, Canceled };
+
+	public:
+		Function<void(const AssetRef&)> onCompleted; // Asset loading completed event. Called on main thread, isn't called when canceled
+
+		DataDocument       data;     // Asset data, read on worker thread
+		Vector<TextureRef> textures; // Textures, required by asset. Hold while request is alive
+
+	public:
+		// Constructor
+		AssetLoadRequest(const AssetInfo& info, int priority);
+
+		// Returns loading state
+		State GetState() const;
+
+		// Returns is loading completed or canceled
+		bool IsDone() const;
+
+		// Returns id of loading asset
+		const UID& GetAssetId() const;
+
+		// Returns loaded asset. It is valid when loading is completed
+		const AssetRef& GetAsset() const;
+
+		// Sets priority. Requests with greater priority are loaded first. Affects only queued request. Can be called
+		// from any thread
+		void SetPriority(int priority);
+
+		// Returns priority
+		int GetPriority() const;
+
+		// Cancels loading. Callback won't be called, not loaded resources aren't loaded
+		void Cancel();
+
+	protected:
+		std::atomic<State> mState;    // Loading state. Is checked on worker thread
+		std::atomic<int>   mPriority; // Loading priority. Is read when queued requests are dispatched
+		UID                mAssetId;  // Loading asset id
+		String             mPath;     // Built asset data path
+		Asset*             mAsset;    // Loading asset instance. Passed to cache when loaded
+		AssetRef           mAssetRef; // Loaded asset reference
+		bool               mDataRead; // Is asset data read on worker thread, otherwise it is loaded on main thread
+
+		friend class Assets;
+	};
+
+	typedef std::shared_ptr<AssetLoadRequest> AssetLoadRequestRef;
+}
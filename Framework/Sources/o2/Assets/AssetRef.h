@@ -203,6 +203,21 @@ namespace o2
 		// Updates specialized asset pointer
 		void UpdateSpecAsset() override { mSpecAssetPtr = dynamic_cast<T*>(mAssetPtr); };
 	};
+
+	template<typename _asset_type>
+	AssetRef Assets::CreateAsset()
+	{
+		_asset_type* newAset = mnew _asset_type();
+
+		auto cached = mnew AssetCache();
+		cached->asset = newAset;
+		cached->referencesCount = 0;
+
+		mCachedAssets.Add(cached);
+		mCachedAssetsByUID[cached->asset->GetUID()] = cached;
+
+		return AssetRef(newAset, &cached->referencesCount);
+	}
 }
 
 CLASS_BASES_META(o2::AssetRef)
@@ -2,6 +2,7 @@
 #include "Assets.h"
 
 #include "o2/Assets/Asset.h"
+#include "o2/Assets/AssetLoadRequest.h"
 #include "o2/Assets/Types/BinaryAsset.h"
 #include "o2/Assets/Types/FolderAsset.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
@@ -9,6 +10,7 @@
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Tasks/TaskManager.h"
 
 namespace o2
 {
@@ -146,6 +148,101 @@ namespace o2
 		return AssetRef(cached->asset, &cached->referencesCount);
 	}
 
+	AssetLoadRequestRef Assets::LoadAssetAsync(const String& path,
+											   const Function<void(const AssetRef&)>& onCompleted /*= Function<void(const AssetRef&)>()*/,
+											   int priority /*= 0*/)
+	{
+		auto& assetInfo = GetAssetInfo(path);
+		if (!assetInfo.IsValid())
+			return nullptr;
+
+		return LoadAssetAsync(assetInfo.meta->ID(), onCompleted, priority);
+	}
+
+	AssetLoadRequestRef Assets::LoadAssetAsync(const UID& id,
+											   const Function<void(const AssetRef&)>& onCompleted /*= Function<void(const AssetRef&)>()*/,
+											   int priority /*= 0*/)
+	{
+		auto& assetInfo = GetAssetInfo(id);
+		if (!assetInfo.IsValid())
+			return nullptr;
+
+		auto request = std::make_shared<AssetLoadRequest>(assetInfo, priority);
+		request->onCompleted = onCompleted;
+
+		// Already loaded asset only loads it's resources
+		if (auto cached = FindAssetCache(id))
+		{
+			request->mAssetRef = AssetRef(cached->asset, &cached->referencesCount);
+			LoadRequestResources(request);
+			return request;
+		}
+
+		request->mAsset = (Asset*)assetInfo.meta->GetAssetType()->CreateSample();
+		request->mAsset->mInfo = assetInfo;
+		request->mPath = request->mAsset->GetBuiltFullPath();
+
+		mQueuedLoadRequests.Add(request);
+		DispatchLoadRequests();
+
+		return request;
+	}
+
+	Vector<AssetLoadRequestRef> Assets::PrefetchFolder(const String& path, int priority /*= 0*/)
+	{
+		Vector<AssetLoadRequestRef> res;
+
+		auto& folderInfo = GetAssetInfo(path);
+		if (!folderInfo.IsValid())
+			return res;
+
+		Vector<const AssetInfo*> infos;
+		GetFolderAssetsInfos(folderInfo, infos);
+
+		for (auto info : infos)
+		{
+			if (auto request = LoadAssetAsync(info->meta->ID(), Function<void(const AssetRef&)>(), priority))
+				res.Add(request);
+		}
+
+		return res;
+	}
+
+	void Assets::CancelAssetLoading(const AssetLoadRequestRef& request)
+	{
+		if (!request)
+			return;
+
+		bool loadingResources = request->GetState() == AssetLoadRequest::State::LoadingResources;
+
+		request->Cancel();
+
+		if (mQueuedLoadRequests.Contains(request))
+		{
+			mQueuedLoadRequests.Remove(request);
+			delete request->mAsset;
+			request->mAsset = nullptr;
+		}
+
+		// Loading resources are dropped when they are loaded, already loaded ones are released
+		if (loadingResources)
+		{
+			request->textures.Clear();
+			request->mAssetRef = AssetRef();
+		}
+	}
+
+	void Assets::SetMaxAsyncLoadingAssets(int count)
+	{
+		mMaxAsyncLoadingAssets = Math::Max(count, 1);
+		DispatchLoadRequests();
+	}
+
+	int Assets::GetMaxAsyncLoadingAssets() const
+	{
+		return mMaxAsyncLoadingAssets;
+	}
+
 	bool Assets::IsAssetExist(const String& path) const
 	{
 		return GetAssetInfo(path).meta->ID() != UID::empty;
@@ -459,6 +556,108 @@ namespace o2
 		}
 	}
 
+	void Assets::DispatchLoadRequests()
+	{
+		while (mReadingLoadRequests.Count() < mMaxAsyncLoadingAssets && !mQueuedLoadRequests.IsEmpty())
+		{
+			int bestIdx = 0;
+			for (int i = 1; i < mQueuedLoadRequests.Count(); i++)
+			{
+				if (mQueuedLoadRequests[i]->GetPriority() > mQueuedLoadRequests[bestIdx]->GetPriority())
+					bestIdx = i;
+			}
+
+			AssetLoadRequestRef request = mQueuedLoadRequests[bestIdx];
+			mQueuedLoadRequests.RemoveAt(bestIdx);
+
+			StartReadingLoadRequest(request);
+		}
+	}
+
+	void Assets::StartReadingLoadRequest(const AssetLoadRequestRef& request)
+	{
+		request->mState = AssetLoadRequest::State::Reading;
+
+		if (!TaskManager::IsSingletonInitialzed())
+		{
+			request->mDataRead = request->mAsset->ReadDataAsync(request->mPath, *request);
+			OnLoadRequestRead(request);
+			return;
+		}
+
+		mReadingLoadRequests.Add(request);
+
+		o2Tasks.RunJob([=]() {
+			if (request->mState != AssetLoadRequest::State::Canceled)
+				request->mDataRead = request->mAsset->ReadDataAsync(request->mPath, *request);
+
+			o2Jobs.RunOnMainThread([=]() { OnLoadRequestRead(request); });
+		});
+	}
+
+	void Assets::OnLoadRequestRead(const AssetLoadRequestRef& request)
+	{
+		mReadingLoadRequests.Remove(request);
+
+		if (request->mState == AssetLoadRequest::State::Canceled)
+		{
+			delete request->mAsset;
+			request->mAsset = nullptr;
+		}
+		else
+		{
+			// Asset could be loaded synchronously while request was reading, then cached one is used
+			AssetCache* cached = FindAssetCache(request->mAssetId);
+			if (cached)
+				delete request->mAsset;
+			else
+			{
+				if (request->mDataRead)
+					request->mAsset->CompleteAsyncLoading(*request);
+				else
+					request->mAsset->LoadData(request->mPath);
+
+				cached = mnew AssetCache();
+				cached->asset = request->mAsset;
+				cached->referencesCount = 0;
+
+				mCachedAssets.Add(cached);
+				mCachedAssetsByPath[cached->asset->GetPath()] = cached;
+				mCachedAssetsByUID[cached->asset->GetUID()] = cached;
+			}
+
+			request->mAsset = nullptr;
+			request->mAssetRef = AssetRef(cached->asset, &cached->referencesCount);
+			request->data.Clear();
+
+			LoadRequestResources(request);
+		}
+
+		DispatchLoadRequests();
+	}
+
+	void Assets::LoadRequestResources(const AssetLoadRequestRef& request)
+	{
+		request->mState = AssetLoadRequest::State::LoadingResources;
+
+		request->mAssetRef->LoadResourcesAsync(*request, [=]() {
+			if (request->mState == AssetLoadRequest::State::Canceled)
+				return;
+
+			request->mState = AssetLoadRequest::State::Completed;
+			request->onCompleted(request->mAssetRef);
+		});
+	}
+
+	void Assets::GetFolderAssetsInfos(const AssetInfo& folderInfo, Vector<const AssetInfo*>& infos) const
+	{
+		for (auto child : folderInfo.children)
+		{
+			infos.Add(child);
+			GetFolderAssetsInfos(*child, infos);
+		}
+	}
+
 	Assets::AssetCache* Assets::FindAssetCache(const String& path)
 	{
 		Assets::AssetCache* res = nullptr;
@@ -504,17 +703,11 @@ namespace o2
 	void Assets::RemoveAssetCache(Asset* asset)
 	{
 		AssetCache* cached = nullptr;
-		auto fnd = mCachedAssetsByUID.find(asset->GetUID());
-		if (fnd != mCachedAssetsByUID.end()) {
-			cached = fnd->second;
-			mCachedAssetsByUID.erase(fnd);
-		}
+		if (mCachedAssetsByUID.TryGetValue(asset->GetUID(), cached))
+			mCachedAssetsByUID.Remove(asset->GetUID());
 
-		auto fnd2 = mCachedAssetsByPath.find(asset->GetPath());
-		if (fnd2 != mCachedAssetsByPath.end()) {
-			cached = fnd2->second;
-			mCachedAssetsByPath.erase(fnd2);
-		}
+		if (mCachedAssetsByPath.TryGetValue(asset->GetPath(), cached))
+			mCachedAssetsByPath.Remove(asset->GetPath());
 
 		if (cached) {
 			mCachedAssets.Remove(cached);
@@ -2,22 +2,27 @@
 
 #include "o2/Assets/Asset.h"
 #include "o2/Assets/AssetInfo.h"
-#include "o2/Assets/AssetRef.h"
 #include "o2/Assets/AssetsTree.h"
 #include "o2/Utils/FileSystem/FileInfo.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/UnorderedMap.h"
 #include "o2/Utils/Types/Containers/Vector.h"
+#include <memory>
 
 // Assets system access macros
 #define  o2Assets o2::Assets::Instance()
 
 namespace o2
 {
+	class AssetLoadRequest;
+	class AssetRef;
 	class AssetsBuilder;
 	class LogStream;
 
+	typedef std::shared_ptr<AssetLoadRequest> AssetLoadRequestRef;
+
 	// ----------------
 	// Assets utilities
 	// ----------------
@@ -70,6 +75,30 @@ namespace o2
 		// Returns asset reference by id
 		AssetRef GetAssetRef(const UID& id);
 
+		// Loads asset by path asynchronously. Data is read on worker threads, onCompleted is called on main thread.
+		// Requests with greater priority are loaded first. Returns null request when asset isn't exist.
+		// When asset is already loaded, only it's resources are loaded and onCompleted can be called immediately
+		AssetLoadRequestRef LoadAssetAsync(const String& path, const Function<void(const AssetRef&)>& onCompleted = Function<void(const AssetRef&)>(),
+										   int priority = 0);
+
+		// Loads asset by id asynchronously. Data is read on worker threads, onCompleted is called on main thread.
+		// Requests with greater priority are loaded first. Returns null request when asset isn't exist.
+		// When asset is already loaded, only it's resources are loaded and onCompleted can be called immediately
+		AssetLoadRequestRef LoadAssetAsync(const UID& id, const Function<void(const AssetRef&)>& onCompleted = Function<void(const AssetRef&)>(),
+										   int priority = 0);
+
+		// Loads all assets in folder and subfolders asynchronously. Keep requests to hold loaded assets and their resources
+		Vector<AssetLoadRequestRef> PrefetchFolder(const String& path, int priority = 0);
+
+		// Cancels asynchronous loading request
+		void CancelAssetLoading(const AssetLoadRequestRef& request);
+
+		// Sets maximum count of assets, reading simultaneously on worker threads
+		void SetMaxAsyncLoadingAssets(int count);
+
+		// Returns maximum count of assets, reading simultaneously on worker threads
+		int GetMaxAsyncLoadingAssets() const;
+
 		// Creates asset type _asset_type
 		template<typename _asset_type>
 		AssetRef CreateAsset();
@@ -149,9 +178,13 @@ namespace o2
 		Map<String, const Type*> mAssetsTypes;   // Assets types and extensions dictionary
 		const Type*              mStdAssetType;  // Standard asset type
 
-		Vector<AssetCache*>      mCachedAssets;       // Current cached assets
-		Map<String, AssetCache*> mCachedAssetsByPath; // Current cached assets by path
-		Map<UID, AssetCache*>    mCachedAssetsByUID;  // Current cached assets by uid
+		Vector<AssetCache*>               mCachedAssets;       // Current cached assets
+		UnorderedMap<String, AssetCache*> mCachedAssetsByPath; // Current cached assets by path
+		UnorderedMap<UID, AssetCache*>    mCachedAssetsByUID;  // Current cached assets by uid
+
+		Vector<AssetLoadRequestRef> mQueuedLoadRequests;        // Asynchronous loading requests, waiting for reading
+		Vector<AssetLoadRequestRef> mReadingLoadRequests;       // Asynchronous loading requests, reading on worker threads
+		int                         mMaxAsyncLoadingAssets = 4; // Maximum count of assets, reading simultaneously
 
 	protected:
 		// Loads asset infos
@@ -163,6 +196,21 @@ namespace o2
 		// Checks assets with zero references and removes them
 		void CheckAssetsUnload();
 
+		// Starts reading of queued asynchronous requests with greatest priority
+		void DispatchLoadRequests();
+
+		// Starts reading request data on worker thread
+		void StartReadingLoadRequest(const AssetLoadRequestRef& request);
+
+		// It is called on main thread when request data is read. Applies data and loads asset resources
+		void OnLoadRequestRead(const AssetLoadRequestRef& request);
+
+		// Loads resources of request's asset and completes request
+		void LoadRequestResources(const AssetLoadRequestRef& request);
+
+		// Adds assets infos of folder and subfolders into list
+		void GetFolderAssetsInfos(const AssetInfo& folderInfo, Vector<const AssetInfo*>& infos) const;
+
 		// Returns asset cache by path
 		AssetCache* FindAssetCache(const String& path);
 
@@ -194,20 +242,7 @@ namespace o2
 		friend class AssetRef;
 		friend class FolderAsset;
 	};
+}
 
-	template<typename _asset_type>
-	AssetRef Assets::CreateAsset()
-	{
-		_asset_type* newAset = mnew _asset_type();
-
-		auto cached = mnew AssetCache();
-		cached->asset = newAset;
-		cached->referencesCount = 0;
-
-		mCachedAssets.Add(cached);
-		mCachedAssetsByUID[cached->asset->GetUID()] = cached;
-
-		return AssetRef(newAset, &cached->referencesCount);
-	}
+#include "o2/Assets/AssetRef.h"
 
-}
@@ -4,6 +4,7 @@
 #include "o2/Assets/AssetInfo.h"
 #include "o2/Utils/FileSystem/FileInfo.h"
 #include "o2/Utils/Basic/ITree.h"
+#include "o2/Utils/Types/Containers/UnorderedMap.h"
 
 namespace o2
 {
@@ -20,10 +21,10 @@ namespace o2
 		String assetsPath;      // Assets path @SERIALIZABLE
 		String builtAssetsPath; // Built assets path @SERIALIZABLE
 
-		Vector<AssetInfo*>      rootAssets;      // Root path assets @SERIALIZABLE
-		Vector<AssetInfo*>      allAssets;       // All assets
-		Map<String, AssetInfo*> allAssetsByPath; // All assets by path
-		Map<UID, AssetInfo*>    allAssetsByUID;  // All assets by UID
+		Vector<AssetInfo*>               rootAssets;      // Root path assets @SERIALIZABLE
+		Vector<AssetInfo*>               allAssets;       // All assets
+		UnorderedMap<String, AssetInfo*> allAssetsByPath; // All assets by path @IGNORE
+		UnorderedMap<UID, AssetInfo*>    allAssetsByUID;  // All assets by UID @IGNORE
 
 	public:
 		// Default constructor
@@ -88,8 +89,6 @@ CLASS_FIELDS_META(o2::AssetsTree)
 	PUBLIC_FIELD(builtAssetsPath).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(rootAssets).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(allAssets);
-	PUBLIC_FIELD(allAssetsByPath);
-	PUBLIC_FIELD(allAssetsByUID);
 }
 END_META;
 CLASS_METHODS_META(o2::AssetsTree)
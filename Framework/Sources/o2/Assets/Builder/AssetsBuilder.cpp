@@ -9,12 +9,16 @@
 #include "o2/Assets/Builder/ImageAssetConverter.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/TaskManager.h"
 
 namespace o2
 {
-	AssetsBuilder::AssetsBuilder()
+	AssetsBuilder::AssetsBuilder():
+		mBuiltAssetsTreeChanged(false)
 	{
 		mLog = mnew LogStream("Assets builder");
 		o2Debug.GetLog()->BindStream(mLog);
@@ -30,6 +34,8 @@ namespace o2
 	const Vector<UID>& AssetsBuilder::BuildAssets(const String& assetsPath, const String& builtAssetsPath, const String& dataAssetsTreePath,
 												  AssetsTree* assetsTree, bool forcible /*= false*/)
 	{
+		PROFILE_SCOPE("AssetsBuilder::BuildAssets");
+
 		mSourceAssetsPath = assetsPath;
 		mBuiltAssetsPath = builtAssetsPath;
 		mBuiltAssetsTreePath = dataAssetsTreePath;
@@ -58,12 +64,14 @@ namespace o2
 		builtAssetsTreeDoc.LoadFromFile(mBuiltAssetsTreePath);
 		mBuiltAssetsTree->Deserialize(builtAssetsTreeDoc);
 
+		CalculateSourceAssetsHashes();
+
 		ProcessRemovedAssets();
 		ProcessNewAssets();
 		ProcessModifiedAssets();
 		ConvertersPostProcess();
 
-		if (!mModifiedAssets.IsEmpty())
+		if (!mModifiedAssets.IsEmpty() || mBuiltAssetsTreeChanged)
 		{
 			mBuiltAssetsTree->assetsPath = mSourceAssetsPath;
 			mBuiltAssetsTree->builtAssetsPath = mBuiltAssetsPath;
@@ -160,6 +168,49 @@ namespace o2
 		}
 	}
 
+	void AssetsBuilder::CalculateSourceAssetsHashes()
+	{
+		PROFILE_SCOPE("AssetsBuilder::CalculateSourceAssetsHashes");
+
+		const Type* folderType = &TypeOf(FolderAsset);
+
+		Vector<AssetInfo*> hashingAssets;
+		for (auto sourceAssetInfo : mSourceAssetsTree.allAssets)
+		{
+			if (sourceAssetInfo->meta->GetAssetType() == folderType)
+				continue;
+
+			// Not touched file has the same contents, no need to read it again
+			AssetInfo* builtAssetInfo = nullptr;
+			if (mBuiltAssetsTree->allAssetsByUID.TryGetValue(sourceAssetInfo->meta->ID(), builtAssetInfo))
+			{
+				if (builtAssetInfo->contentHash != 0 && builtAssetInfo->path == sourceAssetInfo->path &&
+					builtAssetInfo->editTime == sourceAssetInfo->editTime)
+				{
+					sourceAssetInfo->contentHash = builtAssetInfo->contentHash;
+					continue;
+				}
+			}
+
+			hashingAssets.Add(sourceAssetInfo);
+		}
+
+		ParallelFor(hashingAssets.Count(), [&](int idx) {
+			hashingAssets[idx]->contentHash = CalculateFileHash(mSourceAssetsPath + hashingAssets[idx]->path);
+		});
+	}
+
+	bool AssetsBuilder::IsAssetChanged(const AssetInfo& sourceAssetInfo, const AssetInfo& builtAssetInfo) const
+	{
+		if (!sourceAssetInfo.meta->IsEqual(builtAssetInfo.meta))
+			return true;
+
+		if (sourceAssetInfo.contentHash != 0 && builtAssetInfo.contentHash != 0)
+			return sourceAssetInfo.contentHash != builtAssetInfo.contentHash;
+
+		return sourceAssetInfo.editTime != builtAssetInfo.editTime;
+	}
+
 	void AssetsBuilder::ProcessRemovedAssets()
 	{
 		const Type* folderTypeId = &TypeOf(FolderAsset);
@@ -180,8 +231,7 @@ namespace o2
 					continue;
 				}
 
-				auto fnd = mSourceAssetsTree.allAssetsByUID.find(builtAssetInfo->meta->ID());
-				bool needRemove = fnd == mSourceAssetsTree.allAssetsByUID.end();
+				bool needRemove = !mSourceAssetsTree.allAssetsByUID.ContainsKey(builtAssetInfo->meta->ID());
 
 				if (!needRemove)
 				{
@@ -224,31 +274,36 @@ namespace o2
 				if (skip)
 					continue;
 
-				auto fnd = mBuiltAssetsTree->allAssetsByUID.find(sourceAssetInfo->meta->ID());
-				if (fnd != mBuiltAssetsTree->allAssetsByUID.end()) 
+				AssetInfo* builtAssetInfo = nullptr;
+				if (mBuiltAssetsTree->allAssetsByUID.TryGetValue(sourceAssetInfo->meta->ID(), builtAssetInfo))
 				{
-					auto builtAssetInfo = fnd->second;
-
 					if (sourceAssetInfo->path == builtAssetInfo->path)
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (IsAssetChanged(*sourceAssetInfo, *builtAssetInfo))
 						{
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							ConvertAsset(*sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
 							mLog->Out("Modified asset: " + sourceAssetInfo->path);
 						}
+						else if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
+								 sourceAssetInfo->contentHash != builtAssetInfo->contentHash)
+						{
+							// Only touched, contents are the same
+							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
+							mBuiltAssetsTreeChanged = true;
+						}
 					}
 					else
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (IsAssetChanged(*sourceAssetInfo, *builtAssetInfo))
 						{
 							GetAssetConverter(builtAssetInfo->meta->GetAssetType())->RemoveAsset(*builtAssetInfo);
 
@@ -258,11 +313,12 @@ namespace o2
 
 							builtAssetInfo->path = sourceAssetInfo->path;
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							ConvertAsset(*sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 							mBuiltAssetsTree->AddAsset(builtAssetInfo);
@@ -276,6 +332,7 @@ namespace o2
 
 							builtAssetInfo->path = sourceAssetInfo->path;
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
@@ -287,6 +344,8 @@ namespace o2
 				}
 			}
 		}
+
+		CompleteDeferredConverting();
 	}
 
 	void AssetsBuilder::ProcessNewAssets()
@@ -308,13 +367,12 @@ namespace o2
 				if (skip)
 					continue;
 
-				auto fnd = mBuiltAssetsTree->allAssetsByUID.find(sourceAssetInfo->meta->ID());
-				bool isNew = fnd == mBuiltAssetsTree->allAssetsByUID.end();
+				bool isNew = !mBuiltAssetsTree->allAssetsByUID.ContainsKey(sourceAssetInfo->meta->ID());
 
 				if (!isNew)
 					continue;
 
-				GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+				ConvertAsset(*sourceAssetInfo);
 
 				mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
@@ -323,11 +381,37 @@ namespace o2
 				AssetInfo* newBuiltAsset = mnew AssetInfo();
 				newBuiltAsset->path = sourceAssetInfo->path;
 				newBuiltAsset->editTime = sourceAssetInfo->editTime;
+				newBuiltAsset->contentHash = sourceAssetInfo->contentHash;
 				newBuiltAsset->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
 				mBuiltAssetsTree->AddAsset(newBuiltAsset);
 			}
 		}
+
+		CompleteDeferredConverting();
+	}
+
+	void AssetsBuilder::ConvertAsset(const AssetInfo& sourceAssetInfo)
+	{
+		IAssetConverter* converter = GetAssetConverter(sourceAssetInfo.meta->GetAssetType());
+		if (converter->IsConvertingThreadSafe())
+			mDeferredConvertAssets.Add(&sourceAssetInfo);
+		else
+			converter->ConvertAsset(sourceAssetInfo);
+	}
+
+	void AssetsBuilder::CompleteDeferredConverting()
+	{
+		PROFILE_SCOPE("AssetsBuilder::CompleteDeferredConverting");
+
+		ParallelFor(mDeferredConvertAssets.Count(), [&](int idx) {
+			PROFILE_SCOPE("AssetsBuilder::ConvertAsset");
+
+			auto assetInfo = mDeferredConvertAssets[idx];
+			GetAssetConverter(assetInfo->meta->GetAssetType())->ConvertAsset(*assetInfo);
+		});
+
+		mDeferredConvertAssets.Clear();
 	}
 
 	void AssetsBuilder::ConvertersPostProcess()
@@ -363,6 +447,8 @@ namespace o2
 	void AssetsBuilder::Reset()
 	{
 		mModifiedAssets.Clear();
+		mDeferredConvertAssets.Clear();
+		mBuiltAssetsTreeChanged = false;
 		mSourceAssetsTree.Clear();
 		mBuiltAssetsTree->Clear();
 
@@ -371,4 +457,45 @@ namespace o2
 
 		mStdAssetConverter.Reset();
 	}
+
+	void AssetsBuilder::ParallelFor(int count, const Function<void(int)>& func)
+	{
+		if (TaskManager::IsSingletonInitialzed())
+		{
+			o2Tasks.ParallelFor(0, count, func);
+			return;
+		}
+
+		for (int i = 0; i < count; i++)
+			func(i);
+	}
+
+	UInt64 AssetsBuilder::CalculateFileHash(const String& path)
+	{
+		InFile file(path);
+		if (!file.IsOpened())
+			return 0;
+
+		const UInt bufferSize = 16*1024;
+		unsigned char buffer[bufferSize];
+
+		// FNV-1a
+		UInt64 hash = 14695981039346656037ULL;
+
+		UInt dataSize = file.GetDataSize();
+		for (UInt readed = 0; readed < dataSize; readed += bufferSize)
+		{
+			UInt chunkSize = Math::Min(bufferSize, dataSize - readed);
+			file.ReadData(buffer, chunkSize);
+
+			for (UInt i = 0; i < chunkSize; i++)
+			{
+				hash ^= buffer[i];
+				hash *= 1099511628211ULL;
+			}
+		}
+
+		// Zero is reserved for not calculated hash
+		return hash != 0 ? hash : 1;
+	}
 }
@@ -43,7 +43,10 @@ namespace o2
 		String      mBuiltAssetsTreePath; // Built assets tree data path
 		AssetsTree* mBuiltAssetsTree;     // Built assets tree
 
-		Vector<UID> mModifiedAssets; // Modified assets infos
+		Vector<UID> mModifiedAssets;          // Modified assets infos
+		bool        mBuiltAssetsTreeChanged; // True when built assets tree must be saved, even there are no modified assets
+
+		Vector<const AssetInfo*> mDeferredConvertAssets; // Source assets, waiting for converting on worker threads
 
 		Map<const Type*, IAssetConverter*> mAssetConverters;   // Assets converters by type
 		StdAssetConverter                  mStdAssetConverter; // Standard assets converter
@@ -58,6 +61,12 @@ namespace o2
 		// Checks basic atlas exist
 		void CheckBasicAtlas();
 
+		// Calculates source assets files contents hashes. Reuses hashes from built assets tree for not touched files
+		void CalculateSourceAssetsHashes();
+
+		// Returns true when source asset differs from built: by meta, by content hash, or by edit time when hash is unknown
+		bool IsAssetChanged(const AssetInfo& sourceAssetInfo, const AssetInfo& builtAssetInfo) const;
+
 		// Searching and removing assets
 		void ProcessRemovedAssets();
 
@@ -67,6 +76,12 @@ namespace o2
 		// Searches new assets
 		void ProcessNewAssets();
 
+		// Converts asset. Asset is deferred for converting on worker threads when it's converter is thread safe
+		void ConvertAsset(const AssetInfo& sourceAssetInfo);
+
+		// Converts deferred assets on worker threads and waits for finish
+		void CompleteDeferredConverting();
+
 		// Launches converters post process
 		void ConvertersPostProcess();
 		
@@ -82,6 +97,12 @@ namespace o2
 		// Resets builder
 		void Reset();
 
+		// Calls function for each index in [0, count) on job system workers, or serially when there is no job system
+		static void ParallelFor(int count, const Function<void(int)>& func);
+
+		// Returns hash of file contents, or zero when file can't be opened
+		static UInt64 CalculateFileHash(const String& path);
+
 		friend class AtlasAssetConverter;
 	};
 }
@@ -7,6 +7,7 @@
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/System/Time/Timer.h"
 
 namespace o2
 {
@@ -186,6 +187,20 @@ namespace o2
 		RectsPacker packer(meta->windows.maxSize);
 		float imagesBorder = (float)meta->border;
 
+		// Load last images placements for keeping them stable
+		DataDocument lastAtlasData;
+		lastAtlasData.LoadFromFile(mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path);
+
+		Vector<AtlasAsset::Page> lastPages;
+		Vector<Image> lastImages;
+		if (lastAtlasData.GetMembersCount() > 0)
+		{
+			lastPages = lastAtlasData["mPages"];
+			lastImages = lastAtlasData["mImages"];
+		}
+
+		bool keepLastPlacements = !lastPages.IsEmpty() && lastPages[0].mSize == (Vec2I)packer.GetMaxSize();
+
 		// Initialize pack images
 		Vector<ImagePackDef> packImages;
 		for (auto img : images)
@@ -220,15 +235,44 @@ namespace o2
 			imagePackDef.packRect = packRect;
 
 			packImages.Add(imagePackDef);
+
+			// Not changed image keeps last placement
+			if (keepLastPlacements && !mAssetsBuilder->mModifiedAssets.Contains(img.id) &&
+				lastImages.Any([&](const Image& x) { return x.id == img.id && x.time == img.time; }))
+			{
+				for (auto& page : lastPages)
+				{
+					RectI lastRect;
+					if (page.mImagesRects.TryGetValue(img.id, lastRect))
+					{
+						packRect->page = page.mId;
+						packRect->rect = RectF((float)lastRect.left - imagesBorder, (float)lastRect.top + imagesBorder,
+											   (float)lastRect.right + imagesBorder, (float)lastRect.bottom - imagesBorder);
+						break;
+					}
+				}
+			}
 		}
 
-		// Try to pack
-		if (!packer.Pack())
+		// Try to pack. Incremental packing is used while it fits into the same pages count, otherwise all
+		// images are packed again
+		Timer packTimer;
+
+		bool packed = keepLastPlacements && packer.PackIncremental() && packer.GetPagesCount() <= lastPages.Count();
+		if (!packed)
+			packed = packer.Pack();
+
+		if (!packed)
 		{
 			mAssetsBuilder->mLog->Error("Atlas " + atlasInfo->path + " packing failed");
 			return;
 		}
-		else mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " successfully packed");
+		else
+		{
+			mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " successfully packed for " + (String)packTimer.GetDeltaTime() +
+									  " seconds: " + (String)packer.GetPagesCount() + " pages, occupancy " +
+									  (String)(int)(packer.GetOccupancy()*100.0f) + "%");
+		}
 
 		// Initialize bitmaps and pages
 		int pagesCount = packer.GetPagesCount();
@@ -19,6 +19,11 @@ namespace o2
 	void IAssetConverter::MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo)
 	{}
 
+	bool IAssetConverter::IsConvertingThreadSafe() const
+	{
+		return false;
+	}
+
 	Vector<UID> IAssetConverter::AssetsPostProcess()
 	{
 		return Vector<UID>();
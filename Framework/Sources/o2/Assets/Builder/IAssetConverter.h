@@ -32,6 +32,9 @@ namespace o2
 		// Moves asset to new path
 		virtual void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
 
+		// Returns true when ConvertAsset can be called from worker threads for different assets simultaneously
+		virtual bool IsConvertingThreadSafe() const;
+
 		// Post processing
 		virtual Vector<UID> AssetsPostProcess();
 
@@ -66,6 +69,7 @@ CLASS_METHODS_META(o2::IAssetConverter)
 	PUBLIC_FUNCTION(void, ConvertAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, RemoveAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+	PUBLIC_FUNCTION(bool, IsConvertingThreadSafe);
 	PUBLIC_FUNCTION(Vector<UID>, AssetsPostProcess);
 	PUBLIC_FUNCTION(void, Reset);
 	PUBLIC_FUNCTION(void, SetAssetsBuilder, AssetsBuilder*);
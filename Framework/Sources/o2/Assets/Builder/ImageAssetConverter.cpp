@@ -38,6 +38,11 @@ namespace o2
 
 		o2FileSystem.FileMove(fullPathFrom, fullPathTo);
 	}
+
+	bool ImageAssetConverter::IsConvertingThreadSafe() const
+	{
+		return true;
+	}
 }
 
 DECLARE_CLASS(o2::ImageAssetConverter);
@@ -21,7 +21,9 @@ namespace o2
 		String sourceAssetPath = mAssetsBuilder->GetSourceAssetsPath() + node.path;
 		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
 
-		o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+		if (!node.meta->IsBinaryDataBuild() || !ConvertToBinaryData(sourceAssetPath, buildedAssetPath))
+			o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+
 		o2FileSystem.SetFileEditDate(buildedAssetPath, node.editTime);
 	}
 
@@ -39,6 +41,20 @@ namespace o2
 
 		o2FileSystem.FileMove(fullPathFrom, fullPathTo);
 	}
+
+	bool StdAssetConverter::IsConvertingThreadSafe() const
+	{
+		return true;
+	}
+
+	bool StdAssetConverter::ConvertToBinaryData(const String& sourcePath, const String& builtPath) const
+	{
+		DataDocument data;
+		if (!data.LoadFromFile(sourcePath))
+			return false;
+
+		return data.SaveToFile(builtPath, DataDocument::Format::Binary);
+	}
 }
 
 DECLARE_CLASS(o2::StdAssetConverter);
@@ -13,7 +13,7 @@ namespace o2
 		// Returns vector of processing assets types
 		Vector<const Type*> GetProcessingAssetsTypes() const;
 
-		// Copies asset
+		// Copies asset. Data of asset with binary build in meta is converted into binary format
 		void ConvertAsset(const AssetInfo& node);
 
 		// Removes asset
@@ -22,7 +22,14 @@ namespace o2
 		// Moves asset to new path
 		void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
 
+		// Returns true, files are converted independently
+		bool IsConvertingThreadSafe() const;
+
 		IOBJECT(StdAssetConverter);
+
+	protected:
+		// Loads data document from source file and saves it in binary format. Returns false when source isn't data document
+		bool ConvertToBinaryData(const String& sourcePath, const String& builtPath) const;
 	};
 }
 
@@ -42,5 +49,7 @@ CLASS_METHODS_META(o2::StdAssetConverter)
 	PUBLIC_FUNCTION(void, ConvertAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, RemoveAsset, const AssetInfo&);
 	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+	PUBLIC_FUNCTION(bool, IsConvertingThreadSafe);
+	PROTECTED_FUNCTION(bool, ConvertToBinaryData, const String&, const String&);
 }
 END_META;
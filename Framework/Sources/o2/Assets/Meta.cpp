@@ -17,7 +17,17 @@ namespace o2
 
 	bool AssetMeta::IsEqual(AssetMeta* other) const
 	{
-		return GetAssetType() == other->GetAssetType() && mId == other->mId;
+		return GetAssetType() == other->GetAssetType() && mId == other->mId && mBinaryDataBuild == other->mBinaryDataBuild;
+	}
+
+	void AssetMeta::SetBinaryDataBuild(bool binary)
+	{
+		mBinaryDataBuild = binary;
+	}
+
+	bool AssetMeta::IsBinaryDataBuild() const
+	{
+		return mBinaryDataBuild;
 	}
 
 	const UID& AssetMeta::ID() const
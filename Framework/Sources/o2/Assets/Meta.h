@@ -26,10 +26,17 @@ namespace o2
 		// Returns true if other meta is equal to this
 		virtual bool IsEqual(AssetMeta* other) const;
 
+		// Sets asset data building in binary format. Used by assets, stored as data document
+		void SetBinaryDataBuild(bool binary);
+
+		// Returns is asset data building in binary format
+		bool IsBinaryDataBuild() const;
+
 		SERIALIZABLE(AssetMeta);
 
 	private:
-		UID mId; // Id of asset @SERIALIZABLE
+		UID  mId;                      // Id of asset @SERIALIZABLE
+		bool mBinaryDataBuild = false; // Is asset data converted into binary format when building @SERIALIZABLE
 
 		friend class Asset;
 	};
@@ -56,6 +63,7 @@ END_META;
 CLASS_FIELDS_META(o2::AssetMeta)
 {
 	PRIVATE_FIELD(mId).SERIALIZABLE_ATTRIBUTE();
+	PRIVATE_FIELD(mBinaryDataBuild).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
 }
 END_META;
 CLASS_METHODS_META(o2::AssetMeta)
@@ -64,6 +72,8 @@ CLASS_METHODS_META(o2::AssetMeta)
 	PUBLIC_FUNCTION(const UID&, ID);
 	PUBLIC_FUNCTION(const Type*, GetAssetType);
 	PUBLIC_FUNCTION(bool, IsEqual, AssetMeta*);
+	PUBLIC_FUNCTION(void, SetBinaryDataBuild, bool);
+	PUBLIC_FUNCTION(bool, IsBinaryDataBuild);
 }
 END_META;
 
@@ -130,7 +130,9 @@ namespace o2
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::AtlasAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::AtlasAsset>);
 
 DECLARE_CLASS(o2::AtlasAsset);
@@ -97,6 +97,15 @@ namespace o2
 		file.ReadFullData(mData);
 	}
 
+	bool BinaryAsset::ReadDataAsync(const String& path, AssetLoadRequest& request)
+	{
+		LoadData(path);
+		return true;
+	}
+
+	void BinaryAsset::CompleteAsyncLoading(AssetLoadRequest& request)
+	{}
+
 	void BinaryAsset::SaveData(const String& path) const
 	{
 		OutFile file(path);
@@ -105,8 +114,11 @@ namespace o2
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::BinaryAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::BinaryAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::BinaryAsset>);
 
 DECLARE_CLASS(o2::BinaryAsset);
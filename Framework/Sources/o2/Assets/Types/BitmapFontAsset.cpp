@@ -39,8 +39,15 @@ namespace o2
 		if (!mFont)
 			mFont = mnew BitmapFont(path);
 	}
+
+	bool BitmapFontAsset::ReadDataAsync(const String& path, AssetLoadRequest& request)
+	{
+		return false;
+	}
 }
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::BitmapFontAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::BitmapFontAsset>);
 
 DECLARE_CLASS(o2::BitmapFontAsset);
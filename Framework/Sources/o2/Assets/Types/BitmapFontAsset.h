@@ -53,6 +53,9 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Returns false, font is created on main thread in LoadData
+		bool ReadDataAsync(const String& path, AssetLoadRequest& request) override;
+
 		friend class Assets;
 	};
 
@@ -76,6 +79,7 @@ CLASS_METHODS_META(o2::BitmapFontAsset)
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(bool, ReadDataAsync, const String&, AssetLoadRequest&);
 }
 END_META;
 
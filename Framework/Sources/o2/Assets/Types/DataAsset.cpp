@@ -31,14 +31,26 @@ namespace o2
 		data.LoadFromFile(path);
 	}
 
+	bool DataAsset::ReadDataAsync(const String& path, AssetLoadRequest& request)
+	{
+		LoadData(path);
+		return true;
+	}
+
+	void DataAsset::CompleteAsyncLoading(AssetLoadRequest& request)
+	{}
+
 	void DataAsset::SaveData(const String& path) const
 	{
 		data.SaveToFile(path);
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::DataAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::DataAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::DataAsset>);
 
 DECLARE_CLASS(o2::DataAsset);
@@ -44,6 +44,12 @@ namespace o2
 		// Saves data
 		void SaveData(const String& path) const override;
 
+		// Reads asset data on worker thread. Data is loaded completely, it doesn't depend on other objects
+		bool ReadDataAsync(const String& path, AssetLoadRequest& request) override;
+
+		// Does nothing, data is loaded in ReadDataAsync
+		void CompleteAsyncLoading(AssetLoadRequest& request) override;
+
 		friend class Assets;
 	};
 
@@ -69,5 +75,7 @@ CLASS_METHODS_META(o2::DataAsset)
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(bool, ReadDataAsync, const String&, AssetLoadRequest&);
+	PROTECTED_FUNCTION(void, CompleteAsyncLoading, AssetLoadRequest&);
 }
 END_META;
@@ -38,8 +38,11 @@ namespace o2
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::FolderAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::FolderAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::FolderAsset>);
 
 DECLARE_CLASS(o2::FolderAsset);
@@ -31,6 +31,7 @@ namespace o2
 		return *this;
 	}
 }
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::FontAsset>);
 
 DECLARE_CLASS(o2::FontAsset);
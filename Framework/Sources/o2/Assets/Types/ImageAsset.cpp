@@ -2,7 +2,9 @@
 #include "ImageAsset.h"
 
 #include "o2/Assets/Types/AtlasAsset.h"
+#include "o2/Assets/AssetLoadRequest.h"
 #include "o2/Assets/Assets.h"
+#include "o2/Render/Render.h"
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 
@@ -149,6 +151,24 @@ namespace o2
 			mBitmap->Save(GetFullPath(), Bitmap::ImageType::Png);
 	}
 
+	void ImageAsset::LoadResourcesAsync(AssetLoadRequest& request, const Function<void()>& onLoaded)
+	{
+		if (GetAtlas() == UID::empty)
+		{
+			onLoaded();
+			return;
+		}
+
+		// onLoaded keeps request alive until texture is loaded
+		AssetLoadRequest* requestPtr = &request;
+		o2Render.LoadAtlasTextureAsync(GetAtlas(), mAtlasPage, [=](const TextureRef& texture) {
+			if (texture)
+				requestPtr->textures.Add(texture);
+
+			onLoaded();
+		}, [=]() { return requestPtr->GetState() == AssetLoadRequest::State::Canceled; });
+	}
+
 	void ImageAsset::LoadBitmap()
 	{
 		String assetFullPath = GetFullPath();
@@ -172,7 +192,9 @@ namespace o2
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::ImageAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::ImageAsset>);
 
 DECLARE_CLASS(o2::ImageAsset);
@@ -141,6 +141,9 @@ namespace o2
 		// Saves data
 		void SaveData(const String& path) const override;
 
+		// Loads atlas page texture asynchronously: it's decoded on worker thread and uploaded on main thread
+		void LoadResourcesAsync(AssetLoadRequest& request, const Function<void()>& onLoaded) override;
+
 		// Load bitmap
 		void LoadBitmap();
 
@@ -193,6 +196,7 @@ CLASS_METHODS_META(o2::ImageAsset)
 	PUBLIC_FUNCTION(Meta*, GetMeta);
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, LoadResourcesAsync, AssetLoadRequest&, const Function<void()>&);
 	PROTECTED_FUNCTION(void, LoadBitmap);
 }
 END_META;
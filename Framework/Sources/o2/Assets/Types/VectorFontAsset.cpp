@@ -111,6 +111,11 @@ namespace o2
 	void VectorFontAsset::SaveData(const String& path) const
 	{}
 
+	bool VectorFontAsset::ReadDataAsync(const String& path, AssetLoadRequest& request)
+	{
+		return false;
+	}
+
 	void VectorFontAsset::UpdateFontEffects()
 	{
 		Vector<VectorFont::Effect*> clonedEffects;;
@@ -124,7 +129,9 @@ namespace o2
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::VectorFontAsset>);
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::VectorFontAsset>);
 
 DECLARE_CLASS(o2::VectorFontAsset);
@@ -91,6 +91,9 @@ namespace o2
 		// Saves asset data, using DataValue and serialization
 		void SaveData(const String& path) const override;
 
+		// Returns false, font is created on main thread in LoadData
+		bool ReadDataAsync(const String& path, AssetLoadRequest& request) override;
+
 		// Updates font effects in 
 		void UpdateFontEffects();
 
@@ -128,6 +131,7 @@ CLASS_METHODS_META(o2::VectorFontAsset)
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(bool, ReadDataAsync, const String&, AssetLoadRequest&);
 	PROTECTED_FUNCTION(void, UpdateFontEffects);
 }
 END_META;
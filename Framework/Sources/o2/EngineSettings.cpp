@@ -7,6 +7,8 @@ o2::Platform GetEnginePlatform()
 	return o2::Platform::Windows;
 #elif defined PLATFORM_ANDROID
 	return o2::Platform::Android;
+#elif defined PLATFORM_LINUX
+	return o2::Platform::Linux;
 #endif
 }
 
@@ -47,9 +49,14 @@ bool IsReleaseBuild()
 #endif
 }
 
+bool IsRenderThreadEnabled()
+{
+	return RENDER_THREAD_ENABLED;
+}
+
 bool IsAssetsPrebuildEnabled()
 {
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS || defined PLATFORM_LINUX
 	return true;
 #else
 	return false;
@@ -67,6 +74,8 @@ const char* GetBuiltAssetsPath()
 	return "BuiltAssets/Windows/Data/";
 #elif defined PLATFORM_ANDROID
 	return "AndroidAssets/BuiltAssets/";
+#elif defined PLATFORM_LINUX
+	return "BuiltAssets/Linux/Data/";
 #endif
 }
 
@@ -81,6 +90,8 @@ const char* GetBuiltAssetsTreePath()
 	return "BuiltAssets/Windows/Data.json";
 #elif defined PLATFORM_ANDROID
 	return "AndroidAssets/AssetsTree.json";
+#elif defined PLATFORM_LINUX
+	return "BuiltAssets/Linux/Data.json";
 #endif
 }
 
@@ -15,6 +15,16 @@
 #define RENDER_DEBUG false
 #endif
 
+// Enables render thread. When it is false, render commands are executed synchronously on main thread
+#ifndef RENDER_THREAD_ENABLED
+#define RENDER_THREAD_ENABLED true
+#endif
+
+// Enables profiler markers. Markers are recorded only while profiler is capturing
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED true
+#endif
+
 // Describes that engine running as editor
 #define IS_EDITOR true
 
@@ -36,6 +46,9 @@ bool IsDevMode();
 // Is build release
 bool IsReleaseBuild();
 
+// Enables render thread: frame's render commands are executed on it while next frame is updating
+bool IsRenderThreadEnabled();
+
 // ----------------------------
 // Assets configuration section
 // ----------------------------
@@ -7,6 +7,7 @@
 
 namespace o2
 {
+	class DragableObject;
 	class IDrawable;
 
 	// -----------------------
@@ -36,6 +37,10 @@ namespace o2
 		// Returns true if point is in this object
 		virtual bool IsUnderPoint(const Vec2F& point);
 
+		// Returns bounds of area where listener can be under point. Returns false when bounds are unknown,
+		// then listener is checked at any point of scissor rect
+		virtual bool GetCursorAreaBounds(RectF& bounds) const;
+
 		// Returns is listener scrollable
 		virtual bool IsScrollable() const;
 
@@ -117,6 +122,8 @@ namespace o2
 
 		float mLastPressedTime = -1.0f; // Last cursor pressed time
 
+		DragableObject* mDragableObject = nullptr; // This listener as dragable object, set by DragableObject. Used instead of dynamic casting in hit testing
+
 	protected:
 		// It is called when listener becomes interactable
 		virtual void OnBecomeInteractable() {}
@@ -6,6 +6,10 @@
 
 namespace o2
 {
+	static const int   hitTestGridMaxSize = 32;        // Maximum hit test grid cells count by axis
+	static const float hitTestGridMinCellSize = 32.0f; // Minimal hit test grid cell size
+	static const float hitTestBoundsMargin = 1.0f;     // Listener's bounds margin, points on bounds border can be under listener
+
 	void CursorAreaEventListenersLayer::OnBeginDraw()
 	{
 		viewPortBasis = o2Render.GetCamera().GetBasis();
@@ -44,6 +48,8 @@ namespace o2
 		mLastUnderCursorListeners = mUnderCursorListeners;
 		mUnderCursorListeners.Clear();
 
+		UpdateHitTestGrid();
+
 		if (mEnabled)
 		{
 			for (const Input::Cursor& cursor : o2Input.GetCursors())
@@ -97,6 +103,7 @@ namespace o2
 	{
 		cursorEventAreaListeners.Clear();
 		mDragListeners.Clear();
+		mListenersBounds.Clear();
 	}
 
 	void CursorAreaEventListenersLayer::BreakCursorEvent()
@@ -116,6 +123,7 @@ namespace o2
 	void CursorAreaEventListenersLayer::UnregCursorAreaListener(CursorAreaEventsListener* listener)
 	{
 		cursorEventAreaListeners.RemoveAll([&](auto x) { return x == listener; });
+		mListenersBounds.RemoveAll([&](auto& x) { return x.listener == listener; });
 		mRightButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 		mMiddleButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 
@@ -144,6 +152,12 @@ namespace o2
 		return drawnTransform.IsPointInside(point);
 	}
 
+	bool CursorAreaEventListenersLayer::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = drawnTransform.AABB();
+		return true;
+	}
+
 	void CursorAreaEventListenersLayer::OnCursorEnter(const Input::Cursor& cursor)
 	{
 		mEnabled = true;
@@ -163,17 +177,123 @@ namespace o2
 		return localCursor;
 	}
 
+	void CursorAreaEventListenersLayer::UpdateHitTestGrid()
+	{
+		for (auto& cell : mHitTestGrid)
+			cell.Clear();
+
+		mListenersBounds.Resize(cursorEventAreaListeners.Count());
+
+		Vector<RectF> hitRects;
+		hitRects.Reserve(cursorEventAreaListeners.Count());
+		bool gridRectInitialized = false;
+
+		for (int i = 0; i < cursorEventAreaListeners.Count(); i++)
+		{
+			auto listener = cursorEventAreaListeners[i];
+			auto& listenerBounds = mListenersBounds[i];
+
+			listenerBounds.listener = listener;
+			listenerBounds.hasBounds = listener->GetCursorAreaBounds(listenerBounds.bounds);
+
+			RectF hitRect = listener->mScissorRect;
+			if (listenerBounds.hasBounds)
+			{
+				listenerBounds.bounds.left -= hitTestBoundsMargin;
+				listenerBounds.bounds.bottom -= hitTestBoundsMargin;
+				listenerBounds.bounds.right += hitTestBoundsMargin;
+				listenerBounds.bounds.top += hitTestBoundsMargin;
+
+				if (!hitRect.IsIntersects(listenerBounds.bounds))
+				{
+					hitRects.Add(RectF());
+					continue;
+				}
+
+				hitRect = hitRect.GetIntersection(listenerBounds.bounds);
+			}
+
+			hitRects.Add(hitRect);
+
+			mHitTestGridRect = gridRectInitialized ? mHitTestGridRect.Expand(hitRect) : hitRect;
+			gridRectInitialized = true;
+		}
+
+		if (!gridRectInitialized)
+		{
+			mHitTestGridSize = Vec2I();
+			return;
+		}
+
+		mHitTestGridCellSize.x = Math::Max(mHitTestGridRect.Width()/hitTestGridMaxSize, hitTestGridMinCellSize);
+		mHitTestGridCellSize.y = Math::Max(mHitTestGridRect.Height()/hitTestGridMaxSize, hitTestGridMinCellSize);
+
+		mHitTestGridSize.x = Math::Clamp(Math::CeilToInt(mHitTestGridRect.Width()/mHitTestGridCellSize.x), 1, hitTestGridMaxSize);
+		mHitTestGridSize.y = Math::Clamp(Math::CeilToInt(mHitTestGridRect.Height()/mHitTestGridCellSize.y), 1, hitTestGridMaxSize);
+
+		if (mHitTestGrid.Count() < mHitTestGridSize.x*mHitTestGridSize.y)
+			mHitTestGrid.Resize(mHitTestGridSize.x*mHitTestGridSize.y);
+
+		for (int i = 0; i < hitRects.Count(); i++)
+		{
+			const RectF& hitRect = hitRects[i];
+			if (hitRect.IsZero())
+				continue;
+
+			int left = Math::Clamp(Math::FloorToInt((hitRect.left - mHitTestGridRect.left)/mHitTestGridCellSize.x), 0, mHitTestGridSize.x - 1);
+			int right = Math::Clamp(Math::FloorToInt((hitRect.right - mHitTestGridRect.left)/mHitTestGridCellSize.x), 0, mHitTestGridSize.x - 1);
+			int bottom = Math::Clamp(Math::FloorToInt((hitRect.bottom - mHitTestGridRect.bottom)/mHitTestGridCellSize.y), 0, mHitTestGridSize.y - 1);
+			int top = Math::Clamp(Math::FloorToInt((hitRect.top - mHitTestGridRect.bottom)/mHitTestGridCellSize.y), 0, mHitTestGridSize.y - 1);
+
+			for (int y = bottom; y <= top; y++)
+			{
+				for (int x = left; x <= right; x++)
+					mHitTestGrid[y*mHitTestGridSize.x + x].Add(i);
+			}
+		}
+	}
+
+	int CursorAreaEventListenersLayer::GetHitTestGridCell(const Vec2F& point) const
+	{
+		if (mHitTestGridSize.x == 0 || mHitTestGridSize.y == 0)
+			return -1;
+
+		if (point.x < mHitTestGridRect.left || point.x > mHitTestGridRect.right ||
+			point.y < mHitTestGridRect.bottom || point.y > mHitTestGridRect.top)
+		{
+			return -1;
+		}
+
+		int x = Math::Clamp(Math::FloorToInt((point.x - mHitTestGridRect.left)/mHitTestGridCellSize.x), 0, mHitTestGridSize.x - 1);
+		int y = Math::Clamp(Math::FloorToInt((point.y - mHitTestGridRect.bottom)/mHitTestGridCellSize.y), 0, mHitTestGridSize.y - 1);
+
+		return y*mHitTestGridSize.x + x;
+	}
+
+	bool CursorAreaEventListenersLayer::IsOutsideListener(const ListenerBounds& listenerBounds, const Vec2F& point) const
+	{
+		if (listenerBounds.hasBounds && !listenerBounds.bounds.IsInside(point))
+			return true;
+
+		return !listenerBounds.listener->IsUnderPoint(point);
+	}
+
 	void CursorAreaEventListenersLayer::ProcessCursorTracing(const Input::Cursor& cursor)
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
 
-		for (auto listener : cursorEventAreaListeners)
+		int cell = GetHitTestGridCell(localCursor.position);
+		if (cell < 0)
+			return;
+
+		for (int idx : mHitTestGrid[cell])
 		{
-			if (!listener->IsUnderPoint(localCursor.position) || !listener->mScissorRect.IsInside(localCursor.position))
+			auto listener = mListenersBounds[idx].listener;
+
+			if (!listener->mScissorRect.IsInside(localCursor.position) || !listener->IsUnderPoint(localCursor.position))
 				continue;
 
-			auto drag = dynamic_cast<DragableObject*>(listener);
-			if (drag && drag->IsDragging())
+			if (listener->mDragableObject && listener->mDragableObject->IsDragging())
 				continue;
 
 			if (!mUnderCursorListeners.ContainsKey(localCursor.id))
@@ -216,10 +336,10 @@ namespace o2
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
 
-		for (auto listener : cursorEventAreaListeners)
+		for (auto& listenerBounds : mListenersBounds)
 		{
-			if (!listener->IsUnderPoint(localCursor.position))
-				listener->OnCursorPressedOutside(localCursor);
+			if (IsOutsideListener(listenerBounds, localCursor.position))
+				listenerBounds.listener->OnCursorPressedOutside(localCursor);
 		}
 
 		if (!mUnderCursorListeners.ContainsKey(localCursor.id))
@@ -285,10 +405,10 @@ namespace o2
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
 
-		for (auto listener : cursorEventAreaListeners)
+		for (auto& listenerBounds : mListenersBounds)
 		{
-			if (!listener->IsUnderPoint(localCursor.position))
-				listener->OnCursorReleasedOutside(localCursor);
+			if (IsOutsideListener(listenerBounds, localCursor.position))
+				listenerBounds.listener->OnCursorReleasedOutside(localCursor);
 		}
 
 		if (mPressedListeners.ContainsKey(localCursor.id))
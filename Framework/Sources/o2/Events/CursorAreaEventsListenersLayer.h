@@ -1,5 +1,6 @@
 #pragma once
 #include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Types/Containers/UnorderedMap.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Events/CursorAreaEventsListener.h"
 
@@ -53,20 +54,40 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns bounds of drawn layer
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
+	private:
+		// -------------------------------------------------------------------------------------
+		// Listener's hit test bounds. Own bounds are used to skip points checks outside of them
+		// -------------------------------------------------------------------------------------
+		struct ListenerBounds
+		{
+			CursorAreaEventsListener* listener;          // Listener
+			RectF                     bounds;            // Listener's own bounds, valid when hasBounds is true
+			bool                      hasBounds = false; // True when listener has own bounds
+		};
+
 	private:
 		bool mEnabled = false;
 
 		Basis mLocalToWorldTransform = Basis::Identity();
 
-		Map<CursorId, Vector<CursorAreaEventsListener*>> mPressedListeners;             // Pressed listeners for all pressed cursors
-		Vector<CursorAreaEventsListener*>                mRightButtonPressedListeners;  // Right mouse button pressed listener
-		Vector<CursorAreaEventsListener*>                mMiddleButtonPressedListeners; // Middle mouse button pressed listener
+		UnorderedMap<CursorId, Vector<CursorAreaEventsListener*>> mPressedListeners;             // Pressed listeners for all pressed cursors
+		Vector<CursorAreaEventsListener*>                         mRightButtonPressedListeners;  // Right mouse button pressed listener
+		Vector<CursorAreaEventsListener*>                         mMiddleButtonPressedListeners; // Middle mouse button pressed listener
 
-		Map<CursorId, Vector<CursorAreaEventsListener*>> mUnderCursorListeners;     // Under cursor listeners for each cursor
-		Map<CursorId, Vector<CursorAreaEventsListener*>> mLastUnderCursorListeners; // Under cursor listeners for each cursor on last frame
+		UnorderedMap<CursorId, Vector<CursorAreaEventsListener*>> mUnderCursorListeners;     // Under cursor listeners for each cursor
+		UnorderedMap<CursorId, Vector<CursorAreaEventsListener*>> mLastUnderCursorListeners; // Under cursor listeners for each cursor on last frame
 
 		Vector<DragableObject*> mDragListeners; // Drag events listeners
 
+		Vector<ListenerBounds> mListenersBounds;     // Hit test bounds of drawn listeners, in order of cursorEventAreaListeners
+		Vector<Vector<int>>    mHitTestGrid;         // Uniform grid over listeners hit areas. Each cell contains listeners indices in order of priority
+		RectF                  mHitTestGridRect;     // Hit test grid area
+		Vec2I                  mHitTestGridSize;     // Hit test grid cells count by axes
+		Vec2F                  mHitTestGridCellSize; // Hit test grid cell size
+
 	private:
 		// It is called when cursor enters this object
 		void OnCursorEnter(const Input::Cursor& cursor) override;
@@ -77,6 +98,15 @@ namespace o2
 		// Converts cursor to local coordinates
 		Input::Cursor ConvertLocalCursor(const Input::Cursor& cursor) const;
 
+		// Collects listeners bounds and builds hit test grid
+		void UpdateHitTestGrid();
+
+		// Returns hit test grid cell index by point, -1 when point is outside of grid
+		int GetHitTestGridCell(const Vec2F& point) const;
+
+		// Returns true when point is outside of listener's own bounds or listener isn't under point
+		bool IsOutsideListener(const ListenerBounds& listenerBounds, const Vec2F& point) const;
+
 		// processes cursor tracing for cursor
 		void ProcessCursorTracing(const Input::Cursor& cursor);
 
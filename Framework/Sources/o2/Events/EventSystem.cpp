@@ -9,6 +9,7 @@
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Editor/DragAndDrop.h"
 #include "o2/Utils/Editor/EditorScope.h"
 #include "o2/Utils/System/Time/Time.h"
@@ -40,6 +41,8 @@ namespace o2
 
 	void EventSystem::Update()
 	{
+		PROFILE_SCOPE("EventSystem::Update");
+
 		for (auto layer : mCursorAreaEventsListenersLayers)
 			layer->Update();
 
@@ -156,6 +159,8 @@ namespace o2
 
 	void EventSystem::PostUpdate()
 	{
+		PROFILE_SCOPE("EventSystem::PostUpdate");
+
 		for (auto layer : mCursorAreaEventsListenersLayers)
 			layer->PostUpdate();
 
@@ -280,6 +285,12 @@ namespace o2
 		if (!listener->IsListeningEvents())
 			return;
 
+		if (mInstance->mDrawnListenersRecording)
+		{
+			mInstance->mDrawnListenersRecording->listeners.Add({ listener, listener->mScissorRect });
+			return;
+		}
+
 		mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners.Add(listener);
 	}
 
@@ -287,6 +298,9 @@ namespace o2
 	{
 		for (auto layer : mInstance->mCursorAreaEventsListenersLayers)
 			layer->UnregCursorAreaListener(listener);
+
+		for (auto record : mInstance->mDrawnListenersRecords)
+			record->listeners.RemoveAll([&](auto& x) { return x.listener == listener; });
 	}
 
 	void EventSystem::RegCursorListener(CursorEventsListener* listener)
@@ -312,8 +326,13 @@ namespace o2
 		if (!IsSingletonInitialzed())
 			return;
 
-		if (mInstance)
-			mInstance->mCurrentCursorAreaEventsLayer->mDragListeners.Add(listener);
+		if (mInstance->mDrawnListenersRecording)
+		{
+			mInstance->mDrawnListenersRecording->dragListeners.Add(listener);
+			return;
+		}
+
+		mInstance->mCurrentCursorAreaEventsLayer->mDragListeners.Add(listener);
 	}
 
 	void EventSystem::UnregDragListener(DragableObject* listener)
@@ -322,6 +341,9 @@ namespace o2
 		{
 			for (auto layer : mInstance->mCursorAreaEventsListenersLayers)
 				layer->UnregDragListener(listener);
+
+			for (auto record : mInstance->mDrawnListenersRecords)
+				record->dragListeners.Remove(listener);
 		}
 	}
 
@@ -354,4 +376,55 @@ namespace o2
 		if (mInstance)
 			mInstance->mApplicationListeners.Remove(listener);
 	}
+
+	void EventSystem::BeginDrawnListenersRecording(DrawnListenersRecord* record)
+	{
+		if (!IsSingletonInitialzed())
+			return;
+
+		record->listeners.Clear();
+		record->dragListeners.Clear();
+
+		if (!mInstance->mDrawnListenersRecords.Contains(record))
+			mInstance->mDrawnListenersRecords.Add(record);
+
+		mInstance->mDrawnListenersRecording = record;
+	}
+
+	void EventSystem::EndDrawnListenersRecording()
+	{
+		if (mInstance)
+			mInstance->mDrawnListenersRecording = nullptr;
+	}
+
+	void EventSystem::DrawnRecordedListeners(const DrawnListenersRecord& record)
+	{
+		if (!IsSingletonInitialzed())
+			return;
+
+		RectF scissorRect = o2Render.GetResScissorRect();
+
+		for (auto& drawnListener : record.listeners)
+		{
+			if (!drawnListener.scissorRect.IsIntersects(scissorRect))
+				continue;
+
+			drawnListener.listener->mScissorRect = drawnListener.scissorRect.GetIntersection(scissorRect);
+			DrawnCursorAreaListener(drawnListener.listener);
+		}
+
+		for (auto dragListener : record.dragListeners)
+			RegDragListener(dragListener);
+	}
+
+	void EventSystem::ReleaseDrawnListenersRecord(DrawnListenersRecord* record)
+	{
+		if (mInstance)
+		{
+			mInstance->mDrawnListenersRecords.Remove(record);
+
+			if (mInstance->mDrawnListenersRecording == record)
+				mInstance->mDrawnListenersRecording = nullptr;
+		}
+	}
 }
@@ -18,6 +18,22 @@ namespace o2
 	class KeyboardEventsListener;
 	class ShortcutKeysListenersManager;
 
+	// ------------------------------------------------------------------------------------------------
+	// Drawn cursor area and drag listeners record. Used by cached drawings to register drawn listeners
+	// again without drawing
+	// ------------------------------------------------------------------------------------------------
+	struct DrawnListenersRecord
+	{
+		struct Listener
+		{
+			CursorAreaEventsListener* listener;    // Drawn listener
+			RectF                     scissorRect; // Scissor rect at drawing moment
+		};
+
+		Vector<Listener>        listeners;     // Drawn cursor area listeners in drawing order
+		Vector<DragableObject*> dragListeners; // Drawn drag listeners in drawing order
+	};
+
 	// -----------------------
 	// Event processing system
 	// -----------------------
@@ -92,6 +108,9 @@ namespace o2
 
 		ShortcutKeysListenersManager* mShortcutEventsManager; // Shortcut events manager
 
+		DrawnListenersRecord*         mDrawnListenersRecording = nullptr; // Current drawn listeners record. While recording listeners aren't registered in layer
+		Vector<DrawnListenersRecord*> mDrawnListenersRecords;             // Used drawn listeners records. Unregistered listeners are removed from them
+
 	protected:
 		// Sets current cursor area events listeners layer
 		static void SetCursorAreaEventsListenersLayer(CursorAreaEventListenersLayer* layer);
@@ -126,8 +145,21 @@ namespace o2
 		// Unregistering application events listener
 		static void UnregApplicationListener(ApplicationEventsListener* listener);
 
+		// Begins recording of drawn cursor area and drag listeners into record. Recorded listeners aren't registered in current layer
+		static void BeginDrawnListenersRecording(DrawnListenersRecord* record);
+
+		// Ends recording of drawn listeners
+		static void EndDrawnListenersRecording();
+
+		// Registers recorded listeners as drawn. Scissor rects of listeners are limited by current render scissor rect
+		static void DrawnRecordedListeners(const DrawnListenersRecord& record);
+
+		// Releases drawn listeners record. Must be called before record destruction
+		static void ReleaseDrawnListenersRecord(DrawnListenersRecord* record);
+
 		friend class Application;
 		friend class ApplicationEventsListener;
+		friend class CachedWidget;
 		friend class CursorAreaEventListenersLayer;
 		friend class CursorAreaEventsListener;
 		friend class CursorEventsListener;
@@ -139,9 +171,10 @@ namespace o2
 	template<typename _type /*= CursorAreaEventsListener*/>
 	_type* EventSystem::GetCursorListenerUnderCursor(CursorId cursorId) const
 	{
-		if (mUnderCursorListeners.ContainsKey(cursorId))
+		auto& underCursorListeners = mCursorAreaListenersBasicLayer.mUnderCursorListeners;
+		if (underCursorListeners.ContainsKey(cursorId))
 		{
-			for (auto listener : mUnderCursorListeners.Get(cursorId))
+			for (auto listener : underCursorListeners.Get(cursorId))
 			{
 				if (auto tListener = dynamic_cast<_type*>(listener))
 					return tListener;
@@ -246,6 +246,9 @@ namespace o2
 		mTrianglesCount = 0;
 		mFrameTrianglesCount = 0;
 		mDIPCount = 0;
+		mUnsortedDIPCount = 0;
+		mLastRecordedTexture = nullptr;
+		mLastRecordedPrimitiveType = PrimitiveType::Polygon;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
 		mDrawingDepth = 0.0f;
@@ -266,6 +269,8 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		SubmitDrawCommands();
+
 		if (mLastDrawVertex < 1)
 			return;
 
@@ -314,6 +319,11 @@ namespace o2
 		GL_CHECK_ERROR();
 	}
 
+	void Render::Flush()
+	{
+		DrawPrimitives();
+	}
+
 	void mtxMultiply(float* ret, const float* lhs, const float* rhs)
 	{
 		// [ 0 4  8 12 ]   [ 0 4  8 12 ]
@@ -521,31 +531,23 @@ namespace o2
 		}
 	}
 
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::SubmitBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							  UInt16* indexes, UInt elementsCount, Texture* texture)
 	{
-		if (!mReady)
-			return;
-
-		mDrawingDepth += 1.0f;
-
-		if (mClippingEverything)
-			return;
-
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount*2;
 		else
 			indexesCount = elementsCount*3;
 
-		if (mLastDrawTexture != texture.mTexture ||
+		if (mLastDrawTexture != texture ||
 			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
 			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
 			mCurrentPrimitiveType != primitiveType)
 		{
 			DrawPrimitives();
 
-			mLastDrawTexture = texture.mTexture;
+			mLastDrawTexture = texture;
 			mCurrentPrimitiveType = primitiveType;
 
 			if (mLastDrawTexture)
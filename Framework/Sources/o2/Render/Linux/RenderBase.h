@@ -0,0 +1,56 @@
+#pragma once
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Texture;
+
+	// --------------------------------------------------------------------------------------------------------
+	// Linux headless render base fields. There is no graphics device: batches are built as on other platforms,
+	// but instead of submitting to device they are counted and optionally recorded. Render targets and
+	// textures keep pixels in memory
+	// --------------------------------------------------------------------------------------------------------
+	class RenderBase
+	{
+	public:
+		// -----------------------------
+		// Draw call, recorded by render
+		// -----------------------------
+		struct RecordedDrawCall
+		{
+			PrimitiveType primitiveType; // Type of drawing primitives
+			Texture*      texture;       // Drawing texture
+			Texture*      renderTarget;  // Render target texture. Null when drawing into frame
+			UInt          verticesCount; // Count of vertices
+			UInt          indexesCount;  // Count of indexes
+			RectI         scissorRect;   // Result scissor rectangle
+			bool          stencilTest;   // Is stencil test enabled
+		};
+
+	public:
+		// Enables or disables draw calls recording. Recorded draw calls are cleared at frame beginning
+		void SetDrawCallsRecordingEnabled(bool enabled);
+
+		// Returns is draw calls recording enabled
+		bool IsDrawCallsRecordingEnabled() const;
+
+		// Returns draw calls, recorded at current or last frame
+		const Vector<RecordedDrawCall>& GetRecordedDrawCalls() const;
+
+	protected:
+		UInt8*  mVertexData = nullptr;      // Vertex data buffer
+		UInt16* mVertexIndexData = nullptr; // Index data buffer
+		UInt    mVertexBufferSize = 6000;   // Maximum size of vertex buffer
+		UInt    mIndexBufferSize = 6000*3;  // Maximum size of index buffer
+
+		bool                     mDrawCallsRecording = false; // Is draw calls recording enabled
+		Vector<RecordedDrawCall> mRecordedDrawCalls;          // Draw calls, recorded at current frame
+	};
+};
+
+#endif // PLATFORM_LINUX
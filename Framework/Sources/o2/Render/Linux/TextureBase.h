@@ -0,0 +1,19 @@
+#pragma once
+
+#ifdef PLATFORM_LINUX
+
+namespace o2
+{
+	class Bitmap;
+
+	class TextureBase
+	{
+		friend class Render;
+		friend class VectorFont;
+
+	protected:
+		Bitmap* mPixels = nullptr; // Texture pixels in memory
+	};
+}
+
+#endif // PLATFORM_LINUX
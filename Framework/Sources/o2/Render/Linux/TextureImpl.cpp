@@ -0,0 +1,85 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+
+namespace o2
+{
+	Texture::~Texture()
+	{
+		o2Render.mTextures.Remove(this);
+
+		delete mPixels;
+		mPixels = nullptr;
+	}
+
+	void Texture::Create(const Vec2I& size, PixelFormat format /*= Format::R8G8B8A8*/, Usage usage /*= Usage::Default*/)
+	{
+		delete mPixels;
+
+		mFormat = format;
+		mUsage = usage;
+		mSize = size;
+
+		mPixels = mnew Bitmap(format, size);
+		mPixels->Fill(Color4(0, 0, 0, 0));
+
+		mReady = true;
+	}
+
+	void Texture::Create(Bitmap* bitmap)
+	{
+		delete mPixels;
+
+		mFormat = bitmap->GetFormat();
+		mUsage = Usage::Default;
+		mSize = bitmap->GetSize();
+		mFileName = bitmap->GetFilename();
+
+		mPixels = mnew Bitmap(*bitmap);
+
+		mReady = true;
+	}
+
+	void Texture::SetData(Bitmap* bitmap)
+	{
+		delete mPixels;
+
+		mSize = bitmap->GetSize();
+		mPixels = mnew Bitmap(*bitmap);
+	}
+
+	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
+	{
+		if (mPixels)
+			mPixels->CopyImage(bitmap, offset);
+	}
+
+	void Texture::Copy(const Texture& from, const RectI& rect)
+	{
+		if (mPixels && from.mPixels)
+			mPixels->CopyImage(from.mPixels, Vec2I(), rect);
+	}
+
+	Bitmap* Texture::GetData()
+	{
+		if (mPixels)
+			return mnew Bitmap(*mPixels);
+
+		return mnew Bitmap(mFormat, mSize);
+	}
+
+	void Texture::SetFilter(Filter filter)
+	{
+		mFilter = filter;
+	}
+
+	Texture::Filter Texture::GetFilter() const
+	{
+		return mFilter;
+	}
+}
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,250 @@
+#include "o2/stdafx.h"
+#include "Particle.h"
+
+#include "o2/Utils/Math/Math.h"
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define PARTICLES_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PARTICLES_NEON
+#include <arm_neon.h>
+#endif
+
+namespace o2
+{
+	int ParticlesBuffer::Count() const
+	{
+		return time.Count();
+	}
+
+	void ParticlesBuffer::Reserve(int count)
+	{
+		positionX.Reserve(count);
+		positionY.Reserve(count);
+		velocityX.Reserve(count);
+		velocityY.Reserve(count);
+		angle.Reserve(count);
+		angleSpeed.Reserve(count);
+		sizeX.Reserve(count);
+		sizeY.Reserve(count);
+		time.Reserve(count);
+		color.Reserve(count);
+	}
+
+	int ParticlesBuffer::Add(const Particle& particle)
+	{
+		positionX.Add(particle.position.x);
+		positionY.Add(particle.position.y);
+		velocityX.Add(particle.velocity.x);
+		velocityY.Add(particle.velocity.y);
+		angle.Add(particle.angle);
+		angleSpeed.Add(particle.angleSpeed);
+		sizeX.Add(particle.size.x);
+		sizeY.Add(particle.size.y);
+		time.Add(particle.time);
+		color.Add(particle.color);
+
+		return time.Count() - 1;
+	}
+
+	Particle ParticlesBuffer::Get(int idx) const
+	{
+		Particle res;
+		res.position.Set(positionX[idx], positionY[idx]);
+		res.velocity.Set(velocityX[idx], velocityY[idx]);
+		res.angle = angle[idx];
+		res.angleSpeed = angleSpeed[idx];
+		res.size.Set(sizeX[idx], sizeY[idx]);
+		res.time = time[idx];
+		res.color = color[idx];
+		return res;
+	}
+
+	void ParticlesBuffer::Set(int idx, const Particle& particle)
+	{
+		positionX[idx] = particle.position.x;
+		positionY[idx] = particle.position.y;
+		velocityX[idx] = particle.velocity.x;
+		velocityY[idx] = particle.velocity.y;
+		angle[idx] = particle.angle;
+		angleSpeed[idx] = particle.angleSpeed;
+		sizeX[idx] = particle.size.x;
+		sizeY[idx] = particle.size.y;
+		time[idx] = particle.time;
+		color[idx] = particle.color;
+	}
+
+	void ParticlesBuffer::Truncate(int count)
+	{
+		if (count >= Count())
+			return;
+
+		positionX.resize(count);
+		positionY.resize(count);
+		velocityX.resize(count);
+		velocityY.resize(count);
+		angle.resize(count);
+		angleSpeed.resize(count);
+		sizeX.resize(count);
+		sizeY.resize(count);
+		time.resize(count);
+		color.resize(count);
+	}
+
+	void ParticlesBuffer::Clear()
+	{
+		Truncate(0);
+	}
+
+	void ParticlesBuffer::Integrate(float dt)
+	{
+		int count = Count();
+		if (count == 0)
+			return;
+
+		MultiplyAdd(positionX.Data(), velocityX.Data(), count, dt);
+		MultiplyAdd(positionY.Data(), velocityY.Data(), count, dt);
+		MultiplyAdd(angle.Data(), angleSpeed.Data(), count, dt);
+		AddScalar(time.Data(), count, -dt);
+	}
+
+	int ParticlesBuffer::RemoveDead()
+	{
+		int count = Count();
+		const float* timeData = time.Data();
+
+		// Search first dead particle, most of frames there are only few of them
+		int firstDead = 0;
+
+#if defined PARTICLES_SSE
+		__m128 zero = _mm_setzero_ps();
+		for (; firstDead + 4 <= count; firstDead += 4)
+		{
+			if (_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(timeData + firstDead), zero)) != 0)
+				break;
+		}
+#endif
+
+		while (firstDead < count && timeData[firstDead] >= 0)
+			firstDead++;
+
+		if (firstDead == count)
+			return 0;
+
+		int alive = firstDead;
+		for (int i = firstDead + 1; i < count; i++)
+		{
+			if (timeData[i] < 0)
+				continue;
+
+			positionX[alive] = positionX[i];
+			positionY[alive] = positionY[i];
+			velocityX[alive] = velocityX[i];
+			velocityY[alive] = velocityY[i];
+			angle[alive] = angle[i];
+			angleSpeed[alive] = angleSpeed[i];
+			sizeX[alive] = sizeX[i];
+			sizeY[alive] = sizeY[i];
+			time[alive] = time[i];
+			color[alive] = color[i];
+			alive++;
+		}
+
+		Truncate(alive);
+		return count - alive;
+	}
+
+	void ParticlesBuffer::AddScalar(float* data, int count, float value)
+	{
+		int i = 0;
+
+#if defined PARTICLES_SSE
+		__m128 v = _mm_set1_ps(value);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(data + i, _mm_add_ps(_mm_loadu_ps(data + i), v));
+#elif defined PARTICLES_NEON
+		float32x4_t v = vdupq_n_f32(value);
+		for (; i + 4 <= count; i += 4)
+			vst1q_f32(data + i, vaddq_f32(vld1q_f32(data + i), v));
+#endif
+
+		for (; i < count; i++)
+			data[i] += value;
+	}
+
+	void ParticlesBuffer::MultiplyAdd(float* data, const float* src, int count, float coef)
+	{
+		int i = 0;
+
+#if defined PARTICLES_SSE
+		__m128 c = _mm_set1_ps(coef);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(data + i, _mm_add_ps(_mm_loadu_ps(data + i), _mm_mul_ps(_mm_loadu_ps(src + i), c)));
+#elif defined PARTICLES_NEON
+		float32x4_t c = vdupq_n_f32(coef);
+		for (; i + 4 <= count; i += 4)
+			vst1q_f32(data + i, vmlaq_f32(vld1q_f32(data + i), vld1q_f32(src + i), c));
+#endif
+
+		for (; i < count; i++)
+			data[i] += src[i]*coef;
+	}
+
+	void ParticlesBuffer::CalculateQuadAxes(float* xAxisX, float* xAxisY, float* yAxisX, float* yAxisY) const
+	{
+		int count = Count();
+
+		// Sines and cosines are calculated by scalar code into output arrays, then scaled by vector code
+		for (int i = 0; i < count; i++)
+		{
+			xAxisX[i] = Math::Cos(angle[i]);
+			xAxisY[i] = Math::Sin(angle[i]);
+		}
+
+		const float* sizeXData = sizeX.data();
+		const float* sizeYData = sizeY.data();
+		int i = 0;
+
+#if defined PARTICLES_SSE
+		__m128 half = _mm_set1_ps(0.5f);
+		__m128 signMask = _mm_set1_ps(-0.0f);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 cs = _mm_loadu_ps(xAxisX + i);
+			__m128 sn = _mm_loadu_ps(xAxisY + i);
+			__m128 hx = _mm_mul_ps(_mm_loadu_ps(sizeXData + i), half);
+			__m128 hy = _mm_mul_ps(_mm_loadu_ps(sizeYData + i), half);
+
+			_mm_storeu_ps(xAxisX + i, _mm_mul_ps(cs, hx));
+			_mm_storeu_ps(xAxisY + i, _mm_mul_ps(sn, hx));
+			_mm_storeu_ps(yAxisX + i, _mm_xor_ps(_mm_mul_ps(sn, hy), signMask));
+			_mm_storeu_ps(yAxisY + i, _mm_mul_ps(cs, hy));
+		}
+#elif defined PARTICLES_NEON
+		for (; i + 4 <= count; i += 4)
+		{
+			float32x4_t cs = vld1q_f32(xAxisX + i);
+			float32x4_t sn = vld1q_f32(xAxisY + i);
+			float32x4_t hx = vmulq_n_f32(vld1q_f32(sizeXData + i), 0.5f);
+			float32x4_t hy = vmulq_n_f32(vld1q_f32(sizeYData + i), 0.5f);
+
+			vst1q_f32(xAxisX + i, vmulq_f32(cs, hx));
+			vst1q_f32(xAxisY + i, vmulq_f32(sn, hx));
+			vst1q_f32(yAxisX + i, vnegq_f32(vmulq_f32(sn, hy)));
+			vst1q_f32(yAxisY + i, vmulq_f32(cs, hy));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			float cs = xAxisX[i], sn = xAxisY[i];
+			float hx = sizeXData[i]*0.5f, hy = sizeYData[i]*0.5f;
+
+			xAxisX[i] = cs*hx;
+			xAxisY[i] = sn*hx;
+			yAxisX[i] = -sn*hy;
+			yAxisY[i] = cs*hy;
+		}
+	}
+}
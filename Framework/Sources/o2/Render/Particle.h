@@ -2,6 +2,7 @@
 
 #include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Math/Color.h"
+#include "o2/Utils/Types/Containers/Vector.h"
 
 namespace o2
 {
@@ -15,13 +16,68 @@ namespace o2
 		Vec2F  size;       // Size of particle
 		Color4 color;      // Particle's color
 		float  time;       // Estimate life time
-		bool   alive;      // Is particle alive
 
 		bool operator==(const Particle& other) const
 		{
-			return position == position && velocity == velocity && Math::Equals(angle, other.angle) &&
+			return position == other.position && velocity == other.velocity && Math::Equals(angle, other.angle) &&
 				Math::Equals(angleSpeed, other.angleSpeed) && Math::Equals(time, other.time) && size == other.size &&
-				color == other.color && alive == other.alive;
+				color == other.color;
 		}
 	};
+
+	// --------------------------------------------------------------------------------------------------
+	// Particles pool, stored as structure of arrays. Alive particles are packed densely in [0, Count()),
+	// so update kernels walk continuous arrays without checking dead slots
+	// --------------------------------------------------------------------------------------------------
+	class ParticlesBuffer
+	{
+	public:
+		Vector<float>  positionX;   // Particles centers x
+		Vector<float>  positionY;   // Particles centers y
+		Vector<float>  velocityX;   // Particles velocities x
+		Vector<float>  velocityY;   // Particles velocities y
+		Vector<float>  angle;       // Particles angles in radians
+		Vector<float>  angleSpeed;  // Particles angle speeds in radians/sec
+		Vector<float>  sizeX;       // Particles widths
+		Vector<float>  sizeY;       // Particles heights
+		Vector<float>  time;        // Particles estimate life times
+		Vector<Color4> color;       // Particles colors
+
+	public:
+		// Returns count of alive particles
+		int Count() const;
+
+		// Reserves arrays memory for count particles
+		void Reserve(int count);
+
+		// Adds particle to the end and returns it's index
+		int Add(const Particle& particle);
+
+		// Returns particle by index
+		Particle Get(int idx) const;
+
+		// Sets particle by index
+		void Set(int idx, const Particle& particle);
+
+		// Removes particles after count
+		void Truncate(int count);
+
+		// Removes all particles
+		void Clear();
+
+		// Moves and rotates particles, decreases life times
+		void Integrate(float dt);
+
+		// Removes particles with expired life time, keeping order of others. Returns count of removed particles
+		int RemoveDead();
+
+		// Adds value to each element of data: data[i] += value
+		static void AddScalar(float* data, int count, float value);
+
+		// Multiplies and adds arrays: data[i] += src[i]*coef
+		static void MultiplyAdd(float* data, const float* src, int count, float coef);
+
+		// Calculates particles quads half axes: xAxis = (cos, sin)*sizeX/2, yAxis = (-sin, cos)*sizeY/2
+		void CalculateQuadAxes(float* xAxisX, float* xAxisY, float* yAxisX, float* yAxisY) const;
+	};
 }
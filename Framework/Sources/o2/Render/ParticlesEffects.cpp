@@ -8,7 +8,7 @@ namespace o2
 	void ParticlesEffect::Update(float dt, ParticlesEmitter* emitter)
 	{}
 
-	Vector<Particle>& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
+	ParticlesBuffer& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
 	{
 		return emitter->mParticles;
 	}
@@ -16,8 +16,9 @@ namespace o2
 	void ParticlesGravityEffect::Update(float dt, ParticlesEmitter* emitter)
 	{
 		Vec2F v = gravity*dt;
-		for (auto& p : GetParticlesDirect(emitter))
-			p.velocity += v;
+		ParticlesBuffer& particles = GetParticlesDirect(emitter);
+		ParticlesBuffer::AddScalar(particles.velocityX.Data(), particles.Count(), v.x);
+		ParticlesBuffer::AddScalar(particles.velocityY.Data(), particles.Count(), v.y);
 	}
 }
 
@@ -16,7 +16,7 @@ namespace o2
 
 	public:
 		virtual void Update(float dt, ParticlesEmitter* emitter);
-		Vector<Particle>& GetParticlesDirect(ParticlesEmitter* emitter);
+		ParticlesBuffer& GetParticlesDirect(ParticlesEmitter* emitter);
 	};
 
 	class ParticlesGravityEffect : public ParticlesEffect
@@ -44,7 +44,7 @@ CLASS_METHODS_META(o2::ParticlesEffect)
 {
 
 	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
-	PUBLIC_FUNCTION(Vector<Particle>&, GetParticlesDirect, ParticlesEmitter*);
+	PUBLIC_FUNCTION(ParticlesBuffer&, GetParticlesDirect, ParticlesEmitter*);
 }
 END_META;
 
@@ -11,13 +11,13 @@ namespace o2
 		IRectDrawable()
 	{
 		mShape = mnew CircleParticlesEmitterShape();
-		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
 		mLastTransform = mTransform;
 	}
 
 	ParticlesEmitter::~ParticlesEmitter()
 	{
-		delete mParticlesMesh;
+		for (auto mesh : mParticlesMeshes)
+			delete mesh;
 
 		for (auto effect : mEffects)
 			delete effect;
@@ -40,8 +40,6 @@ namespace o2
 		emitParticlesSpeedRange(this), emitParticlesMoveDir(this), emitParticlesMoveDirRange(this), emitParticlesColorA(this), emitParticlesColorB(this),
 		image(this), shape(this)
 	{
-		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
-
 		for (auto effect : other.mEffects)
 			AddEffect(effect->CloneAs<ParticlesEffect>());
 
@@ -53,18 +51,7 @@ namespace o2
 		RemoveAllEffects();
 		delete mShape;
 
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (particle.alive)
-			{
-				mDeadParticles.Add(idx);
-				particle.alive = false;
-			}
-
-			idx++;
-		}
-		mNumAliveParticles = 0;
+		mParticles.Clear();
 
 		IRectDrawable::operator=(other);
 
@@ -104,9 +91,11 @@ namespace o2
 		mEmitParticlesColorA = other.mEmitParticlesColorA;
 		mEmitParticlesColorB = other.mEmitParticlesColorB;
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		// Meshes are created again for new particles limit and image
+		for (auto mesh : mParticlesMeshes)
+			delete mesh;
+
+		mParticlesMeshes.Clear();
 
 		mLastTransform = mTransform;
 
@@ -115,7 +104,11 @@ namespace o2
 
 	void ParticlesEmitter::Draw()
 	{
-		mParticlesMesh->Draw();
+		for (auto mesh : mParticlesMeshes)
+		{
+			if (mesh->polyCount > 0)
+				mesh->Draw();
+		}
 	}
 
 	void ParticlesEmitter::Update(float dt)
@@ -160,36 +153,27 @@ namespace o2
 		float halfAngleSpeedRange = mEmitParticlesAngleSpeedRange*0.5f;
 		while (mEmitTimeBuffer > particlesDelay)
 		{
-			if (mNumAliveParticles < mParticlesNumLimit)
+			if (mParticles.Count() < mParticlesNumLimit)
 			{
-				Particle* p;
-
-				if (mDeadParticles.IsEmpty())
-				{
-					mParticles.Add(Particle());
-					p = &mParticles.Last();
-				}
-				else p = &mParticles[mDeadParticles.PopBack()];
+				Particle p;
+				p.position = Local2WorldPoint(mShape->GetEmittinPoint());
+				p.angle = mEmitParticlesAngle + Math::Random(-halfAngleRange, halfAngleRange);
 
-				p->position = Local2WorldPoint(mShape->GetEmittinPoint());
-				p->angle = mEmitParticlesAngle + Math::Random(-halfAngleRange, halfAngleRange);
+				p.size.Set(mEmitParticlesSize.x + Math::Random(-halfSizeRange.x, halfSizeRange.x),
+						   mEmitParticlesSize.y + Math::Random(-halfSizeRange.y, halfSizeRange.y));
 
-				p->size.Set(mEmitParticlesSize.x + Math::Random(-halfSizeRange.x, halfSizeRange.x),
-							mEmitParticlesSize.y + Math::Random(-halfSizeRange.y, halfSizeRange.y));
-
-				p->velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + Math::Random(-halfDirRange, halfDirRange))*
+				p.velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + Math::Random(-halfDirRange, halfDirRange))*
 					(mEmitParticlesSpeed + Math::Random(-halfSpeedRange, halfSpeedRange));
 
-				p->angleSpeed = mEmitParticlesAngleSpeed + Math::Random(-halfAngleSpeedRange, halfAngleSpeedRange);
+				p.angleSpeed = mEmitParticlesAngleSpeed + Math::Random(-halfAngleSpeedRange, halfAngleSpeedRange);
 
-				p->color.r = Math::Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
-				p->color.g = Math::Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
-				p->color.b = Math::Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
-				p->color.a = Math::Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
-				p->time = mParticlesLifetime;
-				p->alive = true;
+				p.color.r = Math::Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
+				p.color.g = Math::Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
+				p.color.b = Math::Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
+				p.color.a = Math::Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
+				p.time = mParticlesLifetime;
 
-				mNumAliveParticles++;
+				mParticles.Add(p);
 			}
 
 			mEmitTimeBuffer -= particlesDelay;
@@ -207,44 +191,36 @@ namespace o2
 
 	void ParticlesEmitter::UpdateParticles(float dt)
 	{
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (!particle.alive)
-			{
-				idx++;
-				continue;
-			}
-
-			particle.position += particle.velocity*dt;
-			particle.angle += particle.angleSpeed*dt;
-			particle.time -= dt;
-
-			if (particle.time < 0)
-			{
-				particle.alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.Integrate(dt);
+		mParticles.RemoveDead();
 	}
 
 	void ParticlesEmitter::UpdateMesh()
 	{
-		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
-			mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		int count = mParticles.Count();
+
+		// Particles are split into meshes, because vertices are indexed by 16 bit indexes
+		int meshesCount = (count + mMaxParticlesPerMesh - 1)/mMaxParticlesPerMesh;
+		for (int i = mParticlesMeshes.Count(); i < meshesCount; i++)
+		{
+			int meshParticles = Math::Clamp(mParticlesNumLimit - i*mMaxParticlesPerMesh, 1, mMaxParticlesPerMesh);
+			mParticlesMeshes.Add(mnew Mesh(GetParticlesTexture(), meshParticles*4, meshParticles*2));
+		}
+
+		for (auto mesh : mParticlesMeshes)
+		{
+			mesh->vertexCount = 0;
+			mesh->polyCount = 0;
+		}
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		int polyIndex = 0;
+		if (count == 0)
+			return;
 
 		Vec2F invTexSize(1.0f, 1.0f);
-		if (mParticlesMesh->GetTexture())
+		if (mParticlesMeshes[0]->GetTexture())
 		{
-			invTexSize.Set(1.0f/mParticlesMesh->GetTexture()->GetSize().x,
-						   1.0f/mParticlesMesh->GetTexture()->GetSize().y);
+			invTexSize.Set(1.0f/mParticlesMeshes[0]->GetTexture()->GetSize().x,
+						   1.0f/mParticlesMeshes[0]->GetTexture()->GetSize().y);
 		}
 
 		RectF textureSrcRect;
@@ -256,42 +232,75 @@ namespace o2
 		float uvUp = 1.0f - textureSrcRect.bottom*invTexSize.y;
 		float uvDown = 1.0f - textureSrcRect.top*invTexSize.y;
 
-		for (auto& particle : mParticles)
+		mQuadAxesBuffer.resize(count*4);
+
+		float* xAxisX = mQuadAxesBuffer.Data();
+		float* xAxisY = xAxisX + count;
+		float* yAxisX = xAxisY + count;
+		float* yAxisY = yAxisX + count;
+		mParticles.CalculateQuadAxes(xAxisX, xAxisY, yAxisX, yAxisY);
+
+		for (int meshIdx = 0; meshIdx < meshesCount; meshIdx++)
 		{
-			if (!particle.alive)
-				continue;
-
-			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
-			Vec2F hs = particle.size*0.5f;
-			Vec2F xv(cs*hs.x, sn*hs.x);
-			Vec2F yv(-sn*hs.y, cs*hs.y);
-			Vec2F o(particle.position);
-			ULong colr = particle.color.ARGB();
-
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv + yv, colr, uvLeft, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv + yv, colr, uvRight, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv - yv, colr, uvRight, uvDown);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv - yv, colr, uvLeft, uvDown);
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 3;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 1;
-			mParticlesMesh->polyCount += 2;
+			Mesh* mesh = mParticlesMeshes[meshIdx];
+
+			int first = meshIdx*mMaxParticlesPerMesh;
+			int meshParticles = Math::Min(count - first, mMaxParticlesPerMesh);
+
+			if (mesh->GetMaxVertexCount() < (UInt)meshParticles*4)
+				mesh->Resize(meshParticles*4, meshParticles*2);
+
+			Vertex2* vertices = mesh->vertices;
+			UInt16* indexes = mesh->indexes;
+			int polyIndex = 0;
+
+			for (int j = 0; j < meshParticles; j++)
+			{
+				int i = first + j;
+				float ox = mParticles.positionX[i], oy = mParticles.positionY[i];
+				float xx = xAxisX[i], xy = xAxisY[i], yx = yAxisX[i], yy = yAxisY[i];
+				ULong colr = mParticles.color[i].ARGB();
+
+				UInt16 vertexIdx = (UInt16)(j*4);
+				vertices[vertexIdx    ].Set(ox - xx + yx, oy - xy + yy, colr, uvLeft, uvUp);
+				vertices[vertexIdx + 1].Set(ox + xx + yx, oy + xy + yy, colr, uvRight, uvUp);
+				vertices[vertexIdx + 2].Set(ox + xx - yx, oy + xy - yy, colr, uvRight, uvDown);
+				vertices[vertexIdx + 3].Set(ox - xx - yx, oy - xy - yy, colr, uvLeft, uvDown);
+
+				indexes[polyIndex++] = vertexIdx;
+				indexes[polyIndex++] = vertexIdx + 1;
+				indexes[polyIndex++] = vertexIdx + 2;
+
+				indexes[polyIndex++] = vertexIdx;
+				indexes[polyIndex++] = vertexIdx + 2;
+				indexes[polyIndex++] = vertexIdx + 3;
+			}
+
+			mesh->vertexCount = meshParticles*4;
+			mesh->polyCount = meshParticles*2;
 		}
 	}
 
+	TextureRef ParticlesEmitter::GetParticlesTexture() const
+	{
+		if (mImageAsset)
+			return TextureRef(mImageAsset->GetAtlas(), mImageAsset->GetAtlasPage());
+
+		return NoTexture();
+	}
+
 	void ParticlesEmitter::BasisChanged()
 	{
 		if (!mIsParticlesRelative)
 			return;
 
 		Basis change = mLastTransform.Inverted()*mTransform;
-		for (auto& particle : mParticles)
-			particle.position = change.Transform(particle.position);
+		for (int i = 0; i < mParticles.Count(); i++)
+		{
+			Vec2F position = change.Transform(Vec2F(mParticles.positionX[i], mParticles.positionY[i]));
+			mParticles.positionX[i] = position.x;
+			mParticles.positionY[i] = position.y;
+		}
 
 		mLastTransform = mTransform;
 	}
@@ -330,10 +339,9 @@ namespace o2
 	{
 		mImageAsset = image;
 
-		if (mImageAsset)
-			mParticlesMesh->SetTexture(TextureRef(mImageAsset->GetAtlas(), mImageAsset->GetAtlasPage()));
-		else
-			mParticlesMesh->SetTexture(NoTexture());
+		TextureRef texture = GetParticlesTexture();
+		for (auto mesh : mParticlesMeshes)
+			mesh->SetTexture(texture);
 	}
 
 	ImageAssetRef ParticlesEmitter::GetImage() const
@@ -381,19 +389,7 @@ namespace o2
 	void ParticlesEmitter::SetMaxParticles(int count)
 	{
 		mParticlesNumLimit = count;
-
-		int idx = 0;
-		while (mNumAliveParticles > mParticlesNumLimit)
-		{
-			if (mParticles[idx].alive)
-			{
-				mParticles[idx].alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.Truncate(mParticlesNumLimit);
 	}
 
 	int ParticlesEmitter::GetMaxParticles() const
@@ -403,15 +399,15 @@ namespace o2
 
 	int ParticlesEmitter::GetParticlesCount() const
 	{
-		return mNumAliveParticles;
+		return mParticles.Count();
 	}
 
 	bool ParticlesEmitter::IsAliveParticles() const
 	{
-		return mNumAliveParticles > 0;
+		return mParticles.Count() > 0;
 	}
 
-	const Vector<Particle>& ParticlesEmitter::GetParticles() const
+	const ParticlesBuffer& ParticlesEmitter::GetParticles() const
 	{
 		return mParticles;
 	}
@@ -124,8 +124,8 @@ namespace o2
 		// Returns has alive particles
 		bool IsAliveParticles() const;
 
-		// Returns particles list
-		const Vector<Particle>& GetParticles() const;
+		// Returns alive particles
+		const ParticlesBuffer& GetParticles() const;
 
 		// Sets particles relativity
 		void SetParticlesRelativity(bool relative);
@@ -270,13 +270,14 @@ namespace o2
 		Color4 mEmitParticlesColorA; // Emitting particles color A (particle emitting with color in range from this and ColorB)  @SERIALIZABLE
 		Color4 mEmitParticlesColorB; // Emitting particles color B (particle emitting with color in range from this and ColorA) @SERIALIZABLE
 
-		float            mCurrentTime = 0;         // Current working time in seconds
-		float            mEmitTimeBuffer = 0;      // Emitting next particle time buffer
-		Mesh*            mParticlesMesh = nullptr; // Particles mesh
-		Vector<Particle> mParticles;               // Working particles
-		Vector<int>      mDeadParticles;           // Dead particles indexes
-		int              mNumAliveParticles = 0;   // Count of current alive particles
-		Basis            mLastTransform;           // Last transformation
+		static constexpr int mMaxParticlesPerMesh = 8192; // Particles count limit of one mesh. 16 bit indexes and render batch buffer hold up to 10922 quads
+
+		float           mCurrentTime = 0;    // Current working time in seconds
+		float           mEmitTimeBuffer = 0; // Emitting next particle time buffer
+		Vector<Mesh*>   mParticlesMeshes;    // Particles meshes, each of them contains up to mMaxParticlesPerMesh particles @IGNORE
+		ParticlesBuffer mParticles;          // Alive particles, packed densely @IGNORE
+		Vector<float>   mQuadAxesBuffer;     // Particles quads axes, calculated when updating mesh @IGNORE
+		Basis           mLastTransform;      // Last transformation
 
 	protected:
 		// Emits particles hen updating
@@ -288,8 +289,11 @@ namespace o2
 		// Updates particles
 		void UpdateParticles(float dt);
 
-		// Updates mesh geometry
+		// Updates meshes geometry. Adds meshes, when particles don't fit into existing
 		void UpdateMesh(); 
+
+		// Returns texture of particles image
+		TextureRef GetParticlesTexture() const;
 		
 		// It is called when basis was changed, updates particles positions from last transform
 		void BasisChanged();
@@ -358,10 +362,6 @@ CLASS_FIELDS_META(o2::ParticlesEmitter)
 	PROTECTED_FIELD(mEmitParticlesColorB).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mCurrentTime).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mEmitTimeBuffer).DEFAULT_VALUE(0);
-	PROTECTED_FIELD(mParticlesMesh).DEFAULT_VALUE(nullptr);
-	PROTECTED_FIELD(mParticles);
-	PROTECTED_FIELD(mDeadParticles);
-	PROTECTED_FIELD(mNumAliveParticles).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mLastTransform);
 }
 END_META;
@@ -388,7 +388,7 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(int, GetMaxParticles);
 	PUBLIC_FUNCTION(int, GetParticlesCount);
 	PUBLIC_FUNCTION(bool, IsAliveParticles);
-	PUBLIC_FUNCTION(const Vector<Particle>&, GetParticles);
+	PUBLIC_FUNCTION(const ParticlesBuffer&, GetParticles);
 	PUBLIC_FUNCTION(void, SetParticlesRelativity, bool);
 	PUBLIC_FUNCTION(bool, IsParticlesRelative);
 	PUBLIC_FUNCTION(void, SetLoop, bool);
@@ -429,6 +429,7 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PROTECTED_FUNCTION(void, UpdateEffects, float);
 	PROTECTED_FUNCTION(void, UpdateParticles, float);
 	PROTECTED_FUNCTION(void, UpdateMesh);
+	PROTECTED_FUNCTION(TextureRef, GetParticlesTexture);
 	PROTECTED_FUNCTION(void, BasisChanged);
 }
 END_META;
@@ -3,14 +3,17 @@
 
 #include "o2/Application/Application.h"
 #include "o2/Assets/Assets.h"
+#include "o2/Assets/Types/AtlasAsset.h"
 #include "o2/Render/Font.h"
 #include "o2/Render/Mesh.h"
 #include "o2/Render/Sprite.h"
 #include "o2/Render/Texture.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
+#include "o2/Utils/Tasks/TaskManager.h"
 #include "o2/Application/Input.h"
 
 namespace o2
@@ -75,6 +78,155 @@ namespace o2
 		return mDIPCount;
 	}
 
+	int Render::GetUnsortedDrawCallsCount()
+	{
+		if (!mDrawCommandsSorting)
+			return mDIPCount;
+
+		return mUnsortedDIPCount;
+	}
+
+	void Render::SetDrawCommandsSortingEnabled(bool enabled)
+	{
+		if (mDrawCommandsSorting == enabled)
+			return;
+
+		DrawPrimitives();
+		mDrawCommandsSorting = enabled;
+	}
+
+	bool Render::IsDrawCommandsSortingEnabled() const
+	{
+		return mDrawCommandsSorting;
+	}
+
+	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (!mReady)
+			return;
+
+		mDrawingDepth += 1.0f;
+
+		if (mClippingEverything)
+			return;
+
+		if (mDrawCommandsSorting)
+			RecordDrawCommand(primitiveType, vertices, verticesCount, indexes, elementsCount, texture.mTexture);
+		else
+			SubmitBuffer(primitiveType, vertices, verticesCount, indexes, elementsCount, texture.mTexture);
+	}
+
+	void Render::RecordDrawCommand(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+								   UInt16* indexes, UInt elementsCount, Texture* texture)
+	{
+		if (verticesCount == 0)
+			return;
+
+		UInt indexesCount;
+		if (primitiveType == PrimitiveType::Line)
+			indexesCount = elementsCount*2;
+		else
+			indexesCount = elementsCount*3;
+
+		if (mDrawCommands.IsEmpty() || mLastRecordedTexture != texture || mLastRecordedPrimitiveType != primitiveType)
+			mUnsortedDIPCount++;
+
+		mLastRecordedTexture = texture;
+		mLastRecordedPrimitiveType = primitiveType;
+
+		DrawCommand command;
+		command.primitiveType = primitiveType;
+		command.texture = texture;
+		command.vertexOffset = mDrawCommandsVertices.Count();
+		command.verticesCount = verticesCount;
+		command.indexOffset = mDrawCommandsIndexes.Count();
+		command.elementsCount = elementsCount;
+		command.bounds = RectF(vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y);
+
+		for (UInt i = 1; i < verticesCount; i++)
+		{
+			const Vertex2& v = vertices[i];
+			command.bounds.left = Math::Min(command.bounds.left, v.x);
+			command.bounds.right = Math::Max(command.bounds.right, v.x);
+			command.bounds.bottom = Math::Min(command.bounds.bottom, v.y);
+			command.bounds.top = Math::Max(command.bounds.top, v.y);
+		}
+
+		mDrawCommandsVertices.insert(mDrawCommandsVertices.end(), vertices, vertices + verticesCount);
+		mDrawCommandsIndexes.insert(mDrawCommandsIndexes.end(), indexes, indexes + indexesCount);
+		mDrawCommands.Add(command);
+	}
+
+	void Render::SubmitDrawCommands()
+	{
+		if (mSubmittingDrawCommands || mDrawCommands.IsEmpty())
+			return;
+
+		mSubmittingDrawCommands = true;
+
+		// Each command is moved back to the latest batch with the same state, but only through batches 
+		// that don't overlap it. So overlapped geometry keeps it's drawing order
+		int batchesCount = 0;
+		for (int i = 0; i < mDrawCommands.Count(); i++)
+		{
+			const DrawCommand& command = mDrawCommands[i];
+
+			int targetBatch = -1;
+			int lastCheckBatch = Math::Max(0, batchesCount - mDrawCommandsSortingLookback);
+			for (int j = batchesCount - 1; j >= lastCheckBatch; j--)
+			{
+				const DrawCommandsBatch& batch = mDrawCommandsBatches[j];
+				if (batch.texture == command.texture && batch.primitiveType == command.primitiveType)
+				{
+					targetBatch = j;
+					break;
+				}
+
+				if (batch.bounds.IsIntersects(command.bounds))
+					break;
+			}
+
+			if (targetBatch < 0)
+			{
+				if (mDrawCommandsBatches.Count() == batchesCount)
+					mDrawCommandsBatches.Add(DrawCommandsBatch());
+
+				DrawCommandsBatch& batch = mDrawCommandsBatches[batchesCount];
+				batch.primitiveType = command.primitiveType;
+				batch.texture = command.texture;
+				batch.bounds = command.bounds;
+				batch.commands.Clear();
+				batch.commands.Add(i);
+
+				batchesCount++;
+			}
+			else
+			{
+				DrawCommandsBatch& batch = mDrawCommandsBatches[targetBatch];
+				batch.bounds = batch.bounds.Expand(command.bounds);
+				batch.commands.Add(i);
+			}
+		}
+
+		for (int i = 0; i < batchesCount; i++)
+		{
+			for (int commandIdx : mDrawCommandsBatches[i].commands)
+			{
+				const DrawCommand& command = mDrawCommands[commandIdx];
+				SubmitBuffer(command.primitiveType, mDrawCommandsVertices.Data() + command.vertexOffset, command.verticesCount,
+							 mDrawCommandsIndexes.Data() + command.indexOffset, command.elementsCount, command.texture);
+			}
+		}
+
+		mDrawCommands.Clear();
+		mDrawCommandsVertices.Clear();
+		mDrawCommandsIndexes.Clear();
+		mLastRecordedTexture = nullptr;
+
+		mSubmittingDrawCommands = false;
+	}
+
 	void Render::SetCamera(const Camera& camera)
 	{
 		mCamera = camera;
@@ -626,6 +778,70 @@ namespace o2
 		return mMaxTextureSize;
 	}
 
+	void Render::LoadAtlasTextureAsync(UID atlasAssetId, int page, const Function<void(const TextureRef&)>& onLoaded,
+									   const Function<bool()>& isCanceled /*= Function<bool()>()*/)
+	{
+		Texture* loadedTexture = mTextures.FindOrDefault([&](Texture* tex) {
+			return tex->GetAtlasAssetId() == atlasAssetId && tex->GetAtlasPage() == page;
+		});
+
+		if (loadedTexture || !TaskManager::IsSingletonInitialzed())
+		{
+			onLoaded(loadedTexture ? TextureRef(loadedTexture) : TextureRef(atlasAssetId, page));
+			return;
+		}
+
+		auto& atlasInfo = o2Assets.GetAssetInfo(atlasAssetId);
+		if (!atlasInfo.IsValid())
+		{
+			mLog->Error("Failed to load atlas texture with id " + (String)atlasAssetId + " and page " + (String)page);
+			onLoaded(TextureRef());
+			return;
+		}
+
+		String fileName = AtlasAsset::GetPageTextureFileName(atlasInfo, page);
+
+		TextureLoadingRequest request;
+		request.onLoaded = onLoaded;
+		request.isCanceled = isCanceled;
+
+		auto fnd = mLoadingTextures.find(fileName);
+		if (fnd != mLoadingTextures.end())
+		{
+			fnd->second.Add(request);
+			return;
+		}
+
+		mLoadingTextures[fileName].Add(request);
+
+		o2Tasks.RunJob([=]() {
+			Bitmap* bitmap = mnew Bitmap();
+			bool loaded = bitmap->Load(fileName, Bitmap::ImageType::Auto);
+
+			o2Jobs.RunOnMainThread([=]() {
+				auto requests = mLoadingTextures[fileName];
+				mLoadingTextures.Remove(fileName);
+
+				requests.RemoveAll([](const TextureLoadingRequest& request) {
+					return request.isCanceled && request.isCanceled();
+				});
+
+				// Texture isn't created and uploaded, when nobody waits for it
+				if (requests.IsEmpty())
+				{
+					delete bitmap;
+					return;
+				}
+
+				TextureRef texture = loaded ? TextureRef(atlasAssetId, page, bitmap) : TextureRef(atlasAssetId, page);
+				delete bitmap;
+
+				for (auto& request : requests)
+					request.onLoaded(texture);
+			});
+		});
+	}
+
 	float Render::GetDrawingDepth()
 	{
 		mDrawingDepth += 1.0f;
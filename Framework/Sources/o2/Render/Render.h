@@ -7,12 +7,15 @@
 #include "o2/Render/Windows/RenderBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Render/Android/RenderBase.h"
+#elif defined PLATFORM_LINUX
+#include "o2/Render/Linux/RenderBase.h"
 #endif
 
 #include "o2/Render/Camera.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Vertex2.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Map.h"
 
 // Render access macros
 #define o2Render o2::Render::Instance()
@@ -86,6 +89,9 @@ namespace o2
 		// Finishing rendering
 		void End();
 
+		// Executes recorded commands and waits until they're finished. Call it before reading rendered textures data
+		void Flush();
+
 		// Clearing current frame buffer with color
 		void Clear(const Color4& color = Color4::Gray());
 
@@ -101,6 +107,16 @@ namespace o2
 		// Returns draw calls count at last frame
 		int GetDrawCallsCount();
 
+		// Returns draw calls count at last frame, that would be submitted without draw commands sorting
+		int GetUnsortedDrawCallsCount();
+
+		// Enables or disables draw commands sorting. When enabled, drawing buffers are recorded and reordered by texture
+		// and primitive type before submitting. Overlapping geometry keeps it's drawing order
+		void SetDrawCommandsSortingEnabled(bool enabled);
+
+		// Returns is draw commands sorting enabled
+		bool IsDrawCommandsSortingEnabled() const;
+
 		// Binding camera. NULL - standard camera
 		void SetCamera(const Camera& camera);
 
@@ -268,12 +284,54 @@ namespace o2
 		// Returns maximum texture size
 		Vec2I GetMaxTextureSize() const;
 
+		// Loads atlas page texture asynchronously: bitmap is decoded on worker thread and uploaded on main thread.
+		// onLoaded is called on main thread. Simultaneous requests of same page are decoded once. isCanceled is
+		// checked on main thread when bitmap is decoded: canceled request isn't called, and texture isn't created
+		// when all requests are canceled
+		void LoadAtlasTextureAsync(UID atlasAssetId, int page, const Function<void(const TextureRef&)>& onLoaded,
+								   const Function<bool()>& isCanceled = Function<bool()>());
+
 		// Returns last draw depth of mesh
 		float GetDrawingDepth();
 
 		// Returns scissor infos at current frame
 		const Vector<ScissorInfo>& GetScissorInfos() const;
 
+	protected:
+		// -----------------------------------------------------------
+		// Recorded drawing buffer, waiting for sorting and submitting
+		// -----------------------------------------------------------
+		struct DrawCommand
+		{
+			PrimitiveType primitiveType; // Type of drawing primitives
+			Texture*      texture;       // Drawing texture
+			UInt          vertexOffset;  // First vertex in mDrawCommandsVertices
+			UInt          verticesCount; // Count of vertices
+			UInt          indexOffset;   // First index in mDrawCommandsIndexes
+			UInt          elementsCount; // Count of primitives
+			RectF         bounds;        // Vertices bounding rectangle
+		};
+
+		// -----------------------------------------------
+		// Request of asynchronously loading atlas texture
+		// -----------------------------------------------
+		struct TextureLoadingRequest
+		{
+			Function<void(const TextureRef&)> onLoaded;   // Called when texture is loaded
+			Function<bool()>                  isCanceled; // Returns true when texture isn't required anymore. Can be empty
+		};
+
+		// ---------------------------------------------------------------------------
+		// Group of draw commands with same state, that will be submitted in one batch
+		// ---------------------------------------------------------------------------
+		struct DrawCommandsBatch
+		{
+			PrimitiveType primitiveType; // Type of drawing primitives
+			Texture*      texture;       // Drawing texture
+			Vector<int>   commands;      // Indexes of commands in mDrawCommands
+			RectF         bounds;        // Summary bounding rectangle of commands
+		};
+
 	protected:
 		PrimitiveType mCurrentPrimitiveType; // Type of drawing primitives for next DIP
 
@@ -284,11 +342,24 @@ namespace o2
 		UInt     mFrameTrianglesCount;       // Total triangles at current frame
 		UInt     mDIPCount;                  // DrawIndexedPrimitives calls count
 
+		bool                      mDrawCommandsSorting = false;                        // Is draw commands recording and sorting enabled
+		bool                      mSubmittingDrawCommands = false;                     // True when recorded commands are submitting now
+		Vector<DrawCommand>       mDrawCommands;                                       // Recorded draw commands
+		Vector<Vertex2>           mDrawCommandsVertices;                               // Vertices of recorded draw commands
+		Vector<UInt16>            mDrawCommandsIndexes;                                // Indexes of recorded draw commands
+		Vector<DrawCommandsBatch> mDrawCommandsBatches;                                // Sorted batches buffer, reused between flushes
+		int                       mDrawCommandsSortingLookback = 64;                   // Maximum count of batches checked for merging
+		Texture*                  mLastRecordedTexture = nullptr;                      // Texture of last recorded command
+		PrimitiveType             mLastRecordedPrimitiveType = PrimitiveType::Polygon; // Primitive type of last recorded command
+		UInt                      mUnsortedDIPCount = 0;                               // DIPs count without draw commands sorting
+
 		LogStream* mLog; // Render log stream
 
 		Vector<Texture*> mTextures; // Loaded textures
 		Vector<Font*>    mFonts;    // Loaded fonts
 
+		Map<String, Vector<TextureLoadingRequest>> mLoadingTextures; // Asynchronously loading textures requests by file name
+
 		Camera mCamera;            // Camera transformation
 		Vec2I  mResolution;        // Primary back buffer size
 		Vec2I  mCurrentResolution; // Current back buffer size
@@ -345,6 +416,17 @@ namespace o2
 		// Send buffers to draw
 		void DrawPrimitives();
 
+		// Puts buffer into current batch, flushes batch when state changes or buffer is full
+		void SubmitBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+						  UInt16* indexes, UInt elementsCount, Texture* texture);
+
+		// Records buffer into draw commands queue
+		void RecordDrawCommand(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							   UInt16* indexes, UInt elementsCount, Texture* texture);
+
+		// Sorts recorded draw commands by state, keeping order of overlapping ones, and submits them
+		void SubmitDrawCommands();
+
 		// Sets orthographic view matrix by view size
 		void SetupViewMatrix(const Vec2I& viewSize);
 
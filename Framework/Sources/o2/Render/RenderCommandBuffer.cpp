@@ -0,0 +1,80 @@
+#include "o2/stdafx.h"
+#include "RenderCommandBuffer.h"
+
+namespace o2
+{
+	RenderCommandBuffer::Command& RenderCommandBuffer::Add(CommandType type)
+	{
+		Command& command = mCommands.Add(Command());
+		command.type = type;
+
+		return command;
+	}
+
+	void RenderCommandBuffer::AddDraw(PrimitiveType primitiveType, UInt texture, UInt verticesCount, UInt indexesCount)
+	{
+		Command& command = Add(CommandType::Draw);
+		command.primitiveType = primitiveType;
+		command.texture = texture;
+		command.vertexOffset = mVertices.Count() - verticesCount;
+		command.verticesCount = verticesCount;
+		command.indexOffset = mIndexes.Count() - indexesCount;
+		command.indexesCount = indexesCount;
+	}
+
+	void RenderCommandBuffer::AddVertices(const Vertex2* vertices, UInt count)
+	{
+		mVertices.insert(mVertices.end(), vertices, vertices + count);
+	}
+
+	void RenderCommandBuffer::AddIndexes(const UInt16* indexes, UInt count, UInt offset)
+	{
+		int begin = mIndexes.Count();
+		mIndexes.Resize(begin + count);
+
+		UInt16* dest = mIndexes.Data() + begin;
+		for (UInt i = 0; i < count; i++)
+			dest[i] = (UInt16)(indexes[i] + offset);
+	}
+
+	UInt RenderCommandBuffer::AddTextureData(const UInt8* data, UInt size)
+	{
+		UInt offset = mTexturesData.Count();
+		mTexturesData.insert(mTexturesData.end(), data, data + size);
+
+		return offset;
+	}
+
+	const Vector<RenderCommandBuffer::Command>& RenderCommandBuffer::GetCommands() const
+	{
+		return mCommands;
+	}
+
+	const Vector<Vertex2>& RenderCommandBuffer::GetVertices() const
+	{
+		return mVertices;
+	}
+
+	const Vector<UInt16>& RenderCommandBuffer::GetIndexes() const
+	{
+		return mIndexes;
+	}
+
+	const Vector<UInt8>& RenderCommandBuffer::GetTexturesData() const
+	{
+		return mTexturesData;
+	}
+
+	bool RenderCommandBuffer::IsEmpty() const
+	{
+		return mCommands.IsEmpty();
+	}
+
+	void RenderCommandBuffer::Clear()
+	{
+		mCommands.Clear();
+		mVertices.Clear();
+		mIndexes.Clear();
+		mTexturesData.Clear();
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Math/Color.h"
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Math/Vertex2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------------------
+	// Frame render commands. Render records state changes, textures uploads and drawing batches with their vertices
+	// here, and commands are executed later by render thread in recorded order. Textures are referenced by handles,
+	// so recorded commands stay valid when texture objects are destroyed or recreated after recording
+	// -------------------------------------------------------------------------------------------------------------
+	class RenderCommandBuffer
+	{
+	public:
+		enum class CommandType
+		{
+			Clear, ClearStencil, SetViewMatrix, SetCameraTransform, BeginStencilDrawing, EndStencilDrawing,
+			EnableStencilTest, DisableStencilTest, EnableScissorTest, SetScissorRect, DisableScissorTest,
+			BindRenderTarget, UnbindRenderTarget, Draw, TextureImage, TextureSubImage, TextureParameters, CopyTexture,
+			DeleteTexture, Present, Finish
+		};
+
+		static const UInt NoData = (UInt)-1; // Data offset of commands without pixels
+
+		// --------------
+		// Render command
+		// --------------
+		struct Command
+		{
+			CommandType   type;          // Type of command
+			PrimitiveType primitiveType; // Type of drawing primitives
+			UInt          texture;       // Handle of drawing, binding, uploading, copying or deleting texture. Zero when no texture
+			UInt          vertexOffset;  // First drawing vertex in buffer vertices
+			UInt          verticesCount; // Count of drawing vertices
+			UInt          indexOffset;   // First drawing index in buffer indexes
+			UInt          indexesCount;  // Count of drawing indexes
+			UInt          dataOffset;    // First byte of uploading pixels in buffer textures data. NoData when no pixels
+			PixelFormat   format;        // Format of uploading or copying texture
+			RectI         rect;          // Scissor or copying rectangle
+			Vec2I         size;          // View, render target or uploading pixels size
+			Vec2I         offset;        // Uploading pixels offset in texture
+			bool          nearestFilter; // Is texture filter nearest, otherwise linear
+			Basis         basis;         // Camera transformation
+			Color4        color;         // Clearing color
+		};
+
+	public:
+		// Adds command with type and returns it for filling parameters
+		Command& Add(CommandType type);
+
+		// Adds drawing command for last added vertices and indexes
+		void AddDraw(PrimitiveType primitiveType, UInt texture, UInt verticesCount, UInt indexesCount);
+
+		// Adds vertices of drawing batch
+		void AddVertices(const Vertex2* vertices, UInt count);
+
+		// Adds indexes of drawing batch, shifted by offset
+		void AddIndexes(const UInt16* indexes, UInt count, UInt offset);
+
+		// Copies uploading texture pixels and returns their offset for command
+		UInt AddTextureData(const UInt8* data, UInt size);
+
+		// Returns recorded commands
+		const Vector<Command>& GetCommands() const;
+
+		// Returns vertices of drawing commands
+		const Vector<Vertex2>& GetVertices() const;
+
+		// Returns indexes of drawing commands
+		const Vector<UInt16>& GetIndexes() const;
+
+		// Returns pixels of uploading textures commands
+		const Vector<UInt8>& GetTexturesData() const;
+
+		// Is there no commands
+		bool IsEmpty() const;
+
+		// Removes all commands, keeping allocated memory
+		void Clear();
+
+	protected:
+		Vector<Command> mCommands;     // Recorded commands
+		Vector<Vertex2> mVertices;     // Vertices of drawing commands
+		Vector<UInt16>  mIndexes;      // Indexes of drawing commands, relative to first vertex of drawing
+		Vector<UInt8>   mTexturesData; // Pixels of uploading textures commands
+	};
+}
@@ -7,6 +7,8 @@
 
 namespace o2
 {
+	static constexpr int maxCachedGlyphRuns = 1024; // Glyph runs cache is cleared when it becomes bigger
+
 	Text::Text():
 		mFont(nullptr), mSymbolsDistCoef(1), mLinesDistanceCoef(1), mVerAlign(VerAlign::Top),
 		mHorAlign(HorAlign::Left), mWordWrap(false), IRectDrawable(), mUpdatingMesh(false), mFontAssetId(0),
@@ -320,7 +322,7 @@ namespace o2
 			return;
 		}
 
-		PrepareMesh(textLen);
+		bool meshesChanged = PrepareMesh(textLen);
 
 		for (auto mesh : mMeshes)
 		{
@@ -335,43 +337,66 @@ namespace o2
 							   mSymbolsDistCoef, mLinesDistanceCoef);
 
 		Basis transf = CalculateTextBasis();
+
+		// Quads of symbols at same places with same frames and texture sources are already in meshes
+		bool updateAll = meshesChanged || transf != mLastTransform;
 		mLastTransform = transf;
 
+		unsigned long color = mColor.ABGR();
+		int symbolIdx = 0;
+
 		for (auto& line : mSymbolsSet.mLines)
 		{
 			for (auto& symb : line.mSymbols)
 			{
 				if (currentMesh->polyCount + 2 >= currentMesh->GetMaxPolyCount())
-					currentMesh = mMeshes[currentMeshIdx++];
+					currentMesh = mMeshes[++currentMeshIdx];
 
-				unsigned long color = mColor.ABGR();
-				Vec2F points[4] =
+				RectF frame = symb.mFrame - mSymbolsSet.mPosition;
+				bool changed = updateAll || symbolIdx >= mMeshSymbols.Count() ||
+					mMeshSymbols[symbolIdx].mFrame != frame || mMeshSymbols[symbolIdx].mTexSrc != symb.mTexSrc;
+
+				if (changed)
 				{
-					transf.Transform(symb.mFrame.LeftTop() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.RightTop() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.RightBottom() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.LeftBottom() - mSymbolsSet.mPosition)
-				};
-
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[0], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.top);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[1], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.top);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[2], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.bottom);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[3], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.bottom);
-
-				int pp = currentMesh->polyCount*3;
-				currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
-				currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 3;
-				currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 2;
-				currentMesh->polyCount++;
-
-				pp += 3;
-				currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
-				currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 2;
-				currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 1;
-				currentMesh->polyCount++;
+					Vec2F points[4] =
+					{
+						transf.Transform(frame.LeftTop()),
+						transf.Transform(frame.RightTop()),
+						transf.Transform(frame.RightBottom()),
+						transf.Transform(frame.LeftBottom())
+					};
+
+					UInt vx = currentMesh->vertexCount;
+					currentMesh->vertices[vx] = Vertex2(points[0], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.top);
+					currentMesh->vertices[vx + 1] = Vertex2(points[1], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.top);
+					currentMesh->vertices[vx + 2] = Vertex2(points[2], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.bottom);
+					currentMesh->vertices[vx + 3] = Vertex2(points[3], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.bottom);
+
+					int pp = currentMesh->polyCount*3;
+					currentMesh->indexes[pp] = vx;
+					currentMesh->indexes[pp + 1] = vx + 1;
+					currentMesh->indexes[pp + 2] = vx + 2;
+					currentMesh->indexes[pp + 3] = vx;
+					currentMesh->indexes[pp + 4] = vx + 2;
+					currentMesh->indexes[pp + 5] = vx + 3;
+
+					if (symbolIdx < mMeshSymbols.Count())
+						mMeshSymbols[symbolIdx] = symb;
+					else
+						mMeshSymbols.Add(symb);
+
+					mMeshSymbols[symbolIdx].mFrame = frame;
+				}
+
+				currentMesh->vertexCount += 4;
+				currentMesh->polyCount += 2;
+				symbolIdx++;
 			}
 		}
 
+		if (symbolIdx < mMeshSymbols.Count())
+			mMeshSymbols.RemoveRange(symbolIdx, mMeshSymbols.Count());
+
 		currentMesh->SetTexture(mFont->mTexture);
 
 		mUpdatingMesh = false;
@@ -379,26 +404,29 @@ namespace o2
 
 	void Text::CheckCharactersAndRebuildMesh()
 	{
+		mSymbolsSet.ResetCache();
+		mMeshSymbols.Clear();
+
 		mFont->CheckCharacters(mText, height);
 		mFont->CheckCharacters(".", height);
 		UpdateMesh();
 	}
 
-	void Text::PrepareMesh(int charactersCount)
+	bool Text::PrepareMesh(int charactersCount)
 	{
 		int needPolygons = charactersCount*2 + 15; // 15 for dots endings
 		for (auto mesh : mMeshes)
 			needPolygons -= mesh->GetMaxPolyCount();
 
 		if (needPolygons <= 0)
-			return;
+			return false;
 
 		if (mMeshes.Count() > 0 &&
 			needPolygons + mMeshes.Last()->GetMaxPolyCount() < mMeshMaxPolyCount)
 		{
 			mMeshes.Last()->Resize(mMeshes.Last()->GetMaxVertexCount() + (UInt)needPolygons*2,
 								   mMeshes.Last()->GetMaxPolyCount() + (UInt)needPolygons);
-			return;
+			return true;
 		}
 
 		while (needPolygons > 0)
@@ -407,6 +435,8 @@ namespace o2
 			needPolygons -= polyCount;
 			mMeshes.Add(mnew Mesh(mFont->mTexture, polyCount * 2, polyCount));
 		}
+
+		return true;
 	}
 
 	Basis Text::CalculateTextBasis() const
@@ -479,6 +509,13 @@ namespace o2
 									  HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings,
 									  float charsDistCoef, float linesDistCoef)
 	{
+		// Glyph runs layouts depend only on these parameters
+		if (mFont != font || mHeight != height || !Math::Equals(mSymbolsDistCoef, charsDistCoef) ||
+			mGlyphRuns.Count() > maxCachedGlyphRuns)
+		{
+			mGlyphRuns.Clear();
+		}
+
 		mFont = font;
 		mText = text;
 		mHeight = height;
@@ -492,7 +529,9 @@ namespace o2
 		mLinesDistCoef = linesDistCoef;
 		mDotsEndings = dotsEngings;
 
+		mUnusedLines.swap(mLines);
 		mLines.Clear();
+
 		int textLen = mText.Length();
 
 		if (textLen == 0)
@@ -501,99 +540,37 @@ namespace o2
 		float linesDist = mFont->GetLineHeightPx(mHeight)*mLinesDistCoef;
 		float fontHeight = mFont->GetHeightPx(mHeight);
 
-		mLines.Add(Line());
-		Line* curLine = &mLines.Last();
-		curLine->mSize.y = fontHeight;
-
 		float dotsSize = mFont->GetCharacter('.', mHeight).mAdvance*3.0f;
 
 		Vec2F fullSize(0, fontHeight);
-		bool checkAreaBounds = mWordWrap && mAreaSize.x > FLT_EPSILON;
-		int wrapCharIdx = -1;
-		for (int i = 0; i < textLen; i++)
-		{
-			const Font::Character& ch = mFont->GetCharacter(mText[i], mHeight);
-			Vec2F chSize = ch.mSize;
-			Vec2F chPos = Vec2F(curLine->mSize.x - ch.mOrigin.x, -ch.mOrigin.y);
-
-			if (mDotsEndings && mText[i] != '\n' && curLine->mSize.x + ch.mAdvance*mSymbolsDistCoef > mAreaSize.x - dotsSize)
-			{
-				const Font::Character& dotCh = mFont->GetCharacter('.', mHeight);
-				Vec2F dotChSize = dotCh.mSize;
-
-				for (int j = 0; j < 3; j++)
-				{
-					Vec2F dotChPos = Vec2F(curLine->mSize.x - dotCh.mOrigin.x, -dotCh.mOrigin.y);
-					curLine->mSymbols.Add(Symbol(dotChPos, dotChSize, dotCh.mTexSrc, dotCh.mId, dotCh.mOrigin, dotCh.mAdvance));
-					curLine->mString += '.';
-					curLine->mSize.x += dotCh.mAdvance*mSymbolsDistCoef;
-				}
-
-				for (; i < textLen - 1; i++)
-				{
-					if (mText[i + 1] == '\n')
-						break;
-				}
-
-				continue;
-			}
-
-			curLine->mSymbols.Add(Symbol(chPos, chSize, ch.mTexSrc, ch.mId, ch.mOrigin, ch.mAdvance));
+		int paragraphBegin = 0;
 
-			if (mText[i] != '\n')
-				curLine->mSize.x += ch.mAdvance*mSymbolsDistCoef;
-
-			curLine->mString += mText[i];
+		while (paragraphBegin <= textLen)
+		{
+			int paragraphEnd = mText.Find('\n', paragraphBegin);
+			bool endedNewLine = paragraphEnd >= 0;
+			if (!endedNewLine)
+				paragraphEnd = textLen;
 
-			bool outOfBounds = checkAreaBounds ? curLine->mSize.x > mAreaSize.x && i > curLine->mLineBegSymbol : false;
+			int paragraphFirstLine = mLines.Count();
+			LayoutParagraph(paragraphBegin, paragraphEnd, dotsSize);
 
-			if (mText[i] == '\n' || outOfBounds)
+			for (int i = paragraphFirstLine; i < mLines.Count(); i++)
 			{
-				if (outOfBounds)
-				{
-					if (wrapCharIdx < 0 || wrapCharIdx == curLine->mLineBegSymbol)
-						wrapCharIdx = i;
-					else
-						curLine->mSpacesCount--;
-
-					int cutLen = wrapCharIdx - curLine->mLineBegSymbol;
-
-					curLine->mSymbols.RemoveRange(cutLen, curLine->mSymbols.Count());
-					curLine->mString.Erase(cutLen);
-
-
-					if (curLine->mSymbols.Count() > 0)
-						curLine->mSize.x = curLine->mSymbols.Last().mFrame.right;
-					else
-						curLine->mSize.x = 0;
+				if (i > 0)
+					fullSize.y += linesDist;
 
-					i = wrapCharIdx - 1;
-					wrapCharIdx = -1;
-				}
-				else
-				{
-					curLine->mSymbols.PopBack();
-					curLine->mString.PopBack();
-					curLine->mEndedNewLine = true;
-				}
+				mLines[i].mSize.y = i == 0 ? fontHeight : linesDist;
+				fullSize.x = Math::Max(fullSize.x, mLines[i].mSize.x);
+			}
 
-				fullSize.x = Math::Max(fullSize.x, curLine->mSize.x);
-				fullSize.y += linesDist;
+			if (!endedNewLine)
+				break;
 
-				mLines.Add(Line());
-				curLine = &mLines.Last();
-				curLine->mSize.y = linesDist;
-				curLine->mLineBegSymbol = i + 1;
-			}
-			else if (mText[i] == ' '/* || mFont->mAllSymbolReturn*/)
-			{
-				curLine->mSpacesCount++;
-				wrapCharIdx = i;
-			}
+			mLines.Last().mEndedNewLine = true;
+			paragraphBegin = paragraphEnd + 1;
 		}
 
-		fullSize.x = Math::Max(fullSize.x, curLine->mSize.x);
-
 		float lineHeight = linesDist;
 		float yOffset = mAreaSize.y - mLines[0].mSize.y;
 
@@ -638,6 +615,161 @@ namespace o2
 		mRealSize = fullSize;
 	}
 
+	void Text::SymbolsSet::LayoutParagraph(int begin, int end, float dotsSize)
+	{
+		Line* curLine = AddLine(begin);
+
+		bool checkAreaBounds = mWordWrap && mAreaSize.x > FLT_EPSILON;
+		int wrapCharIdx = -1;
+		int i = begin;
+		while (i < end)
+		{
+			int runEnd = i + 1;
+			if (mText[i] != ' ')
+			{
+				while (runEnd < end && mText[runEnd] != ' ')
+					runEnd++;
+			}
+
+			const GlyphRun& run = GetGlyphRun(i, runEnd);
+
+			// Whole run is added when it fits in line
+			float runRight = curLine->mSize.x + run.mAdvance;
+			if ((!checkAreaBounds || runRight <= mAreaSize.x) && (!mDotsEndings || runRight <= mAreaSize.x - dotsSize))
+			{
+				Vec2F runOffset(curLine->mSize.x, 0);
+				for (auto& symbol : run.mSymbols)
+				{
+					Symbol& lineSymbol = curLine->mSymbols.Add(symbol);
+					lineSymbol.mFrame += runOffset;
+				}
+
+				curLine->mString += run.mText;
+				curLine->mSize.x = runRight;
+
+				if (mText[i] == ' ')
+				{
+					curLine->mSpacesCount++;
+					wrapCharIdx = i;
+				}
+
+				i = runEnd;
+				continue;
+			}
+
+			// Run doesn't fit, symbols are added one by one to find where line breaks
+			int nextIdx = runEnd;
+			for (int j = i; j < runEnd; j++)
+			{
+				const Symbol& runSymbol = run.mSymbols[j - i];
+
+				if (mDotsEndings && curLine->mSize.x + runSymbol.mAdvance*mSymbolsDistCoef > mAreaSize.x - dotsSize)
+				{
+					const Font::Character& dotCh = mFont->GetCharacter('.', mHeight);
+					Vec2F dotChSize = dotCh.mSize;
+
+					for (int k = 0; k < 3; k++)
+					{
+						Vec2F dotChPos = Vec2F(curLine->mSize.x - dotCh.mOrigin.x, -dotCh.mOrigin.y);
+						curLine->mSymbols.Add(Symbol(dotChPos, dotChSize, dotCh.mTexSrc, dotCh.mId, dotCh.mOrigin, dotCh.mAdvance));
+						curLine->mString += '.';
+						curLine->mSize.x += dotCh.mAdvance*mSymbolsDistCoef;
+					}
+
+					return;
+				}
+
+				Vec2F chPos = Vec2F(curLine->mSize.x - runSymbol.mOrigin.x, -runSymbol.mOrigin.y);
+				curLine->mSymbols.Add(Symbol(chPos, runSymbol.mFrame.Size(), runSymbol.mTexSrc, runSymbol.mCharId,
+											 runSymbol.mOrigin, runSymbol.mAdvance));
+				curLine->mSize.x += runSymbol.mAdvance*mSymbolsDistCoef;
+				curLine->mString += mText[j];
+
+				bool outOfBounds = checkAreaBounds ? curLine->mSize.x > mAreaSize.x && j > curLine->mLineBegSymbol : false;
+
+				if (outOfBounds)
+				{
+					if (wrapCharIdx < 0 || wrapCharIdx == curLine->mLineBegSymbol)
+						wrapCharIdx = j;
+					else
+						curLine->mSpacesCount--;
+
+					int cutLen = wrapCharIdx - curLine->mLineBegSymbol;
+
+					curLine->mSymbols.RemoveRange(cutLen, curLine->mSymbols.Count());
+					curLine->mString.Erase(cutLen);
+
+					if (curLine->mSymbols.Count() > 0)
+						curLine->mSize.x = curLine->mSymbols.Last().mFrame.right;
+					else
+						curLine->mSize.x = 0;
+
+					nextIdx = wrapCharIdx;
+					wrapCharIdx = -1;
+
+					curLine = AddLine(nextIdx);
+					break;
+				}
+				else if (mText[j] == ' ')
+				{
+					curLine->mSpacesCount++;
+					wrapCharIdx = j;
+				}
+			}
+
+			i = nextIdx;
+		}
+	}
+
+	Text::SymbolsSet::Line* Text::SymbolsSet::AddLine(int begSymbol)
+	{
+		Line* line = &mLines.Add(Line());
+		line->mLineBegSymbol = begSymbol;
+
+		if (!mUnusedLines.IsEmpty())
+		{
+			Line& unusedLine = mUnusedLines.Last();
+			line->mSymbols.swap(unusedLine.mSymbols);
+			line->mString.swap(unusedLine.mString);
+			mUnusedLines.PopBack();
+
+			line->mSymbols.Clear();
+			line->mString.Clear();
+		}
+
+		return line;
+	}
+
+	const Text::SymbolsSet::GlyphRun& Text::SymbolsSet::GetGlyphRun(int begin, int end)
+	{
+		const wchar_t* chars = mText.Data() + begin;
+		int length = end - begin;
+
+		GlyphRun& run = mGlyphRuns[GetBytesHash(chars, length*sizeof(wchar_t))];
+		if (run.mText.Length() == length && memcmp(run.mText.Data(), chars, length*sizeof(wchar_t)) == 0)
+			return run;
+
+		// Run isn't cached yet or other run has same hash
+		run.mText = mText.SubStr(begin, end);
+		run.mSymbols.Clear();
+		run.mAdvance = 0.0f;
+
+		for (int i = begin; i < end; i++)
+		{
+			const Font::Character& ch = mFont->GetCharacter(mText[i], mHeight);
+			Vec2F chPos = Vec2F(run.mAdvance - ch.mOrigin.x, -ch.mOrigin.y);
+			run.mSymbols.Add(Symbol(chPos, ch.mSize, ch.mTexSrc, ch.mId, ch.mOrigin, ch.mAdvance));
+			run.mAdvance += ch.mAdvance*mSymbolsDistCoef;
+		}
+
+		return run;
+	}
+
+	void Text::SymbolsSet::ResetCache()
+	{
+		mGlyphRuns.Clear();
+	}
+
 	void Text::SymbolsSet::Move(const Vec2F& offs)
 	{
 		for (auto& line : mLines)
@@ -5,6 +5,7 @@
 #include "o2/Assets/Types/VectorFontAsset.h"
 #include "o2/Render/FontRef.h"
 #include "o2/Render/RectDrawable.h"
+#include "o2/Utils/Types/Containers/UnorderedMap.h"
 #include "o2/Utils/Types/String.h"
 
 namespace o2
@@ -197,6 +198,16 @@ namespace o2
 				bool operator==(const Line& other) const;
 			};
 
+			// ---------------------------------------------------------------------------------------
+			// Cached layout of glyph run: word or space. Symbols frames are relative to run beginning
+			// ---------------------------------------------------------------------------------------
+			struct GlyphRun
+			{
+				WString        mText;           // Run text
+				Vector<Symbol> mSymbols;        // Run symbols
+				float          mAdvance = 0.0f; // Run width, including symbols distance coefficient
+			};
+
 		public:
 			FontRef  mFont;            // Font
 			int      mHeight;          // Text height
@@ -211,16 +222,33 @@ namespace o2
 			float    mSymbolsDistCoef; // Characters distance coefficient, 1 is standard
 			float    mLinesDistCoef;   // Lines distance coefficient, 1 is standard
 
-			Vector<Line> mLines; // Lines definitions
+			Vector<Line> mLines;       // Lines definitions
+			Vector<Line> mUnusedLines; // Lines of previous layout. Reused by new lines, so symbols and strings memory isn't allocated again
+
+			UnorderedMap<UInt64, GlyphRun> mGlyphRuns; // Cached glyph runs layouts by text hash. Valid while font, height and characters distance are same
 
 		public:
-			// Calculating characters layout by parameters
+			// Calculating characters layout by parameters. Words and spaces layouts are taken from glyph runs cache,
+			// so only new words are looked up in font
 			void Initialize(FontRef font, const WString& text, int height, const Vec2F& position, const Vec2F& areaSize,
 							HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings, float charsDistCoef,
 							float linesDistCoef);
 
 			// Moves symbols 
 			void Move(const Vec2F& offs);
+
+			// Resets cached glyph runs layouts. Must be called when font characters were changed
+			void ResetCache();
+
+		protected:
+			// Breaks text between line breaks into lines
+			void LayoutParagraph(int begin, int end, float dotsSize);
+
+			// Adds empty line beginning from symbol. Takes memory of unused line when it is possible
+			Line* AddLine(int begSymbol);
+
+			// Returns glyph run layout of text part. Lays out and caches run when it isn't cached
+			const GlyphRun& GetGlyphRun(int begin, int end);
 		};
 
 	protected:
@@ -243,6 +271,8 @@ namespace o2
 
 		SymbolsSet mSymbolsSet; // Symbols set definition
 
+		Vector<SymbolsSet::Symbol> mMeshSymbols; // Symbols of quads in meshes, frames are relative to symbols set position. Only changed quads are updated @IGNORE
+
 		bool mUpdatingMesh; // True, when mesh is already updating
 
 	protected:
@@ -255,8 +285,8 @@ namespace o2
 		// Transforming meshes by basis
 		void TransformMesh(const Basis& bas);
 
-		// Preparing meshes for characters count
-		void PrepareMesh(int charactersCount);
+		// Preparing meshes for characters count. Returns true when meshes were resized or added and their data was lost
+		bool PrepareMesh(int charactersCount);
 
 		// Calculates and returns text basis
 		Basis CalculateTextBasis() const;
@@ -337,7 +367,7 @@ CLASS_METHODS_META(o2::Text)
 	PROTECTED_FUNCTION(void, UpdateMesh);
 	PROTECTED_FUNCTION(void, CheckCharactersAndRebuildMesh);
 	PROTECTED_FUNCTION(void, TransformMesh, const Basis&);
-	PROTECTED_FUNCTION(void, PrepareMesh, int);
+	PROTECTED_FUNCTION(bool, PrepareMesh, int);
 	PROTECTED_FUNCTION(Basis, CalculateTextBasis);
 	PROTECTED_FUNCTION(void, ColorChanged);
 	PROTECTED_FUNCTION(void, BasisChanged);
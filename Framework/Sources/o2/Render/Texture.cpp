@@ -36,6 +36,13 @@ namespace o2
 		o2Render.mTextures.Add(this);
 	}
 
+	Texture::Texture(UID atlasAssetId, int page, Bitmap* bitmap) :
+		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
+	{
+		Create(atlasAssetId, page, bitmap);
+		o2Render.mTextures.Add(this);
+	}
+
 	Texture::Texture(UID atlasAssetId, int page) :
 		mReady(false), mAtlasAssetId(0), mAtlasPage(-1)
 	{
@@ -78,6 +85,13 @@ namespace o2
 		else o2Render.mLog->Error("Failed to load atlas texture with id " + (String)atlasAssetId + " and page " + (String)page);
 	}
 
+	void Texture::Create(UID atlasAssetId, int page, Bitmap* bitmap)
+	{
+		mAtlasAssetId = atlasAssetId;
+		mAtlasPage = page;
+		Create(bitmap);
+	}
+
 	void Texture::Create(const String& atlasAssetName, int page)
 	{
 		auto& info = o2Assets.GetAssetInfo(atlasAssetName);
@@ -4,6 +4,8 @@
 #include "o2/Render/Windows/TextureBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Render/Android/TextureBase.h"
+#elif defined PLATFORM_LINUX
+#include "o2/Render/Linux/TextureBase.h"
 #endif
 
 #include "o2/Utils/Math/Vector2.h"
@@ -54,6 +56,9 @@ namespace o2
 		// Constructor from bitmap
 		Texture(Bitmap* bitmap);
 
+		// Constructor from atlas page with already decoded page bitmap
+		Texture(UID atlasAssetId, int page, Bitmap* bitmap);
+
 		// Destructor
 		~Texture();
 
@@ -72,6 +77,9 @@ namespace o2
 		// Creates texture from bitmap
 		void Create(Bitmap* bitmap);
 
+		// Creates texture from atlas page with already decoded page bitmap
+		void Create(UID atlasAssetId, int page, Bitmap* bitmap);
+
 		// Sets texture's data from bitmap
 		void SetData(Bitmap* bitmap);
 
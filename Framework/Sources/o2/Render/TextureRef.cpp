@@ -62,6 +62,18 @@ namespace o2
 		mTexture->mRefs++;
 	}
 
+	TextureRef::TextureRef(UID atlasAssetId, int page, Bitmap* bitmap)
+	{
+		mTexture = o2Render.mTextures.FindOrDefault([&](Texture* tex) {
+			return tex->GetAtlasAssetId() == atlasAssetId && tex->GetAtlasPage() == page;
+		});
+
+		if (!mTexture)
+			mTexture = mnew Texture(atlasAssetId, page, bitmap);
+
+		mTexture->mRefs++;
+	}
+
 	TextureRef::TextureRef(const String& atlasAssetName, int page)
 	{
 		UID atlasAssetId = o2Assets.GetAssetId(atlasAssetName);
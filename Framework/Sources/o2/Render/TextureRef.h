@@ -27,6 +27,9 @@ namespace o2
 		// Constructor from atlas page
 		TextureRef(UID atlasAssetId, int page);
 
+		// Constructor from atlas page with already decoded page bitmap. Bitmap is used when page texture isn't loaded yet
+		TextureRef(UID atlasAssetId, int page, Bitmap* bitmap);
+
 		// Constructor from atlas page
 		TextureRef(const String& atlasAssetName, int page);
 
@@ -12,6 +12,7 @@
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
 
 namespace o2
@@ -19,14 +20,14 @@ namespace o2
 	VectorFont::VectorFont() :
 		Font(), mFreeTypeFace(nullptr)
 	{
-		mTexture = TextureRef(Vec2I(512, 512));
+		mTexture = TextureRef(Vec2I(512, 512), GetTextureFormat());
 		mTextureSrcRect.Set(0, 0, 512, 512);
 	}
 
 	VectorFont::VectorFont(const String& fileName) :
 		Font(), mFreeTypeFace(nullptr)
 	{
-		mTexture = TextureRef(Vec2I(512, 512));
+		mTexture = TextureRef(Vec2I(512, 512), GetTextureFormat());
 		mTextureSrcRect.Set(0, 0, 512, 512);
 
 		Load(fileName);
@@ -35,7 +36,7 @@ namespace o2
 	VectorFont::VectorFont(const VectorFont& other) :
 		Font(), mFreeTypeFace(other.mFreeTypeFace)
 	{
-		mTexture = TextureRef(Vec2I(512, 512));
+		mTexture = TextureRef(Vec2I(512, 512), GetTextureFormat());
 		mTextureSrcRect.Set(0, 0, 512, 512);
 	}
 
@@ -116,6 +117,9 @@ namespace o2
 		if (mHeights.TryGetValue(height, res))
 			return res;
 
+		if (!mFreeTypeFace)
+			return res;
+
 		Vec2I dpi = o2Render.GetDPI();
 		FT_Error error = FT_Set_Char_Size(mFreeTypeFace, 0, height*64, dpi.x, dpi.y);
 
@@ -134,6 +138,12 @@ namespace o2
 
 	void VectorFont::CheckCharacters(const WString& needChararacters, int height)
 	{
+		// Font wasn't loaded, there is nothing to render
+		if (!mFreeTypeFace)
+			return;
+
+		mHeightsLastUseFrame[height] = o2Time.GetCurrentFrame();
+
 		int len = needChararacters.Length();
 		Vector<wchar_t> needToRenderChars;
 		needToRenderChars.Reserve(len);
@@ -203,16 +213,30 @@ namespace o2
 	void VectorFont::Reset()
 	{
 		mCharacters.Clear();
+		ClearPackedCharacters();
+
+		PixelFormat format = GetTextureFormat();
+		if (mTexture->GetFormat() != format)
+			mTexture = TextureRef(mTexture->GetSize(), format, Texture::Usage::Default);
+
 		onCharactersRebuilt();
 	}
 
 	void VectorFont::UpdateCharacters(Vector<wchar_t>& newCharacters, int height)
 	{
-		RenderNewCharacters(newCharacters, height);
+		Vector<CharDef> charDefs;
+		charDefs.Reserve(newCharacters.Count());
+
+		RenderNewCharacters(newCharacters, height, charDefs);
+		PackCharacters(charDefs, height);
+
+		for (auto& charDef : charDefs)
+			delete charDef.bitmap;
+
 		onCharactersRebuilt();
 	}
 
-	void VectorFont::RenderNewCharacters(Vector<wchar_t>& newCharacters, int height)
+	void VectorFont::RenderNewCharacters(Vector<wchar_t>& newCharacters, int height, Vector<CharDef>& charDefs)
 	{
 		Vec2I dpi = o2Render.GetDPI();
 		FT_Set_Char_Size(mFreeTypeFace, 0, height * 64, dpi.x, dpi.y);
@@ -227,8 +251,9 @@ namespace o2
 
 		border += Vec2I(2, 2);
 
-		FT_Load_Char(mFreeTypeFace, 'A', FT_LOAD_RENDER);
-		int symbolsHeight = Math::CeilToInt((mFreeTypeFace->glyph->bitmap.rows + border.y*2)*1.25f);
+		// Transparent white pixel in RGBA order, glyph coverage goes to alpha
+		const UInt emptyPixel = 0x00ffffff;
+		PixelFormat format = mTexture->GetFormat();
 
 		for (auto ch : newCharacters)
 		{
@@ -239,23 +264,39 @@ namespace o2
 
 			Vec2I glyphSize(glyph->bitmap.width, glyph->bitmap.rows);
 
-			Bitmap* newBitmap = mnew Bitmap(PixelFormat::R8G8B8A8, glyphSize + border*2);
-			newBitmap->Fill(Color4(255, 255, 255, 0));
-			UInt8* newBitmapData = newBitmap->GetData();
+			Bitmap* newBitmap = mnew Bitmap(format, glyphSize + border*2);
 			Vec2I newBitmapSize = newBitmap->GetSize();
 
-			for (int x = 0; x < (int)glyph->bitmap.width; x++)
+			if (format == PixelFormat::A8)
 			{
-				for (int y = 0; y < (int)glyph->bitmap.rows; y++)
+				// Glyph coverage is copied as is
+				UInt8* newBitmapPixels = newBitmap->GetData();
+				memset(newBitmapPixels, 0, newBitmapSize.x*newBitmapSize.y);
+
+				for (int y = 0; y < glyphSize.y; y++)
 				{
-					Color4 c(255, 255, 255, glyph->bitmap.buffer[y*glyph->bitmap.width + x]);
-					ULong cl = c.ABGR();
-					memcpy(&newBitmapData[((newBitmapSize.y - y - 1 - border.y)*newBitmapSize.x + x + border.x)*4], &cl, 4);
+					const UInt8* srcRow = glyph->bitmap.buffer + y*glyph->bitmap.pitch;
+					UInt8* dstRow = newBitmapPixels + (newBitmapSize.y - y - 1 - border.y)*newBitmapSize.x + border.x;
+					memcpy(dstRow, srcRow, glyphSize.x);
 				}
 			}
+			else
+			{
+				UInt* newBitmapPixels = (UInt*)newBitmap->GetData();
+				std::fill(newBitmapPixels, newBitmapPixels + newBitmapSize.x*newBitmapSize.y, emptyPixel);
 
-			for (auto effect : mEffects)
-				effect->Process(newBitmap);
+				for (int y = 0; y < glyphSize.y; y++)
+				{
+					const UInt8* srcRow = glyph->bitmap.buffer + y*glyph->bitmap.pitch;
+					UInt* dstRow = newBitmapPixels + (newBitmapSize.y - y - 1 - border.y)*newBitmapSize.x + border.x;
+
+					for (int x = 0; x < glyphSize.x; x++)
+						dstRow[x] = emptyPixel | ((UInt)srcRow[x] << 24);
+				}
+
+				for (auto effect : mEffects)
+					effect->Process(newBitmap);
+			}
 
 			newCharDef.bitmap = newBitmap;
 			newCharDef.character.mId = ch;
@@ -265,72 +306,250 @@ namespace o2
 			newCharDef.character.mOrigin.x = -glyph->metrics.horiBearingX/64.0f + border.x;
 			newCharDef.character.mOrigin.y = (glyph->metrics.height - glyph->metrics.horiBearingY)/64.0f + border.y;
 
-			PackCharacter(newCharDef, symbolsHeight);
+			charDefs.Add(newCharDef);
 		}
 	}
 
-	void VectorFont::PackCharacter(CharDef& character, int height)
+	void VectorFont::PackCharacters(Vector<CharDef>& charDefs, int height)
 	{
-		PackLine* packLine = nullptr;
+		// Higher characters first, so lines are filled with characters of close heights
+		charDefs.Sort([](const CharDef& a, const CharDef& b) {
+			return a.bitmap->GetSize().y > b.bitmap->GetSize().y;
+		});
+
+		Vec2I maxTextureSize = o2Render.GetMaxTextureSize();
+
+		while (!PlaceCharacters(charDefs, height))
+		{
+			Vec2I textureSize = mTexture->GetSize();
+			if (textureSize.x < maxTextureSize.x || textureSize.y < maxTextureSize.y)
+				GrowTexture(Vec2I(Math::Min(textureSize.x*2, maxTextureSize.x), Math::Min(textureSize.y*2, maxTextureSize.y)));
+			else if (!EvictLeastUsedHeight(height))
+			{
+				o2Render.mLog->Warning("Font " + mFileName + " characters don't fit into maximum texture size");
+				break;
+			}
+		}
 
-		while (!packLine)
+		Vec2F invTexSize(1.0f/mTexture->GetSize().x, 1.0f/mTexture->GetSize().y);
+		for (auto& charDef : charDefs)
 		{
-			packLine = mPackLines.FindOrDefault([&](PackLine* x) {
-				return x->height >= height && x->length + character.bitmap->GetSize().x < mTexture->GetSize().x; });
+			if (charDef.rect.Width() == 0)
+				continue;
+
+			charDef.character.mTexSrc.left = charDef.rect.left*invTexSize.x;
+			charDef.character.mTexSrc.right = charDef.rect.right*invTexSize.x;
+			charDef.character.mTexSrc.top = 1.0f - charDef.rect.top*invTexSize.y;
+			charDef.character.mTexSrc.bottom = 1.0f - charDef.rect.bottom*invTexSize.y;
 
-			if (!packLine)
+			mTexture->SetSubData(charDef.rect.LeftBottom(), charDef.bitmap);
+
+			AddCharacter(charDef.character);
+		}
+	}
+
+	bool VectorFont::PlaceCharacters(Vector<CharDef>& charDefs, int height)
+	{
+		bool placedAll = true;
+		for (auto& charDef : charDefs)
+		{
+			if (charDef.rect.Width() > 0)
+				continue;
+
+			if (!PlaceRect(charDef.bitmap->GetSize(), height, charDef.rect))
 			{
-				if (mLastPackLinePos + height <= mTexture->GetSize().y)
-				{
-					packLine = mnew PackLine();
-					packLine->position = mLastPackLinePos;
-					packLine->height = height;
+				charDef.rect = RectI();
+				placedAll = false;
+			}
+		}
 
-					mPackLines.Add(packLine);
+		return placedAll;
+	}
 
-					mLastPackLinePos += height;
-				}
-				else
-				{
-					TextureRef lastTexture = mTexture;
-					mTexture = TextureRef(lastTexture->GetSize()*2, PixelFormat::R8G8B8A8, Texture::Usage::Default);
-					mTexture->Copy(*lastTexture.Get(), RectI(Vec2I(0, 0), lastTexture->GetSize()));
-
-					for (auto heightKV : mCharacters)
-					{
-						for (auto charKV : heightKV.second)
-						{
-							charKV.second.mTexSrc.left *= 0.5f;
-							charKV.second.mTexSrc.right *= 0.5f;
-							charKV.second.mTexSrc.top *= 0.5f;
-							charKV.second.mTexSrc.bottom *= 0.5f;
-						}
-					}
-				}
+	bool VectorFont::PlaceRect(const Vec2I& size, int fontHeight, RectI& rect)
+	{
+		Vec2I textureSize = mTexture->GetSize();
+		if (size.x > textureSize.x)
+			return false;
+
+		// Searches line with closest height. Much higher lines are used only when there is no space for new line
+		const int lineHeightGranularity = 4;
+		int newLineHeight = (size.y + lineHeightGranularity - 1)/lineHeightGranularity*lineHeightGranularity;
+		bool canAddLine = mLastPackLinePos + newLineHeight <= textureSize.y;
+
+		// Free line with closest height is used as new line
+		int freeLineIdx = -1;
+		for (int i = 0; i < mPackLines.Count(); i++)
+		{
+			const PackLine& line = mPackLines[i];
+			if (line.fontHeight == 0 && line.height >= newLineHeight &&
+				(freeLineIdx < 0 || line.height < mPackLines[freeLineIdx].height))
+			{
+				freeLineIdx = i;
 			}
 		}
 
-		character.packLine = packLine;
-		packLine->characters.Add(character);
+		canAddLine = canAddLine || freeLineIdx >= 0;
+
+		int lineIdx = -1;
+		for (int i = 0; i < mPackLines.Count(); i++)
+		{
+			const PackLine& line = mPackLines[i];
+			if (line.fontHeight != fontHeight)
+				continue;
+
+			if (line.height < size.y || line.length + size.x > textureSize.x)
+				continue;
 
-		character.rect.left = packLine->length;
-		character.rect.top = packLine->position + character.bitmap->GetSize().y;
-		character.rect.right = packLine->length + character.bitmap->GetSize().x;
-		character.rect.bottom = packLine->position;;
+			if (canAddLine && line.height > size.y*2)
+				continue;
 
-		packLine->length += character.bitmap->GetSize().x;
+			if (lineIdx < 0 || line.height < mPackLines[lineIdx].height)
+				lineIdx = i;
+		}
 
-		Vec2F invTexSize(1.0f/mTexture->GetSize().x, 1.0f/mTexture->GetSize().y);
-		character.character.mTexSrc.left = character.rect.left*invTexSize.x;
-		character.character.mTexSrc.right = character.rect.right*invTexSize.x;
-		character.character.mTexSrc.top = 1.0f - character.rect.top*invTexSize.y;
-		character.character.mTexSrc.bottom = 1.0f - character.rect.bottom*invTexSize.y;
+		if (lineIdx < 0 && freeLineIdx >= 0)
+		{
+			// Rest of free line stays free
+			PackLine& freeLine = mPackLines[freeLineIdx];
+			if (freeLine.height > newLineHeight)
+			{
+				PackLine restLine;
+				restLine.position = freeLine.position + newLineHeight;
+				restLine.height = freeLine.height - newLineHeight;
+				freeLine.height = newLineHeight;
 
-		mTexture->SetSubData(character.rect.LeftBottom(), character.bitmap);
+				mPackLines.Insert(restLine, freeLineIdx + 1);
+			}
+
+			lineIdx = freeLineIdx;
+		}
+
+		if (lineIdx < 0)
+		{
+			if (!canAddLine)
+				return false;
+
+			PackLine newLine;
+			newLine.position = mLastPackLinePos;
+			newLine.height = newLineHeight;
+			mPackLines.Add(newLine);
+
+			lineIdx = mPackLines.Count() - 1;
+			mLastPackLinePos += newLineHeight;
+		}
+
+		PackLine& packLine = mPackLines[lineIdx];
+
+		rect.left = packLine.length;
+		rect.top = packLine.position + size.y;
+		rect.right = packLine.length + size.x;
+		rect.bottom = packLine.position;
+
+		packLine.length += size.x;
+		packLine.fontHeight = fontHeight;
+
+		return true;
+	}
+
+	void VectorFont::GrowTexture(const Vec2I& newSize)
+	{
+		Vec2I oldSize = mTexture->GetSize();
+		Bitmap* packedCharacters = mTexture->GetData();
+
+		mTexture = TextureRef(newSize, GetTextureFormat(), Texture::Usage::Default);
+		mTexture->SetSubData(Vec2I(), packedCharacters);
+		mTextureSrcRect.Set(Vec2I(), newSize);
+
+		delete packedCharacters;
+
+		// Characters stay at same pixels, so texture coordinates are scaled. Top and bottom coordinates are inverted
+		Vec2F scale((float)oldSize.x/(float)newSize.x, (float)oldSize.y/(float)newSize.y);
+		for (auto& heightKV : mCharacters)
+		{
+			for (auto& characterKV : heightKV.second)
+			{
+				RectF& texSrc = characterKV.second.mTexSrc;
+				texSrc.left *= scale.x;
+				texSrc.right *= scale.x;
+				texSrc.top = 1.0f - (1.0f - texSrc.top)*scale.y;
+				texSrc.bottom = 1.0f - (1.0f - texSrc.bottom)*scale.y;
+			}
+		}
+	}
+
+	bool VectorFont::EvictLeastUsedHeight(int exceptHeight)
+	{
+		// Heights used in current frame aren't evicted, otherwise texts would evict characters of each other endlessly
+		int evictHeight = 0;
+		int evictHeightFrame = o2Time.GetCurrentFrame();
+
+		for (auto& heightKV : mCharacters)
+		{
+			if (heightKV.first == exceptHeight)
+				continue;
 
-		AddCharacter(character.character);
+			int lastUseFrame = 0;
+			mHeightsLastUseFrame.TryGetValue(heightKV.first, lastUseFrame);
 
-		delete character.bitmap;
+			if (lastUseFrame < evictHeightFrame)
+			{
+				evictHeight = heightKV.first;
+				evictHeightFrame = lastUseFrame;
+			}
+		}
+
+		if (evictHeight == 0)
+			return false;
+
+		mCharacters.Remove(evictHeight);
+		mHeightsLastUseFrame.Remove(evictHeight);
+
+		for (auto& line : mPackLines)
+		{
+			if (line.fontHeight != evictHeight)
+				continue;
+
+			line.length = 0;
+			line.fontHeight = 0;
+		}
+
+		// Lines are placed one after another, so neighbour free lines are merged to fit higher characters
+		for (int i = 0; i + 1 < mPackLines.Count();)
+		{
+			if (mPackLines[i].fontHeight == 0 && mPackLines[i + 1].fontHeight == 0)
+			{
+				mPackLines[i].height += mPackLines[i + 1].height;
+				mPackLines.RemoveAt(i + 1);
+			}
+			else
+				i++;
+		}
+
+		if (!mPackLines.IsEmpty() && mPackLines.Last().fontHeight == 0)
+		{
+			mLastPackLinePos = mPackLines.Last().position;
+			mPackLines.PopBack();
+		}
+
+		return true;
+	}
+
+	PixelFormat VectorFont::GetTextureFormat() const
+	{
+#if defined PLATFORM_ANDROID
+		// Android shader multiplies color by texture color, alpha texture color is black there
+		return PixelFormat::R8G8B8A8;
+#else
+		// Effects are colorizing characters, so they need all color channels
+		return mEffects.IsEmpty() ? PixelFormat::A8 : PixelFormat::R8G8B8A8;
+#endif
+	}
+
+	void VectorFont::ClearPackedCharacters()
+	{
+		mPackLines.Clear();
+		mLastPackLinePos = 0;
 	}
 }
 
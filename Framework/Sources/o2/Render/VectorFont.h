@@ -89,31 +89,27 @@ namespace o2
 		void Reset();
 
 	protected:
-		struct PackLine;
-
-		//-------------------------------
-		// Font glyph rendering character
-		// ------------------------------
+		// ---------------------------------------------------
+		// Font glyph rendering character, waiting for packing
+		// ---------------------------------------------------
 		struct CharDef
 		{
-			PackLine* packLine;
-			RectI     rect;
-			Character character;
-			Bitmap*   bitmap;
+			RectI     rect;      // Rectangle on texture
+			Character character; // Character definition
+			Bitmap*   bitmap;    // Rendered glyph bitmap
 
 			bool operator==(const CharDef& other) const { return false; }
 		};
 
-		// -----------------------
-		// Characters packing line
-		// -----------------------
+		// ----------------------------------------------------------------------------
+		// Characters packing shelf. Characters are placed in line one by one from left
+		// ----------------------------------------------------------------------------
 		struct PackLine
 		{
-			int position = 0;
-			int height = 0;
-			int length = 0;
-
-			Vector<CharDef> characters;
+			int position = 0;   // Bottom position on texture
+			int height = 0;     // Height of line
+			int length = 0;     // Occupied length from left
+			int fontHeight = 0; // Height of characters in line. Line contains characters of one height, 0 when line is free
 
 		public:
 			bool operator==(const PackLine& other) const { return false; }
@@ -125,20 +121,43 @@ namespace o2
 
 		Vector<Effect*> mEffects; // Font effects
 
-		Vector<PackLine*> mPackLines;           // Packed symbols lines
-		int               mLastPackLinePos = 0; // Last packed line bottom pos
+		Vector<PackLine> mPackLines;           // Packed symbols lines
+		int              mLastPackLinePos = 0; // Last packed line bottom pos
+
+		Map<int, int> mHeightsLastUseFrame; // Last frame when characters with height were checked. Used for evicting least recently used heights
 
 		mutable Map<int, float> mHeights; // Cached line heights
 
 	protected:
-		// Updates characters set
+		// Updates characters set: renders all new characters, then packs and uploads them together
 		void UpdateCharacters(Vector<wchar_t>& newCharacters, int height);
 
-		// Renders new characters
-		void RenderNewCharacters(Vector<wchar_t>& newCharacters, int height);
+		// Renders new characters glyphs into bitmaps
+		void RenderNewCharacters(Vector<wchar_t>& newCharacters, int height, Vector<CharDef>& charDefs);
+
+		// Packs characters with height into texture and uploads them. When texture is full, it grows up to maximum
+		// texture size; when maximum size is reached, characters of least recently used heights are evicted
+		void PackCharacters(Vector<CharDef>& charDefs, int height);
+
+		// Searches place for not placed characters in lines. Returns false when some character doesn't fit into texture
+		bool PlaceCharacters(Vector<CharDef>& charDefs, int height);
+
+		// Searches place for rectangle with size in lines of font height with closest height. When there is no such line,
+		// takes free line or creates new one
+		bool PlaceRect(const Vec2I& size, int fontHeight, RectI& rect);
+
+		// Creates bigger texture and copies packed characters into it. Characters texture coordinates are updated
+		void GrowTexture(const Vec2I& newSize);
+
+		// Removes characters of least recently used height except specified and frees their lines. Returns false
+		// when all other heights are used in current frame
+		bool EvictLeastUsedHeight(int exceptHeight);
+
+		// Returns texture format for characters. Characters without effects are stored only in alpha channel
+		PixelFormat GetTextureFormat() const;
 
-		// Packs character in line 
-		void PackCharacter(CharDef& character, int height);
+		// Removes all packed characters and lines
+		void ClearPackedCharacters();
 	};
 
 	template<typename _eff_type, typename ... _args>
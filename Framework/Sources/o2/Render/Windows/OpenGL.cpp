@@ -24,6 +24,12 @@ void GetGLExtensions(o2::LogStream* log /*= nullptr*/)
 	glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteBuffers", log);
 	glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteFramebuffersEXT", log);
 	glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)GetSafeWGLProcAddress("glCheckFramebufferStatusEXT", log);
+	glGenBuffers = (PFNGLGENBUFFERSPROC)GetSafeWGLProcAddress("glGenBuffers", log);
+	glBindBuffer = (PFNGLBINDBUFFERPROC)GetSafeWGLProcAddress("glBindBuffer", log);
+	glBufferData = (PFNGLBUFFERDATAPROC)GetSafeWGLProcAddress("glBufferData", log);
+	glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)GetSafeWGLProcAddress("glMapBufferRange", log);
+	glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)GetSafeWGLProcAddress("glFlushMappedBufferRange", log);
+	glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)GetSafeWGLProcAddress("glUnmapBuffer", log);
 
 }
 
@@ -80,6 +86,14 @@ const char* GetGLErrorDesc(GLenum errorId)
 	return "UNKNOWN";
 }
 
+GLenum GetGLPixelFormat(o2::PixelFormat format)
+{
+	if (format == o2::PixelFormat::R8G8B8A8) return GL_RGBA;
+	if (format == o2::PixelFormat::R8G8B8) return GL_RGB;
+
+	return GL_ALPHA;
+}
+
 void glCheckError(const char* filename /*= nullptr*/, unsigned int line /*= 0*/)
 {
 	GLenum errId = glGetError();
@@ -97,5 +111,11 @@ extern PFNGLDRAWBUFFERSPROC               glDrawBuffers = NULL;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers = NULL;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT = NULL;
 extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT = NULL;
+extern PFNGLGENBUFFERSPROC                glGenBuffers = NULL;
+extern PFNGLBINDBUFFERPROC                glBindBuffer = NULL;
+extern PFNGLBUFFERDATAPROC                glBufferData = NULL;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange = NULL;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC    glFlushMappedBufferRange = NULL;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer = NULL;
 
 #endif // PLATFORM_WINDOWS
@@ -7,6 +7,7 @@
 #include <GL/glu.h>
 #include "3rdPartyLibs/OpenGL/glext.h"
 #include "3rdPartyLibs/OpenGL/wglext.h"
+#include "o2/Utils/Types/CommonTypes.h"
 
 
 namespace o2
@@ -23,6 +24,9 @@ const char* GetGLErrorDesc(GLenum errorId);
 // Checks OpenGL extension supporting
 bool IsGLExtensionSupported(const char *extension);
 
+// Returns OpenGL format of texture pixels
+GLenum GetGLPixelFormat(o2::PixelFormat format);
+
 // Checks OpenGL error
 void glCheckError(const char* filename = nullptr, unsigned int line = 0);
 
@@ -39,5 +43,11 @@ extern PFNGLDRAWBUFFERSPROC               glDrawBuffers;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT;
 extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
+extern PFNGLGENBUFFERSPROC                glGenBuffers;
+extern PFNGLBINDBUFFERPROC                glBindBuffer;
+extern PFNGLBUFFERDATAPROC                glBufferData;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC    glFlushMappedBufferRange;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer;
 
 #endif // PLATFORM_WINDOWS
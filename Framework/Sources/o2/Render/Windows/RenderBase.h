@@ -2,8 +2,14 @@
 
 #ifdef PLATFORM_WINDOWS
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "o2/Render/RenderCommandBuffer.h"
 #include "o2/Render/Windows/OpenGL.h"
 #include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Math/Vector2.h"
 
 
@@ -14,13 +20,114 @@ namespace o2
 	class RenderBase
 	{
 	protected:
-		HGLRC mGLContext; // OpenGL context
-		HDC   mHDC;       // Windows frame device context
+		HGLRC mGLContext;                 // OpenGL context. Used on main thread for textures names and data reading when render thread is enabled
+		HGLRC mRenderGLContext = nullptr; // Render thread OpenGL context, shares resources with main context
+		HDC   mHDC;                       // Windows frame device context
 
-		UInt8*  mVertexData;               // Vertex data buffer
-		UInt16* mVertexIndexData;          // Index data buffer
+		UInt8*  mVertexData;               // Vertex data buffer. Points to mapped streaming buffer when it is available
+		UInt16* mVertexIndexData;          // Index data buffer. Points to mapped streaming buffer when it is available
 		UInt    mVertexBufferSize = 6000;  // Maximum size of vertex buffer
 		UInt    mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+		bool   mStreamBuffersAvailable = false; // True when vertex buffer objects with mapped ranges are supported
+		GLuint mVertexBufferObject = 0;         // Streaming vertices buffer
+		GLuint mIndexBufferObject = 0;          // Streaming indexes buffer
+		UInt   mStreamBatchesCount = 3;         // Count of full batches fitting into streaming buffers before orphaning
+		UInt   mVertexStreamOffset = 0;         // Current batch beginning in streaming vertex buffer, in vertices
+		UInt   mIndexStreamOffset = 0;          // Current batch beginning in streaming index buffer, in indexes
+		bool   mStreamBuffersMapped = false;    // True when current batch ranges are mapped
+
+		RenderCommandBuffer  mCommandBuffers[2];            // Frame commands buffers: one is recording, other is executing
+		RenderCommandBuffer* mRecordingCommands = nullptr;  // Commands buffer, recording on main thread
+		RenderCommandBuffer* mExecutingCommands = nullptr;  // Commands buffer, executing by render thread. Null when it is idle
+		Map<GLuint, GLuint>  mRenderTargetsFrameBuffers;    // Frame buffers of render targets by textures handles. Created by executor
+
+		bool                    mRenderThreadEnabled = false; // Is commands executed on render thread
+		bool                    mRenderThreadExit = false;    // Is render thread going to exit
+		std::thread             mRenderThread;                // Render thread, executes commands with one frame latency
+		std::mutex              mRenderThreadMutex;           // Executing commands buffer and exit flag mutex
+		std::condition_variable mRenderThreadCondition;       // Signaled when commands buffer is given to or executed by render thread
+
+		GLuint        mExecutingTexture = 0;                          // Bound texture on executing commands
+		PrimitiveType mExecutingPrimitiveType = PrimitiveType::Polygon; // Primitives type of last executed drawing
+
+	protected:
+		// Initializes state of current context, that is used for executing commands
+		void InitializeExecutingContext();
+
+		// Releases objects of current context, that is used for executing commands
+		void DeinitializeExecutingContext();
+
+		// Creates render thread context and starts render thread. Returns false if context sharing isn't supported
+		bool StartRenderThread();
+
+		// Stops render thread after executing submitted commands
+		void StopRenderThread();
+
+		// Render thread function: executes given commands buffers until exit
+		void RenderThreadLoop();
+
+		// Gives recorded commands to render thread, or executes them when render thread isn't enabled.
+		// Waits while render thread is executing previous commands
+		void SubmitCommands();
+
+		// Waits until render thread executes submitted commands
+		void WaitCommandsExecuted();
+
+		// Executes commands from buffer on current context
+		void ExecuteCommands(const RenderCommandBuffer& buffer);
+
+		// Sets orthographic projection and viewport by command size
+		void ExecuteSetViewMatrix(const RenderCommandBuffer::Command& command);
+
+		// Sets model view matrix by command camera basis and resolution
+		void ExecuteSetCameraTransform(const RenderCommandBuffer::Command& command);
+
+		// Executes drawing command
+		void ExecuteDraw(const RenderCommandBuffer& buffer, const RenderCommandBuffer::Command& command);
+
+		// Binds frame buffer of render target, creates it on first binding
+		void ExecuteBindRenderTarget(const RenderCommandBuffer::Command& command);
+
+		// Uploads texture pixels: whole image or sub image
+		void ExecuteUploadTexture(const RenderCommandBuffer& buffer, const RenderCommandBuffer::Command& command);
+
+		// Sets texture wrapping and filter
+		void ExecuteSetTextureParameters(const RenderCommandBuffer::Command& command);
+
+		// Deletes texture and it's frame buffer
+		void ExecuteDeleteTexture(const RenderCommandBuffer::Command& command);
+
+		// Records deleting of texture. Texture is deleted after executing previously recorded commands
+		void ReleaseTexture(GLuint handle);
+
+		// Records creating or replacing texture image. Pixels are copied, null data allocates image without pixels
+		void RecordTextureImage(GLuint handle, PixelFormat format, const Vec2I& size, const UInt8* data);
+
+		// Records updating texture pixels in rectangle at offset. Pixels are copied
+		void RecordTextureSubImage(GLuint handle, PixelFormat format, const Vec2I& offset, const Vec2I& size,
+								   const UInt8* data);
+
+		// Records setting texture wrapping and filter
+		void RecordTextureParameters(GLuint handle, bool nearestFilter);
+
+		// Creates streaming vertex and index buffers, when they are supported
+		void InitializeStreamBuffers();
+
+		// Destroys streaming buffers
+		void DeinitializeStreamBuffers();
+
+		// Maps streaming buffers ranges for next batch. Orphans buffers when there is no space for full batch
+		void MapStreamBuffers();
+
+		// Flushes written ranges, unmaps streaming buffers and binds vertex pointers to current batch
+		void UnmapStreamBuffers(UInt verticesCount, UInt indexesCount);
+
+		// Moves streaming offsets after current batch
+		void AdvanceStreamBuffers(UInt verticesCount, UInt indexesCount);
+
+		// Binds vertex pointers to vertices data: client side memory or offset in bound vertex buffer
+		void BindVertexPointers(const UInt8* data);
 	};
 };
 
@@ -13,6 +13,7 @@
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
 
@@ -97,29 +98,19 @@ namespace o2
 		// Check compatibles
 		CheckCompatibles();
 
-		// Initialize buffers
-		mVertexData = mnew UInt8[mVertexBufferSize * sizeof(Vertex2)];
-
-		mVertexIndexData = mnew UInt16[mIndexBufferSize];
+		mRecordingCommands = &mCommandBuffers[0];
 		mLastDrawVertex = 0;
 		mTrianglesCount = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
-		// Configure OpenGL
-		glEnableClientState(GL_COLOR_ARRAY);
-		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-		glEnableClientState(GL_VERTEX_ARRAY);
-
-		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), mVertexData + sizeof(float) * 3);
-		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), mVertexData + sizeof(float) * 3 + sizeof(unsigned long));
-		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), mVertexData + 0);
-
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		// Main context is used for generating textures names and reading textures when commands are executed by render thread
+		if (IsRenderThreadEnabled() && StartRenderThread())
+			mLog->Out("Using render thread");
+		else
+			InitializeExecutingContext();
 
-		glLineWidth(1.0f);
-
-		GL_CHECK_ERROR();
+		if (mStreamBuffersAvailable)
+			mLog->Out("Using streaming vertex buffers");
 
 		mLog->Out("GL_VENDOR: " + (String)(char*)glGetString(GL_VENDOR));
 		mLog->Out("GL_RENDERER: " + (String)(char*)glGetString(GL_RENDERER));
@@ -163,6 +154,14 @@ namespace o2
 			for (auto texture : textures)
 				delete texture;
 
+			if (mRenderThreadEnabled)
+				StopRenderThread();
+			else
+			{
+				SubmitCommands();
+				DeinitializeExecutingContext();
+			}
+
 			if (!wglMakeCurrent(NULL, NULL))
 				mLog->Error("Release ff DC And RC Failed.\n");
 
@@ -206,6 +205,9 @@ namespace o2
 		mTrianglesCount = 0;
 		mFrameTrianglesCount = 0;
 		mDIPCount = 0;
+		mUnsortedDIPCount = 0;
+		mLastRecordedTexture = nullptr;
+		mLastRecordedPrimitiveType = PrimitiveType::Polygon;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
 		mDrawingDepth = 0.0f;
@@ -224,14 +226,13 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		SubmitDrawCommands();
+
 		if (mLastDrawVertex < 1)
 			return;
 
-		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
-
-		glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
-
-		GL_CHECK_ERROR();
+		mRecordingCommands->AddDraw(mCurrentPrimitiveType, mLastDrawTexture ? mLastDrawTexture->mHandle : 0,
+									mLastDrawVertex, mLastDrawIdx);
 
 		mFrameTrianglesCount += mTrianglesCount;
 		mLastDrawVertex = mTrianglesCount = mLastDrawIdx = 0;
@@ -244,12 +245,7 @@ namespace o2
 		mCurrentResolution = viewSize;
 		mCamera = Camera();
 
-		float projMat[16];
-		Math::OrthoProjMatrix(projMat, 0.0f, (float)viewSize.x, (float)viewSize.y, 0.0f, 0.0f, 10.0f);
-		glMatrixMode(GL_PROJECTION);
-		glLoadIdentity();
-		glViewport(0, 0, viewSize.x, viewSize.y);
-		glLoadMatrixf(projMat);
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::SetViewMatrix).size = viewSize;
 
 		UpdateCameraTransforms();
 	}
@@ -259,13 +255,16 @@ namespace o2
 		if (!mReady)
 			return;
 
+		PROFILE_SCOPE("Render::End");
+
 		postRender();
 		postRender.Clear();
 
 		DrawPrimitives();
-		SwapBuffers(mHDC);
 
-		GL_CHECK_ERROR();
+		// Frame is presented by render thread, while next frame is updating
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::Present);
+		SubmitCommands();
 
 		CheckTexturesUnloading();
 		CheckFontsUnloading();
@@ -273,10 +272,18 @@ namespace o2
 
 	void Render::Clear(const Color4& color /*= Color4::Blur()*/)
 	{
-		glClearColor(color.RF(), color.GF(), color.BF(), color.AF());
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::Clear).color = color;
+	}
 
-		GL_CHECK_ERROR();
+	void Render::Flush()
+	{
+		PROFILE_SCOPE("Render::Flush");
+
+		DrawPrimitives();
+
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::Finish);
+		SubmitCommands();
+		WaitCommandsExecuted();
 	}
 
 	void Render::UpdateCameraTransforms()
@@ -285,31 +292,14 @@ namespace o2
 
 		Vec2F resf = (Vec2F)mCurrentResolution;
 
-		glMatrixMode(GL_MODELVIEW);
-		float modelMatrix[16] =
-		{
-			1,           0,            0, 0,
-			0,          -1,            0, 0,
-			0,           0,            1, 0,
-			Math::Round(resf.x*0.5f), Math::Round(resf.y*0.5f), -1, 1
-		};
-
-		glLoadMatrixf(modelMatrix);
-
 		Basis defaultCameraBasis((Vec2F)mCurrentResolution*-0.5f, Vec2F::Right()*resf.x, Vec2F().Up()*resf.y);
 		Basis camTransf = mCamera.GetBasis().Inverted()*defaultCameraBasis;
 		mViewScale = Vec2F(camTransf.xv.Length(), camTransf.yv.Length());
 		mInvViewScale = Vec2F(1.0f / mViewScale.x, 1.0f / mViewScale.y);
 
-		float camTransfMatr[16] =
-		{
-			camTransf.xv.x,   camTransf.xv.y,   0, 0,
-			camTransf.yv.x,   camTransf.yv.y,   0, 0,
-			0,                0,                0, 0,
-			camTransf.origin.x, camTransf.origin.y, 0, 1
-		};
-
-		glMultMatrixf(camTransfMatr);
+		auto& command = mRecordingCommands->Add(RenderCommandBuffer::CommandType::SetCameraTransform);
+		command.size = mCurrentResolution;
+		command.basis = camTransf;
 	}
 
 	void Render::BeginRenderToStencilBuffer()
@@ -318,13 +308,7 @@ namespace o2
 			return;
 
 		DrawPrimitives();
-
-		glEnable(GL_STENCIL_TEST);
-		glStencilFunc(GL_ALWAYS, 0x1, 0xffffffff);
-		glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-
-		GL_CHECK_ERROR();
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::BeginStencilDrawing);
 
 		mStencilDrawing = true;
 	}
@@ -335,11 +319,7 @@ namespace o2
 			return;
 
 		DrawPrimitives();
-
-		glDisable(GL_STENCIL_TEST);
-		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-
-		GL_CHECK_ERROR();
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::EndStencilDrawing);
 
 		mStencilDrawing = false;
 	}
@@ -350,11 +330,7 @@ namespace o2
 			return;
 
 		DrawPrimitives();
-
-		glEnable(GL_STENCIL_TEST);
-		glStencilFunc(GL_EQUAL, 0x1, 0xffffffff);
-
-		GL_CHECK_ERROR();
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::EnableStencilTest);
 
 		mStencilTest = true;
 	}
@@ -365,18 +341,14 @@ namespace o2
 			return;
 
 		DrawPrimitives();
-
-		glDisable(GL_STENCIL_TEST);
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::DisableStencilTest);
 
 		mStencilTest = false;
 	}
 
 	void Render::ClearStencil()
 	{
-		glClearStencil(0);
-		glClear(GL_STENCIL_BUFFER_BIT);
-
-		GL_CHECK_ERROR();
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::ClearStencil);
 	}
 
 	void Render::EnableScissorTest(const RectI& rect)
@@ -396,24 +368,22 @@ namespace o2
 			}
 			else
 			{
-				glEnable(GL_SCISSOR_TEST);
-				GL_CHECK_ERROR();
+				mRecordingCommands->Add(RenderCommandBuffer::CommandType::EnableScissorTest);
 				mClippingEverything = false;
 			}
 		}
 		else
 		{
-			glEnable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR();
+			mRecordingCommands->Add(RenderCommandBuffer::CommandType::EnableScissorTest);
 			mClippingEverything = false;
 		}
 
 		mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
 		mStackScissors.Add(ScissorStackEntry(rect, summaryScissorRect));
-		
-		RectI screenScissorRect = CalculateScreenSpaceScissorRect(summaryScissorRect);
-		glScissor((int)(screenScissorRect.left + mCurrentResolution.x*0.5f), (int)(screenScissorRect.bottom + mCurrentResolution.y*0.5f),
-				  (int)screenScissorRect.Width(), (int)screenScissorRect.Height());
+
+		auto& command = mRecordingCommands->Add(RenderCommandBuffer::CommandType::SetScissorRect);
+		command.rect = CalculateScreenSpaceScissorRect(summaryScissorRect);
+		command.size = mCurrentResolution;
 	}
 
 	void Render::DisableScissorTest(bool forcible /*= false*/)
@@ -428,8 +398,7 @@ namespace o2
 
 		if (forcible)
 		{
-			glDisable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR();
+			mRecordingCommands->Add(RenderCommandBuffer::CommandType::DisableScissorTest);
 
 			while (!mStackScissors.IsEmpty() && !mStackScissors.Last().mRenderTarget)
 				mStackScissors.PopBack();
@@ -440,8 +409,7 @@ namespace o2
 		{
 			if (mStackScissors.Count() == 1)
 			{
-				glDisable(GL_SCISSOR_TEST);
-				GL_CHECK_ERROR();
+				mRecordingCommands->Add(RenderCommandBuffer::CommandType::DisableScissorTest);
 				mStackScissors.PopBack();
 
 				mScissorInfos.Last().mEndDepth = mDrawingDepth;
@@ -457,15 +425,14 @@ namespace o2
 
 				if (mStackScissors.Last().mRenderTarget)
 				{
-					glDisable(GL_SCISSOR_TEST);
-					GL_CHECK_ERROR();
+					mRecordingCommands->Add(RenderCommandBuffer::CommandType::DisableScissorTest);
 					mClippingEverything = false;
 				}
 				else
 				{
-					RectI screenScissorRect = CalculateScreenSpaceScissorRect(lastClipRect);
-					glScissor((int)(screenScissorRect.left + mCurrentResolution.x*0.5f), (int)(screenScissorRect.bottom + mCurrentResolution.y*0.5f),
-						      (int)screenScissorRect.Width(), (int)screenScissorRect.Height());
+					auto& command = mRecordingCommands->Add(RenderCommandBuffer::CommandType::SetScissorRect);
+					command.rect = CalculateScreenSpaceScissorRect(lastClipRect);
+					command.size = mCurrentResolution;
 
 					mClippingEverything = lastClipRect == RectI();
 				}
@@ -473,58 +440,614 @@ namespace o2
 		}
 	}
 
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::SubmitBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							  UInt16* indexes, UInt elementsCount, Texture* texture)
 	{
-		if (!mReady)
-			return;
-
-		mDrawingDepth += 1.0f;
-
-		if (mClippingEverything)
-			return;
-
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount * 2;
 		else
 			indexesCount = elementsCount * 3;
 
-		if (mLastDrawTexture != texture.mTexture ||
+		if (mLastDrawTexture != texture ||
 			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
 			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
 			mCurrentPrimitiveType != primitiveType)
 		{
 			DrawPrimitives();
 
-			mLastDrawTexture = texture.mTexture;
+			mLastDrawTexture = texture;
 			mCurrentPrimitiveType = primitiveType;
+		}
+
+		mRecordingCommands->AddVertices(vertices, verticesCount);
+		mRecordingCommands->AddIndexes(indexes, indexesCount, mLastDrawVertex);
+
+		if (primitiveType != PrimitiveType::Line)
+			mTrianglesCount += elementsCount;
+
+		mLastDrawVertex += verticesCount;
+		mLastDrawIdx += indexesCount;
+	}
+
+	void RenderBase::InitializeExecutingContext()
+	{
+		glEnableClientState(GL_COLOR_ARRAY);
+		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+		glEnableClientState(GL_VERTEX_ARRAY);
+
+		InitializeStreamBuffers();
+
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+		glLineWidth(1.0f);
+
+		// Rows of RGB and alpha textures data aren't aligned by 4 bytes
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+		GL_CHECK_ERROR();
+	}
+
+	void RenderBase::DeinitializeExecutingContext()
+	{
+		for (auto& kv : mRenderTargetsFrameBuffers)
+			glDeleteFramebuffersEXT(1, &kv.second);
+
+		mRenderTargetsFrameBuffers.Clear();
+
+		DeinitializeStreamBuffers();
+	}
+
+	bool RenderBase::StartRenderThread()
+	{
+		mRenderGLContext = wglCreateContext(mHDC);
+		if (!mRenderGLContext)
+			return false;
+
+		if (!wglShareLists(mGLContext, mRenderGLContext))
+		{
+			wglDeleteContext(mRenderGLContext);
+			mRenderGLContext = nullptr;
+			return false;
+		}
+
+		mRenderThreadEnabled = true;
+		mRenderThreadExit = false;
+
+		// Empty buffer is given to thread, so we can wait until it initializes context
+		mExecutingCommands = &mCommandBuffers[1];
+		mRenderThread = std::thread(&RenderBase::RenderThreadLoop, this);
+
+		WaitCommandsExecuted();
+
+		return true;
+	}
+
+	void RenderBase::StopRenderThread()
+	{
+		if (!mRenderThreadEnabled)
+			return;
+
+		SubmitCommands();
+		WaitCommandsExecuted();
+
+		{
+			std::unique_lock<std::mutex> lock(mRenderThreadMutex);
+			mRenderThreadExit = true;
+		}
+
+		mRenderThreadCondition.notify_all();
+		mRenderThread.join();
+
+		mRenderThreadEnabled = false;
+	}
+
+	void RenderBase::RenderThreadLoop()
+	{
+		wglMakeCurrent(mHDC, mRenderGLContext);
+		InitializeExecutingContext();
+
+		std::unique_lock<std::mutex> lock(mRenderThreadMutex);
+		while (true)
+		{
+			mRenderThreadCondition.wait(lock, [&]() { return mExecutingCommands || mRenderThreadExit; });
+
+			if (!mExecutingCommands)
+				break;
+
+			lock.unlock();
+			ExecuteCommands(*mExecutingCommands);
+			lock.lock();
+
+			mExecutingCommands = nullptr;
+			mRenderThreadCondition.notify_all();
+		}
+
+		lock.unlock();
+
+		DeinitializeExecutingContext();
+
+		wglMakeCurrent(NULL, NULL);
+		wglDeleteContext(mRenderGLContext);
+		mRenderGLContext = nullptr;
+	}
+
+	void RenderBase::SubmitCommands()
+	{
+		PROFILE_SCOPE("Render::SubmitCommands");
+
+		if (!mRenderThreadEnabled)
+		{
+			ExecuteCommands(*mRecordingCommands);
+			mRecordingCommands->Clear();
+			return;
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(mRenderThreadMutex);
+			mRenderThreadCondition.wait(lock, [&]() { return mExecutingCommands == nullptr; });
+
+			mExecutingCommands = mRecordingCommands;
+			mRecordingCommands = mRecordingCommands == &mCommandBuffers[0] ? &mCommandBuffers[1] : &mCommandBuffers[0];
+		}
 
-			if (primitiveType == PrimitiveType::PolygonWire)
+		mRenderThreadCondition.notify_all();
+
+		mRecordingCommands->Clear();
+	}
+
+	void RenderBase::WaitCommandsExecuted()
+	{
+		if (!mRenderThreadEnabled)
+			return;
+
+		std::unique_lock<std::mutex> lock(mRenderThreadMutex);
+		mRenderThreadCondition.wait(lock, [&]() { return mExecutingCommands == nullptr; });
+	}
+
+	void RenderBase::ExecuteCommands(const RenderCommandBuffer& buffer)
+	{
+		typedef RenderCommandBuffer::CommandType CommandType;
+
+		PROFILE_SCOPE("Render::ExecuteCommands");
+
+		// Textures can be bound by reading textures data on same context, so binding is restored on first drawing
+		mExecutingTexture = UINT_MAX;
+
+		for (auto& command : buffer.GetCommands())
+		{
+			switch (command.type)
+			{
+				case CommandType::Clear:
+				glClearColor(command.color.RF(), command.color.GF(), command.color.BF(), command.color.AF());
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+				break;
+
+				case CommandType::ClearStencil:
+				glClearStencil(0);
+				glClear(GL_STENCIL_BUFFER_BIT);
+				break;
+
+				case CommandType::SetViewMatrix:
+				ExecuteSetViewMatrix(command);
+				break;
+
+				case CommandType::SetCameraTransform:
+				ExecuteSetCameraTransform(command);
+				break;
+
+				case CommandType::BeginStencilDrawing:
+				glEnable(GL_STENCIL_TEST);
+				glStencilFunc(GL_ALWAYS, 0x1, 0xffffffff);
+				glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+				glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+				break;
+
+				case CommandType::EndStencilDrawing:
+				glDisable(GL_STENCIL_TEST);
+				glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+				break;
+
+				case CommandType::EnableStencilTest:
+				glEnable(GL_STENCIL_TEST);
+				glStencilFunc(GL_EQUAL, 0x1, 0xffffffff);
+				break;
+
+				case CommandType::DisableStencilTest:
+				glDisable(GL_STENCIL_TEST);
+				break;
+
+				case CommandType::EnableScissorTest:
+				glEnable(GL_SCISSOR_TEST);
+				break;
+
+				case CommandType::SetScissorRect:
+				glScissor((int)(command.rect.left + command.size.x*0.5f), (int)(command.rect.bottom + command.size.y*0.5f),
+						  (int)command.rect.Width(), (int)command.rect.Height());
+				break;
+
+				case CommandType::DisableScissorTest:
+				glDisable(GL_SCISSOR_TEST);
+				break;
+
+				case CommandType::BindRenderTarget:
+				ExecuteBindRenderTarget(command);
+				break;
+
+				case CommandType::UnbindRenderTarget:
+				glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
+				break;
+
+				case CommandType::Draw:
+				ExecuteDraw(buffer, command);
+				break;
+
+				case CommandType::TextureImage:
+				case CommandType::TextureSubImage:
+				ExecuteUploadTexture(buffer, command);
+				break;
+
+				case CommandType::TextureParameters:
+				ExecuteSetTextureParameters(command);
+				break;
+
+				case CommandType::CopyTexture:
+				glBindTexture(GL_TEXTURE_2D, command.texture);
+				glCopyTexImage2D(GL_TEXTURE_2D, 0, GetGLPixelFormat(command.format), command.rect.left, command.rect.top,
+								 command.rect.Width(), command.rect.Height(), 0);
+				mExecutingTexture = UINT_MAX;
+				break;
+
+				case CommandType::DeleteTexture:
+				ExecuteDeleteTexture(command);
+				break;
+
+				case CommandType::Present:
+				SwapBuffers(mHDC);
+				break;
+
+				case CommandType::Finish:
+				glFinish();
+				break;
+			}
+
+			GL_CHECK_ERROR();
+		}
+	}
+
+	void RenderBase::ExecuteSetViewMatrix(const RenderCommandBuffer::Command& command)
+	{
+		float projMat[16];
+		Math::OrthoProjMatrix(projMat, 0.0f, (float)command.size.x, (float)command.size.y, 0.0f, 0.0f, 10.0f);
+		glMatrixMode(GL_PROJECTION);
+		glLoadIdentity();
+		glViewport(0, 0, command.size.x, command.size.y);
+		glLoadMatrixf(projMat);
+	}
+
+	void RenderBase::ExecuteSetCameraTransform(const RenderCommandBuffer::Command& command)
+	{
+		Vec2F resf = (Vec2F)command.size;
+
+		glMatrixMode(GL_MODELVIEW);
+		float modelMatrix[16] =
+		{
+			1,           0,            0, 0,
+			0,          -1,            0, 0,
+			0,           0,            1, 0,
+			Math::Round(resf.x*0.5f), Math::Round(resf.y*0.5f), -1, 1
+		};
+
+		glLoadMatrixf(modelMatrix);
+
+		const Basis& camTransf = command.basis;
+		float camTransfMatr[16] =
+		{
+			camTransf.xv.x,   camTransf.xv.y,   0, 0,
+			camTransf.yv.x,   camTransf.yv.y,   0, 0,
+			0,                0,                0, 0,
+			camTransf.origin.x, camTransf.origin.y, 0, 1
+		};
+
+		glMultMatrixf(camTransfMatr);
+	}
+
+	void RenderBase::ExecuteDraw(const RenderCommandBuffer& buffer, const RenderCommandBuffer::Command& command)
+	{
+		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
+
+		if (mExecutingPrimitiveType != command.primitiveType)
+		{
+			if (command.primitiveType == PrimitiveType::PolygonWire)
 				glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 			else
 				glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 
-			if (mLastDrawTexture)
+			mExecutingPrimitiveType = command.primitiveType;
+		}
+
+		if (mExecutingTexture != command.texture)
+		{
+			if (command.texture)
 			{
 				glEnable(GL_TEXTURE_2D);
-				glBindTexture(GL_TEXTURE_2D, mLastDrawTexture->mHandle);
-
-				GL_CHECK_ERROR();
+				glBindTexture(GL_TEXTURE_2D, command.texture);
 			}
 			else glDisable(GL_TEXTURE_2D);
+
+			mExecutingTexture = command.texture;
 		}
 
-		memcpy(&mVertexData[mLastDrawVertex * sizeof(Vertex2)], vertices, sizeof(Vertex2)*verticesCount);
+		const Vertex2* vertices = &buffer.GetVertices()[command.vertexOffset];
+		const UInt16* indexes = &buffer.GetIndexes()[command.indexOffset];
 
-		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount; i++, j++)
-			mVertexIndexData[i] = mLastDrawVertex + indexes[j];
+		if (mStreamBuffersAvailable)
+			MapStreamBuffers();
 
-		if (primitiveType != PrimitiveType::Line)
-			mTrianglesCount += elementsCount;
+		if (mStreamBuffersAvailable)
+		{
+			memcpy(mVertexData, vertices, sizeof(Vertex2)*command.verticesCount);
+			memcpy(mVertexIndexData, indexes, sizeof(UInt16)*command.indexesCount);
 
-		mLastDrawVertex += verticesCount;
-		mLastDrawIdx += indexesCount;
+			UnmapStreamBuffers(command.verticesCount, command.indexesCount);
+
+			glDrawElements(primitiveType[(int)command.primitiveType], command.indexesCount, GL_UNSIGNED_SHORT,
+						   (void*)(mIndexStreamOffset*sizeof(UInt16)));
+
+			AdvanceStreamBuffers(command.verticesCount, command.indexesCount);
+		}
+		else
+		{
+			BindVertexPointers((const UInt8*)vertices);
+			glDrawElements(primitiveType[(int)command.primitiveType], command.indexesCount, GL_UNSIGNED_SHORT, indexes);
+		}
+	}
+
+	void RenderBase::ExecuteBindRenderTarget(const RenderCommandBuffer::Command& command)
+	{
+		auto fnd = mRenderTargetsFrameBuffers.find(command.texture);
+		if (fnd != mRenderTargetsFrameBuffers.end())
+		{
+			glBindFramebufferEXT(GL_FRAMEBUFFER, fnd->second);
+			return;
+		}
+
+		// Frame buffers aren't shared between contexts, so they're created by executing context
+		GLuint frameBuffer = 0;
+		glGenFramebuffersEXT(1, &frameBuffer);
+		glBindFramebufferEXT(GL_FRAMEBUFFER, frameBuffer);
+
+		glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, command.texture, 0);
+
+		GLenum drawBuffers[1] = { GL_COLOR_ATTACHMENT0 };
+		glDrawBuffers(1, drawBuffers);
+
+		if (glCheckFramebufferStatusEXT(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			GLenum glError = glGetError();
+			o2Debug.LogError("Failed to create GL frame buffer object! GL Error %i %s", glError, GetGLErrorDesc(glError));
+
+			glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
+			glDeleteFramebuffersEXT(1, &frameBuffer);
+
+			return;
+		}
+
+		mRenderTargetsFrameBuffers[command.texture] = frameBuffer;
+	}
+
+	void RenderBase::ExecuteUploadTexture(const RenderCommandBuffer& buffer, const RenderCommandBuffer::Command& command)
+	{
+		GLint texFormat = GetGLPixelFormat(command.format);
+
+		const UInt8* data = nullptr;
+		if (command.dataOffset != RenderCommandBuffer::NoData)
+			data = &buffer.GetTexturesData()[command.dataOffset];
+
+		glBindTexture(GL_TEXTURE_2D, command.texture);
+
+		if (command.type == RenderCommandBuffer::CommandType::TextureImage)
+		{
+			glTexImage2D(GL_TEXTURE_2D, 0, texFormat, (GLsizei)command.size.x, (GLsizei)command.size.y, 0, texFormat,
+						 GL_UNSIGNED_BYTE, data);
+		}
+		else
+		{
+			glTexSubImage2D(GL_TEXTURE_2D, 0, command.offset.x, command.offset.y, command.size.x, command.size.y, texFormat,
+							GL_UNSIGNED_BYTE, data);
+		}
+
+		mExecutingTexture = UINT_MAX;
+	}
+
+	void RenderBase::ExecuteSetTextureParameters(const RenderCommandBuffer::Command& command)
+	{
+		GLint filter = command.nearestFilter ? GL_NEAREST : GL_LINEAR;
+
+		glBindTexture(GL_TEXTURE_2D, command.texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+
+		mExecutingTexture = UINT_MAX;
+	}
+
+	void RenderBase::ExecuteDeleteTexture(const RenderCommandBuffer::Command& command)
+	{
+		auto fnd = mRenderTargetsFrameBuffers.find(command.texture);
+		if (fnd != mRenderTargetsFrameBuffers.end())
+		{
+			glDeleteFramebuffersEXT(1, &fnd->second);
+			mRenderTargetsFrameBuffers.erase(fnd);
+		}
+
+		glDeleteTextures(1, &command.texture);
+
+		if (mExecutingTexture == command.texture)
+			mExecutingTexture = UINT_MAX;
+	}
+
+	void RenderBase::ReleaseTexture(GLuint handle)
+	{
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::DeleteTexture).texture = handle;
+	}
+
+	void RenderBase::RecordTextureImage(GLuint handle, PixelFormat format, const Vec2I& size, const UInt8* data)
+	{
+		UInt bytesPerPixel = format == PixelFormat::R8G8B8A8 ? 4 : (format == PixelFormat::R8G8B8 ? 3 : 1);
+		UInt dataOffset = RenderCommandBuffer::NoData;
+		if (data)
+			dataOffset = mRecordingCommands->AddTextureData(data, size.x*size.y*bytesPerPixel);
+
+		auto& command = mRecordingCommands->Add(RenderCommandBuffer::CommandType::TextureImage);
+		command.texture = handle;
+		command.format = format;
+		command.size = size;
+		command.dataOffset = dataOffset;
+	}
+
+	void RenderBase::RecordTextureSubImage(GLuint handle, PixelFormat format, const Vec2I& offset, const Vec2I& size,
+										   const UInt8* data)
+	{
+		UInt bytesPerPixel = format == PixelFormat::R8G8B8A8 ? 4 : (format == PixelFormat::R8G8B8 ? 3 : 1);
+		UInt dataOffset = mRecordingCommands->AddTextureData(data, size.x*size.y*bytesPerPixel);
+
+		auto& command = mRecordingCommands->Add(RenderCommandBuffer::CommandType::TextureSubImage);
+		command.texture = handle;
+		command.format = format;
+		command.offset = offset;
+		command.size = size;
+		command.dataOffset = dataOffset;
+	}
+
+	void RenderBase::RecordTextureParameters(GLuint handle, bool nearestFilter)
+	{
+		auto& command = mRecordingCommands->Add(RenderCommandBuffer::CommandType::TextureParameters);
+		command.texture = handle;
+		command.nearestFilter = nearestFilter;
+	}
+
+	void RenderBase::InitializeStreamBuffers()
+	{
+		mStreamBuffersAvailable = glGenBuffers && glBindBuffer && glBufferData && glMapBufferRange &&
+			glFlushMappedBufferRange && glUnmapBuffer && glDeleteBuffers;
+
+		if (!mStreamBuffersAvailable)
+			return;
+
+		glGenBuffers(1, &mVertexBufferObject);
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+		glBufferData(GL_ARRAY_BUFFER, mVertexBufferSize*mStreamBatchesCount*sizeof(Vertex2), NULL, GL_STREAM_DRAW);
+
+		glGenBuffers(1, &mIndexBufferObject);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferSize*mStreamBatchesCount*sizeof(UInt16), NULL, GL_STREAM_DRAW);
+
+		GL_CHECK_ERROR();
+
+		mVertexStreamOffset = 0;
+		mIndexStreamOffset = 0;
+		mStreamBuffersMapped = false;
+	}
+
+	void RenderBase::DeinitializeStreamBuffers()
+	{
+		if (!mStreamBuffersAvailable)
+			return;
+
+		if (mStreamBuffersMapped)
+			UnmapStreamBuffers(0, 0);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+		glDeleteBuffers(1, &mVertexBufferObject);
+		glDeleteBuffers(1, &mIndexBufferObject);
+
+		mVertexBufferObject = 0;
+		mIndexBufferObject = 0;
+		mStreamBuffersAvailable = false;
+
+		mVertexData = nullptr;
+		mVertexIndexData = nullptr;
+	}
+
+	void RenderBase::MapStreamBuffers()
+	{
+		if (mStreamBuffersMapped)
+			return;
+
+		// Previous batches can still be in use by GPU, so instead of waiting we're orphaning storage
+		// and driver gives us a fresh one
+		if (mVertexStreamOffset + mVertexBufferSize > mVertexBufferSize*mStreamBatchesCount ||
+			mIndexStreamOffset + mIndexBufferSize > mIndexBufferSize*mStreamBatchesCount)
+		{
+			glBufferData(GL_ARRAY_BUFFER, mVertexBufferSize*mStreamBatchesCount*sizeof(Vertex2), NULL, GL_STREAM_DRAW);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferSize*mStreamBatchesCount*sizeof(UInt16), NULL, GL_STREAM_DRAW);
+
+			mVertexStreamOffset = 0;
+			mIndexStreamOffset = 0;
+		}
+
+		const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+			GL_MAP_FLUSH_EXPLICIT_BIT;
+
+		mVertexData = (UInt8*)glMapBufferRange(GL_ARRAY_BUFFER, mVertexStreamOffset*sizeof(Vertex2),
+											   mVertexBufferSize*sizeof(Vertex2), access);
+
+		mVertexIndexData = (UInt16*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, mIndexStreamOffset*sizeof(UInt16),
+													 mIndexBufferSize*sizeof(UInt16), access);
+
+		mStreamBuffersMapped = true;
+
+		if (!mVertexData || !mVertexIndexData)
+		{
+			o2Debug.LogError("Failed to map streaming buffers, switching to client side buffers");
+
+			DeinitializeStreamBuffers();
+		}
+	}
+
+	void RenderBase::UnmapStreamBuffers(UInt verticesCount, UInt indexesCount)
+	{
+		if (!mStreamBuffersMapped)
+			return;
+
+		if (mVertexData)
+		{
+			glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, verticesCount*sizeof(Vertex2));
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+
+		if (mVertexIndexData)
+		{
+			glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indexesCount*sizeof(UInt16));
+			glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+		}
+
+		mVertexData = nullptr;
+		mVertexIndexData = nullptr;
+		mStreamBuffersMapped = false;
+
+		// Indexes in batch are relative to it's first vertex, so pointers are moved to batch beginning
+		BindVertexPointers((const UInt8*)(mVertexStreamOffset*sizeof(Vertex2)));
+
+		GL_CHECK_ERROR();
+	}
+
+	void RenderBase::AdvanceStreamBuffers(UInt verticesCount, UInt indexesCount)
+	{
+		mVertexStreamOffset += verticesCount;
+		mIndexStreamOffset += indexesCount;
+	}
+
+	void RenderBase::BindVertexPointers(const UInt8* data)
+	{
+		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), data + sizeof(float)*3);
+		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), data + sizeof(float)*3 + sizeof(unsigned long));
+		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), data + 0);
 	}
 
 	void Render::BindRenderTexture(TextureRef renderTarget)
@@ -554,14 +1077,12 @@ namespace o2
 		if (!mStackScissors.IsEmpty())
 		{
 			mScissorInfos.Last().mEndDepth = mDrawingDepth;
-			glDisable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR();
+			mRecordingCommands->Add(RenderCommandBuffer::CommandType::DisableScissorTest);
 		}
 
 		mStackScissors.Add(ScissorStackEntry(RectI(), RectI(), true));
 
-		glBindFramebufferEXT(GL_FRAMEBUFFER, renderTarget->mFrameBuffer);
-		GL_CHECK_ERROR();
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::BindRenderTarget).texture = renderTarget->mHandle;
 
 		SetupViewMatrix(renderTarget->GetSize());
 
@@ -575,8 +1096,7 @@ namespace o2
 
 		DrawPrimitives();
 
-		glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
-		GL_CHECK_ERROR();
+		mRecordingCommands->Add(RenderCommandBuffer::CommandType::UnbindRenderTarget);
 
 		SetupViewMatrix(mResolution);
 
@@ -586,15 +1106,13 @@ namespace o2
 		mStackScissors.PopBack();
 		if (!mStackScissors.IsEmpty())
 		{
-			glEnable(GL_SCISSOR_TEST);
-			GL_CHECK_ERROR();
-
 			auto clipRect = mStackScissors.Last().mSummaryScissorRect;
 
-			glScissor((int)(clipRect.left + mCurrentResolution.x*0.5f),
-				(int)(clipRect.bottom + mCurrentResolution.y*0.5f),
-					  (int)clipRect.Width(),
-					  (int)clipRect.Height());
+			mRecordingCommands->Add(RenderCommandBuffer::CommandType::EnableScissorTest);
+
+			auto& command = mRecordingCommands->Add(RenderCommandBuffer::CommandType::SetScissorRect);
+			command.rect = clipRect;
+			command.size = mCurrentResolution;
 
 			mClippingEverything = clipRect == RectI();
 		}
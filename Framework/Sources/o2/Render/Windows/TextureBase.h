@@ -12,8 +12,7 @@ namespace o2
 		friend class VectorFont;
 
 	protected:
-		GLuint mHandle;      // Texture handle
-		GLuint mFrameBuffer; // Frame buffer for rendering into texture
+		GLuint mHandle; // Texture handle
 	};
 }
 
@@ -13,73 +13,24 @@ namespace o2
 		if (!mReady)
 			return;
 
-		if (mUsage == Usage::RenderTarget)
-			glDeleteFramebuffersEXT(1, &mFrameBuffer);
-
-		glDeleteTextures(1, &mHandle);
+		o2Render.ReleaseTexture(mHandle);
 	}
 
 	void Texture::Create(const Vec2I& size, PixelFormat format /*= Format::R8G8B8A8*/, Usage usage /*= Usage::Default*/)
 	{
 		if (mReady)
-		{
-			if (mUsage == Usage::RenderTarget)
-				glDeleteFramebuffersEXT(1, &mFrameBuffer);
-
-			glDeleteTextures(1, &mHandle);
-		}
+			o2Render.ReleaseTexture(mHandle);
 
 		mFormat = format;
 		mUsage = usage;
 		mSize = size;
 
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
-
+		// Only name is generated here, texture is created by render in order with drawing commands.
+		// Frame buffer of render target is created by render on first binding
 		glGenTextures(1, &mHandle);
-		glBindTexture(GL_TEXTURE_2D, mHandle);
-
-		GLint texFormat = GL_RGB;
-		if (format == PixelFormat::R8G8B8A8)
-			texFormat = GL_RGBA;
-		else if (format == PixelFormat::R8G8B8)
-			texFormat = GL_RGB;
-
-		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, (GLsizei)size.x, (GLsizei)size.y, 0, texFormat, GL_UNSIGNED_BYTE, NULL);
-
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
-		if (mUsage == Usage::RenderTarget)
-		{
-			glGenFramebuffersEXT(1, &mFrameBuffer);
-			glBindFramebufferEXT(GL_FRAMEBUFFER, mFrameBuffer);
-
-			glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, mHandle, 0);
-
-			GLenum DrawBuffers[2] = { GL_COLOR_ATTACHMENT0 };
-			glDrawBuffers(1, DrawBuffers);
-
-			if (glCheckFramebufferStatusEXT(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
-			{
-				GLenum glError = glGetError();
 
-				o2Render.mLog->Error("Failed to create GL frame buffer object! GL Error %i %cs", glError,
-									 GetGLErrorDesc(glError));
-
-				mReady = false;
-				glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
-
-				return;
-			}
-
-			mReady = true;
-
-			glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
-		}
-
-		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
+		o2Render.RecordTextureImage(mHandle, mFormat, mSize, nullptr);
+		o2Render.RecordTextureParameters(mHandle, false);
 
 		mReady = true;
 	}
@@ -87,105 +38,54 @@ namespace o2
 	void Texture::Create(Bitmap* bitmap)
 	{
 		if (mReady)
-		{
-			if (mUsage == Usage::RenderTarget)
-				glDeleteFramebuffersEXT(1, &mFrameBuffer);
-
-			glDeleteTextures(1, &mHandle);
-		}
+			o2Render.ReleaseTexture(mHandle);
 
 		mFormat = bitmap->GetFormat();
 		mUsage = Usage::Default;
 		mSize = bitmap->GetSize();
 		mFileName = bitmap->GetFilename();
 
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
-
 		glGenTextures(1, &mHandle);
-		glBindTexture(GL_TEXTURE_2D, mHandle);
-
-		GLint texFormat = GL_RGB;
-		if (mFormat == PixelFormat::R8G8B8A8)
-			texFormat = GL_RGBA;
-		else if (mFormat == PixelFormat::R8G8B8)
-			texFormat = GL_RGB;
-
-		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, bitmap->GetSize().x, bitmap->GetSize().y, 0, texFormat, GL_UNSIGNED_BYTE,
-					 bitmap->GetData());
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
-		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
+		o2Render.RecordTextureImage(mHandle, mFormat, mSize, bitmap->GetData());
+		o2Render.RecordTextureParameters(mHandle, false);
 
 		mReady = true;
 	}
 
 	void Texture::SetData(Bitmap* bitmap)
 	{
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
-		glBindTexture(GL_TEXTURE_2D, mHandle);
-
-		GLint texFormat = GL_RGB;
-		if (mFormat == PixelFormat::R8G8B8A8)
-			texFormat = GL_RGBA;
-		else if (mFormat == PixelFormat::R8G8B8)
-			texFormat = GL_RGB;
-
 		mSize = bitmap->GetSize();
-
-		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, bitmap->GetSize().x, bitmap->GetSize().y, 0, texFormat, GL_UNSIGNED_BYTE,
-					 bitmap->GetData());
-
-		GL_CHECK_ERROR();
-
-		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
+		o2Render.RecordTextureImage(mHandle, mFormat, mSize, bitmap->GetData());
 	}
 
 	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
 	{
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
-		glBindTexture(GL_TEXTURE_2D, mHandle);
-
-		GLint texFormat = GL_RGB;
-		if (mFormat == PixelFormat::R8G8B8A8)
-			texFormat = GL_RGBA;
-		else if (mFormat == PixelFormat::R8G8B8)
-			texFormat = GL_RGB;
-
-		glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, bitmap->GetSize().x, bitmap->GetSize().y, texFormat, GL_UNSIGNED_BYTE,
-						bitmap->GetData());
-
-		GL_CHECK_ERROR();
-
-		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
+		o2Render.RecordTextureSubImage(mHandle, mFormat, offset, bitmap->GetSize(), bitmap->GetData());
 	}
 
 	void Texture::Copy(const Texture& from, const RectI& rect)
 	{
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
-		glBindTexture(GL_TEXTURE_2D, from.mHandle);
-
-		GLint texFormat = GL_RGB;
-		if (mFormat == PixelFormat::R8G8B8A8)
-			texFormat = GL_RGBA;
-		else if (mFormat == PixelFormat::R8G8B8)
-			texFormat = GL_RGB;
+		// Copying reads bound frame buffer, so it is executed in order with drawing commands
+		o2Render.DrawPrimitives();
 
-		glCopyTexImage2D(GL_TEXTURE_2D, 0, texFormat, rect.left, rect.top, rect.Width(), rect.Height(), 0);
-		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
+		auto& command = o2Render.mRecordingCommands->Add(RenderCommandBuffer::CommandType::CopyTexture);
+		command.texture = from.mHandle;
+		command.rect = rect;
+		command.format = mFormat;
 	}
 
 	Bitmap* Texture::GetData()
 	{
 		Bitmap* bitmap = mnew Bitmap(mFormat, mSize);
 
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		// Texture can be rendered by not executed yet commands
+		o2Render.Flush();
+
 		glBindTexture(GL_TEXTURE_2D, mHandle);
-		glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, bitmap->GetData());
-		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glGetTexImage(GL_TEXTURE_2D, 0, GetGLPixelFormat(mFormat), GL_UNSIGNED_BYTE, bitmap->GetData());
+		glBindTexture(GL_TEXTURE_2D, 0);
 
 		return bitmap;
 	}
@@ -194,20 +94,9 @@ namespace o2
 	{
 		mFilter = filter;
 
-		GLint type = GL_LINEAR;
-		if (mFilter == Filter::Nearest)
-			type = GL_NEAREST;
-
-		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
+		// Batched primitives are drawn with previous filter
 		o2Render.DrawPrimitives();
-
-		glBindTexture(GL_TEXTURE_2D, mHandle);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, type);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, type);
-
-		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
-
-		GL_CHECK_ERROR();
+		o2Render.RecordTextureParameters(mHandle, mFilter == Filter::Nearest);
 	}
 
 	Texture::Filter Texture::GetFilter() const
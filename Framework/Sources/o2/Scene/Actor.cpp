@@ -2,6 +2,7 @@
 #include "Actor.h"
 
 #include "o2/Scene/ActorDataValueConverter.h"
+#include "o2/Scene/ActorTransformsHierarchy.h"
 #include "o2/Scene/Component.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Scene/SceneLayer.h"
@@ -195,8 +196,12 @@ namespace o2
 
 		OnUpdate(dt);
 
-		for (auto comp : mComponents)
-			comp->Update(dt);
+		// Components of actors on scene are updated by scene update lists
+		if (mSceneStatus != SceneStatus::InScene)
+		{
+			for (auto comp : mComponents)
+				comp->Update(dt);
+		}
 	}
 
 	void Actor::FixedUpdate(float dt)
@@ -260,7 +265,11 @@ namespace o2
 
 	void Actor::SetID(SceneUID id)
 	{
+		SceneUID oldId = mId;
 		mId = id;
+
+		if (Scene::IsSingletonInitialzed())
+			o2Scene.OnActorIdChanged(this, oldId);
 	}
 
 	UID Actor::GetAssetID() const
@@ -278,7 +287,7 @@ namespace o2
 
 	void Actor::GenerateNewID(bool withChildren /*= true*/)
 	{
-		mId = Math::Random();
+		SetID(Math::Random());
 
 		if (withChildren)
 		{
@@ -439,6 +448,8 @@ namespace o2
 		mParent = actor;
 		transform->mData->parentInvTransformActualFrame = 0;
 
+		ActorTransformsHierarchy::Invalidate();
+
 		if (mParent)
 		{
 			mParent->mChildren.Add(this);
@@ -554,6 +565,8 @@ namespace o2
 		actor->mParent = nullptr;
 		mChildren.Remove(actor);
 
+		ActorTransformsHierarchy::Invalidate();
+
 		actor->OnParentChanged(oldParent);
 		OnChildRemoved(actor);
 		OnChildrenChanged();
@@ -581,6 +594,7 @@ namespace o2
 
 		mChildren.Clear();
 
+		ActorTransformsHierarchy::Invalidate();
 		OnChildrenChanged();
 	}
 
@@ -923,7 +937,7 @@ namespace o2
 		if (ActorDataValueConverter::Instance().mLockDepth == 0)
 			ActorDataValueConverter::Instance().ActorCreated(this);
 
-		mId = node.GetMember("Id");
+		SetID(node.GetMember("Id"));
 		mName = node.GetMember("Name");
 
 		if (auto lockedNode = node.FindMember("Locked"))
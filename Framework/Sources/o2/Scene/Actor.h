@@ -603,6 +603,7 @@ namespace o2
 		friend class ActorDataValueConverter;
 		friend class ActorRef;
 		friend class ActorTransform;
+		friend class ActorTransformsHierarchy;
 		friend class Component;
 		friend class DrawableComponent;
 		friend class ISceneDrawable;
@@ -1,8 +1,8 @@
 #include "o2/stdafx.h"
 #include "ActorTransform.h"
 
-#include "o2/Application/Input.h"
 #include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransformsHierarchy.h"
 
 namespace o2
 {
@@ -41,6 +41,9 @@ namespace o2
 
 	ActorTransform::~ActorTransform()
 	{
+		if (mData->hierarchyIdx >= 0)
+			ActorTransformsHierarchy::OnTransformDestroyed(mData);
+
 		delete mData;
 	}
 
@@ -680,6 +683,9 @@ namespace o2
 		mData->dirtyFrame = o2Time.GetCurrentFrame();
 		mData->updateFrame = 0;
 
+		if (mData->hierarchyIdx >= 0)
+			ActorTransformsHierarchy::SetDirty(mData->hierarchyIdx);
+
 		if (mData->owner && !fromParent)
 		{
 			mData->owner->OnChanged();
@@ -699,54 +705,68 @@ namespace o2
 
 	void ActorTransform::UpdateRectangle()
 	{
-		Vec2F leftBottom = mData->position - mData->size*mData->pivot;
-		Vec2F rightTop = leftBottom + mData->size;
-		mData->rectangle.left = leftBottom.x;
-		mData->rectangle.right = rightTop.x;
-		mData->rectangle.bottom = leftBottom.y;
-		mData->rectangle.top = rightTop.y;
-
-		if (o2Input.IsKeyDown(VK_F5))
-			o2Debug.Log("--" + mData->owner->mName + " " + (String)o2Time.GetCurrentFrame());
+		CalculateRectangle(*mData);
 	}
 
 	void ActorTransform::UpdateTransform()
 	{
-		mData->nonSizedTransform = Basis::Build(mData->position, mData->scale, mData->angle, mData->shear);
-		mData->transform.Set(mData->nonSizedTransform.origin, mData->nonSizedTransform.xv * mData->size.x, mData->nonSizedTransform.yv * mData->size.y);
-		mData->transform.origin = mData->transform.origin - mData->transform.xv*mData->pivot.x - mData->transform.yv*mData->pivot.y;
+		CalculateTransform(*mData);
 	}
 
 	void ActorTransform::UpdateWorldRectangleAndTransform()
 	{
 		if (mData->owner && mData->owner->mParent)
+			CalculateWorldRectangleAndTransform(*mData, mData->owner->mParent->transform->mData);
+		else
+			CalculateWorldRectangleAndTransform(*mData, nullptr);
+	}
+
+	void ActorTransform::CalculateRectangle(ActorTransformData& data)
+	{
+		Vec2F leftBottom = data.position - data.size*data.pivot;
+		Vec2F rightTop = leftBottom + data.size;
+		data.rectangle.left = leftBottom.x;
+		data.rectangle.right = rightTop.x;
+		data.rectangle.bottom = leftBottom.y;
+		data.rectangle.top = rightTop.y;
+	}
+
+	void ActorTransform::CalculateTransform(ActorTransformData& data)
+	{
+		data.nonSizedTransform = Basis::Build(data.position, data.scale, data.angle, data.shear);
+		data.transform.Set(data.nonSizedTransform.origin, data.nonSizedTransform.xv * data.size.x, data.nonSizedTransform.yv * data.size.y);
+		data.transform.origin = data.transform.origin - data.transform.xv*data.pivot.x - data.transform.yv*data.pivot.y;
+	}
+
+	void ActorTransform::CalculateWorldRectangleAndTransform(ActorTransformData& data, const ActorTransformData* parentData)
+	{
+		if (parentData)
 		{
-			auto parentData = mData->owner->mParent->transform->mData;
-			mData->parentRectangle = parentData->worldRectangle;
-			mData->parentRectangePosition = mData->parentRectangle.LeftBottom() + parentData->size*parentData->pivot;
-			mData->worldRectangle.left   = mData->parentRectangePosition.x + mData->rectangle.left;
-			mData->worldRectangle.right  = mData->parentRectangePosition.x + mData->rectangle.right;
-			mData->worldRectangle.bottom = mData->parentRectangePosition.y + mData->rectangle.bottom;
-			mData->worldRectangle.top    = mData->parentRectangePosition.y + mData->rectangle.top;
-
-			mData->parentTransform = mData->owner->mParent->transform->mData->worldNonSizedTransform;
-			mData->worldNonSizedTransform = mData->nonSizedTransform*mData->parentTransform;
-			mData->worldTransform = mData->transform*mData->parentTransform;
+			data.parentRectangle = parentData->worldRectangle;
+			data.parentRectangePosition = data.parentRectangle.LeftBottom() + parentData->size*parentData->pivot;
+			data.worldRectangle.left   = data.parentRectangePosition.x + data.rectangle.left;
+			data.worldRectangle.right  = data.parentRectangePosition.x + data.rectangle.right;
+			data.worldRectangle.bottom = data.parentRectangePosition.y + data.rectangle.bottom;
+			data.worldRectangle.top    = data.parentRectangePosition.y + data.rectangle.top;
+
+			data.parentTransform = parentData->worldNonSizedTransform;
+			data.worldNonSizedTransform = data.nonSizedTransform*data.parentTransform;
+			data.worldTransform = data.transform*data.parentTransform;
 		}
 		else
 		{
-			mData->parentRectangle.left = 0; mData->parentRectangle.right = 0;
-			mData->parentRectangle.bottom = 0; mData->parentRectangle.top = 0;
-
-			mData->parentRectangePosition = Vec2F();
-			mData->worldRectangle.left   = mData->parentRectangePosition.x + mData->rectangle.left;
-			mData->worldRectangle.right  = mData->parentRectangePosition.x + mData->rectangle.right;
-			mData->worldRectangle.bottom = mData->parentRectangePosition.y + mData->rectangle.bottom;
-			mData->worldRectangle.top    = mData->parentRectangePosition.y + mData->rectangle.top;
-
-			mData->parentTransform = Basis::Identity();
-			mData->worldNonSizedTransform = mData->nonSizedTransform;
-			mData->worldTransform = mData->transform;
+			data.parentRectangle.left = 0; data.parentRectangle.right = 0;
+			data.parentRectangle.bottom = 0; data.parentRectangle.top = 0;
+
+			data.parentRectangePosition = Vec2F();
+			data.worldRectangle.left   = data.parentRectangePosition.x + data.rectangle.left;
+			data.worldRectangle.right  = data.parentRectangePosition.x + data.rectangle.right;
+			data.worldRectangle.bottom = data.parentRectangePosition.y + data.rectangle.bottom;
+			data.worldRectangle.top    = data.parentRectangePosition.y + data.rectangle.top;
+
+			data.parentTransform = Basis::Identity();
+			data.worldNonSizedTransform = data.nonSizedTransform;
+			data.worldTransform = data.transform;
 		}
 	}
 
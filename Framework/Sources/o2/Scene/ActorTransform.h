@@ -444,6 +444,15 @@ namespace o2
 		// Check parentInvertedTransform for actual
 		void CheckParentInvTransform();
 
+		// Calculates local rectangle by position, size and pivot
+		static void CalculateRectangle(ActorTransformData& data);
+
+		// Calculates local transformation by position, scale, angle, shear, size and pivot
+		static void CalculateTransform(ActorTransformData& data);
+
+		// Calculates world rectangle and transform relative to parent data, or relative to origin when parent data is null
+		static void CalculateWorldRectangleAndTransform(ActorTransformData& data, const ActorTransformData* parentData);
+
 		// Beginning serialization callback, writes data
 		void OnSerialize(DataValue& node) const override;
 
@@ -454,6 +463,7 @@ namespace o2
 		Vec2F GetParentPosition() const;
 
 		friend class Actor;
+		friend class ActorTransformsHierarchy;
 		friend class WidgetLayout;
 	};
 
@@ -487,6 +497,8 @@ namespace o2
 
 		Actor* owner = nullptr; // Owner actor 
 
+		int hierarchyIdx = -1; // Index in scene flattened transforms hierarchy. -1 when transform is updated by owner actor
+
 		SERIALIZABLE(ActorTransformData);
 	};
 }
@@ -665,6 +677,9 @@ CLASS_METHODS_META(o2::ActorTransform)
 	PROTECTED_FUNCTION(void, UpdateTransform);
 	PROTECTED_FUNCTION(void, UpdateRectangle);
 	PROTECTED_FUNCTION(void, CheckParentInvTransform);
+	PROTECTED_STATIC_FUNCTION(void, CalculateRectangle, ActorTransformData&);
+	PROTECTED_STATIC_FUNCTION(void, CalculateTransform, ActorTransformData&);
+	PROTECTED_STATIC_FUNCTION(void, CalculateWorldRectangleAndTransform, ActorTransformData&, const ActorTransformData*);
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(Vec2F, GetParentPosition);
@@ -698,6 +713,7 @@ CLASS_FIELDS_META(o2::ActorTransformData)
 	PUBLIC_FIELD(parentTransform);
 	PUBLIC_FIELD(parentInvTransformActualFrame);
 	PUBLIC_FIELD(owner).DEFAULT_VALUE(nullptr);
+	PUBLIC_FIELD(hierarchyIdx).DEFAULT_VALUE(-1);
 }
 END_META;
 CLASS_METHODS_META(o2::ActorTransformData)
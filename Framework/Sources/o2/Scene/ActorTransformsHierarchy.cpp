@@ -0,0 +1,221 @@
+#include "o2/stdafx.h"
+#include "ActorTransformsHierarchy.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransform.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/Tasks/TaskManager.h"
+
+namespace o2
+{
+	bool ActorTransformsHierarchy::mValid = false;
+	int  ActorTransformsHierarchy::mParallelUpdateThreshold = 1024;
+
+	Vector<ActorTransformsHierarchy::Node> ActorTransformsHierarchy::mNodes;
+	Vector<UInt8>                          ActorTransformsHierarchy::mDirty;
+	Vector<UInt8>                          ActorTransformsHierarchy::mUpdated;
+
+	Vector<int>                             ActorTransformsHierarchy::mSerialNodes;
+	Vector<ActorTransformsHierarchy::Range> ActorTransformsHierarchy::mRanges;
+
+	void ActorTransformsHierarchy::Update(const Vector<Actor*>& rootActors)
+	{
+		PROFILE_SCOPE("ActorTransformsHierarchy::Update");
+
+		if (!mValid)
+			Rebuild(rootActors);
+
+		int count = mNodes.Count();
+		int frame = o2Time.GetCurrentFrame();
+
+		if (count >= mParallelUpdateThreshold && mRanges.Count() > 1 && TaskManager::IsSingletonInitialzed())
+		{
+			// Parents of ranges are updated first, then ranges are independent from each other
+			for (auto idx : mSerialNodes)
+				UpdateNode(idx, frame);
+
+			o2Tasks.ParallelFor(0, mRanges.Count(), [frame](int idx) {
+				UpdateRange(mRanges[idx].begin, mRanges[idx].end, frame);
+			}, 1);
+		}
+		else
+			UpdateRange(0, count, frame);
+
+		NotifyUpdated();
+	}
+
+	void ActorTransformsHierarchy::Invalidate()
+	{
+		mValid = false;
+	}
+
+	int ActorTransformsHierarchy::GetTransformsCount()
+	{
+		return mNodes.Count();
+	}
+
+	void ActorTransformsHierarchy::SetParallelUpdateThreshold(int count)
+	{
+		mParallelUpdateThreshold = count;
+	}
+
+	int ActorTransformsHierarchy::GetParallelUpdateThreshold()
+	{
+		return mParallelUpdateThreshold;
+	}
+
+	void ActorTransformsHierarchy::Rebuild(const Vector<Actor*>& rootActors)
+	{
+		for (auto& node : mNodes)
+		{
+			if (node.data)
+				node.data->hierarchyIdx = -1;
+		}
+
+		mNodes.Clear();
+		mSerialNodes.Clear();
+		mRanges.Clear();
+
+		for (auto actor : rootActors)
+			AddSubtree(actor, -1);
+
+		int count = mNodes.Count();
+		mDirty.Resize(count);
+		mUpdated.Resize(count);
+
+		for (int i = 0; i < count; i++)
+		{
+			mDirty[i] = mNodes[i].data->updateFrame == 0;
+			mUpdated[i] = false;
+		}
+
+		for (int i = 0; i < count; i = mNodes[i].subtreeEnd)
+			SplitSubtree(i);
+
+		mValid = true;
+	}
+
+	void ActorTransformsHierarchy::AddSubtree(Actor* actor, int parentIdx)
+	{
+		if (actor->transform->GetType() != TypeOf(ActorTransform))
+		{
+			if (parentIdx >= 0)
+				mNodes[parentIdx].hasExternalChildren = true;
+
+			return;
+		}
+
+		int idx = mNodes.Count();
+		mNodes.Add(Node{ actor->transform->mData, parentIdx, idx + 1, false });
+		actor->transform->mData->hierarchyIdx = idx;
+
+		for (auto child : actor->mChildren)
+			AddSubtree(child, idx);
+
+		mNodes[idx].subtreeEnd = mNodes.Count();
+	}
+
+	void ActorTransformsHierarchy::SplitSubtree(int idx)
+	{
+		int end = mNodes[idx].subtreeEnd;
+
+		if (end - idx > mJobNodesCount)
+		{
+			mSerialNodes.Add(idx);
+
+			for (int child = idx + 1; child < end; child = mNodes[child].subtreeEnd)
+				SplitSubtree(child);
+
+			return;
+		}
+
+		// Small neighbour subtrees are merged into one job
+		if (!mRanges.IsEmpty() && mRanges.Last().end == idx && end - mRanges.Last().begin <= mJobNodesCount)
+			mRanges.Last().end = end;
+		else
+			mRanges.Add(Range{ idx, end });
+	}
+
+	bool ActorTransformsHierarchy::UpdateNode(int idx, int frame)
+	{
+		const Node& node = mNodes[idx];
+
+		bool parentUpdated = node.parentIdx >= 0 && mUpdated[node.parentIdx];
+		bool dirty = mDirty[idx] && node.data && node.data->updateFrame == 0;
+
+		mDirty[idx] = false;
+
+		if (!node.data || (!dirty && !parentUpdated))
+		{
+			mUpdated[idx] = false;
+			return false;
+		}
+
+		ActorTransformData& data = *node.data;
+		if (!dirty)
+			data.dirtyFrame = frame;
+
+		const ActorTransformData* parentData = node.parentIdx >= 0 ? mNodes[node.parentIdx].data : nullptr;
+
+		ActorTransform::CalculateRectangle(data);
+		ActorTransform::CalculateTransform(data);
+		ActorTransform::CalculateWorldRectangleAndTransform(data, parentData);
+
+		data.updateFrame = data.dirtyFrame;
+		mUpdated[idx] = true;
+
+		return true;
+	}
+
+	void ActorTransformsHierarchy::UpdateRange(int begin, int end, int frame)
+	{
+		for (int i = begin; i < end; i++)
+			UpdateNode(i, frame);
+	}
+
+	void ActorTransformsHierarchy::NotifyUpdated()
+	{
+		PROFILE_SCOPE("ActorTransformsHierarchy::NotifyUpdated");
+
+		// Notifications can destroy actors, their nodes data are cleared then
+		for (int i = 0; i < mNodes.Count(); i++)
+		{
+			if (!mUpdated[i])
+				continue;
+
+			mUpdated[i] = false;
+
+			auto data = mNodes[i].data;
+			if (!data)
+				continue;
+
+			Actor* owner = data->owner;
+
+			if (mNodes[i].hasExternalChildren)
+			{
+				for (auto child : owner->mChildren)
+				{
+					if (child->transform->mData->hierarchyIdx < 0)
+						child->transform->SetDirty(true);
+				}
+			}
+
+			owner->OnTransformUpdated();
+		}
+	}
+
+	void ActorTransformsHierarchy::SetDirty(int idx)
+	{
+		if (idx < mDirty.Count())
+			mDirty[idx] = true;
+	}
+
+	void ActorTransformsHierarchy::OnTransformDestroyed(ActorTransformData* data)
+	{
+		int idx = data->hierarchyIdx;
+		if (idx < mNodes.Count() && mNodes[idx].data == data)
+			mNodes[idx].data = nullptr;
+
+		mValid = false;
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Actor;
+	class ActorTransformData;
+
+	// -------------------------------------------------------------------------------------------------------------
+	// Flattened scene transforms hierarchy. Plain actors transforms are stored in array in hierarchy order, parents
+	// before children, with dense dirty flags. Transforms are updated in one linear pass; independent subtrees are
+	// updated on worker threads when there are enough transforms. Widgets layouts have own update logic, so widgets
+	// and their children aren't included and are updated by actors as before
+	// -------------------------------------------------------------------------------------------------------------
+	class ActorTransformsHierarchy
+	{
+	public:
+		// Updates dirty transforms of root actors and their children, then notifies owners of updated transforms
+		static void Update(const Vector<Actor*>& rootActors);
+
+		// Marks hierarchy as changed, it will be rebuilt on next update
+		static void Invalidate();
+
+		// Returns count of transforms in hierarchy
+		static int GetTransformsCount();
+
+		// Sets minimal count of transforms, that are updated on worker threads
+		static void SetParallelUpdateThreshold(int count);
+
+		// Returns minimal count of transforms, that are updated on worker threads
+		static int GetParallelUpdateThreshold();
+
+	protected:
+		// -------------------------------------------------------------
+		// Hierarchy node: transform data and hierarchy links by indices
+		// -------------------------------------------------------------
+		struct Node
+		{
+			ActorTransformData* data;                // Transform data. Null when transform was destroyed
+			int                 parentIdx;           // Parent node index, -1 for root
+			int                 subtreeEnd;          // Index after the last node of subtree
+			bool                hasExternalChildren; // Has children not in hierarchy, they're marked dirty when node is updated
+		};
+
+		// ----------------------------------------------
+		// Range of independent nodes, updated by one job
+		// ----------------------------------------------
+		struct Range
+		{
+			int begin; // First node index
+			int end;   // Index after the last node
+		};
+
+	protected:
+		static const int mJobNodesCount = 256; // Count of nodes in one update job
+
+		static bool mValid;                   // Is hierarchy actual
+		static int  mParallelUpdateThreshold; // Minimal count of transforms, that are updated on worker threads
+
+		static Vector<Node>  mNodes;   // Nodes in hierarchy order
+		static Vector<UInt8> mDirty;   // Dirty flags of nodes, set by transforms
+		static Vector<UInt8> mUpdated; // Flags of nodes updated at last pass
+
+		static Vector<int>   mSerialNodes; // Nodes with too big subtrees for one job, updated on main thread before ranges
+		static Vector<Range> mRanges;      // Ranges of independent subtrees, updated by jobs
+
+	protected:
+		// Rebuilds nodes from root actors
+		static void Rebuild(const Vector<Actor*>& rootActors);
+
+		// Adds actor and its children into nodes. Widgets aren't added
+		static void AddSubtree(Actor* actor, int parentIdx);
+
+		// Splits subtree into ranges for jobs. Roots of subtrees larger than job go to serial nodes
+		static void SplitSubtree(int idx);
+
+		// Updates dirty node or node with updated parent. Returns true if node was updated
+		static bool UpdateNode(int idx, int frame);
+
+		// Updates nodes in range
+		static void UpdateRange(int begin, int end, int frame);
+
+		// Notifies owners of updated transforms and marks their external children as dirty
+		static void NotifyUpdated();
+
+		// Marks node as dirty. Called by transform
+		static void SetDirty(int idx);
+
+		// Clears destroying transform data from node and invalidates hierarchy
+		static void OnTransformDestroyed(ActorTransformData* data);
+
+		friend class ActorTransform;
+	};
+}
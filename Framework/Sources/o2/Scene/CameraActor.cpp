@@ -42,9 +42,11 @@ namespace o2
 		Camera prevCamera = o2Render.GetCamera();
 		Setup();
 
+		RectF viewRect = o2Render.GetCamera().GetAxisAlignedRect();
+
 		for (auto layer : drawLayers.GetLayers())
 		{
-			for (auto comp : layer->mEnabledDrawables)
+			for (auto comp : layer->GetEnabledDrawablesInRect(viewRect))
 				comp->Draw();
 		}
 
@@ -119,6 +119,11 @@ namespace o2
 		return true;
 	}
 
+	Component::UpdatePhase Component::GetUpdatePhase()
+	{
+		return UpdatePhase::Default;
+	}
+
 	void Component::UpdateEnabled()
 	{
 		bool lastResEnabled = mResEnabled;
@@ -223,4 +228,12 @@ namespace o2
 // 	}
 }
 
+ENUM_META(o2::Component::UpdatePhase)
+{
+	ENUM_ENTRY(Default);
+	ENUM_ENTRY(Early);
+	ENUM_ENTRY(Late);
+}
+END_ENUM_META;
+
 DECLARE_CLASS(o2::Component);
@@ -6,12 +6,17 @@
 namespace o2
 {
 	class Actor;
+	class ComponentUpdateList;
 
 	// ---------------------------
 	// Actor's component interface
 	// ---------------------------
 	class Component: virtual public ISerializable
 	{
+	public:
+		// Scene components update phase: early components are updated before actors, default and late - after
+		enum class UpdatePhase { Early, Default, Late };
+
 	public:
 		PROPERTIES(Component);
 		GETTER(Actor*, actor, GetOwnerActor);                   // Owner actor getter
@@ -92,6 +97,9 @@ namespace o2
 		// Is component visible in create menu
 		static bool IsAvailableFromCreateMenu();
 
+		// Returns update phase of components of this type. Redefine it in derived type to change phase
+		static UpdatePhase GetUpdatePhase();
+
 #if IS_EDITOR
 		// It is called when component added from editor
 		virtual void OnAddedFromEditor() {}
@@ -106,6 +114,9 @@ namespace o2
 		bool       mEnabled = true;          // Is component enabled @SERIALIZABLE @EDITOR_IGNORE
 		bool       mResEnabled = true;       // Is component enabled in hierarchy
 
+		ComponentUpdateList* mUpdateList = nullptr; // Scene update list, where component is registered. Null when not registered @IGNORE
+		int                  mUpdateListIdx = -1;   // Index of component in scene update list @IGNORE
+
 	protected:
 		// Sets owner actor
 		virtual void SetOwnerActor(Actor* actor);
@@ -153,6 +164,7 @@ namespace o2
 		virtual void OnComponentRemoving(Component* component) {}
 
 		friend class Actor;
+		friend class ComponentUpdateList;
 		friend class Scene;
 		friend class Widget;
 	};
@@ -172,7 +184,12 @@ namespace o2
 // 		// Checks that type is based on Component type
 // 		bool IsConvertsType(const Type* type) const;
 // 	};
+}
 
+#include "o2/Scene/Actor.h"
+
+namespace o2
+{
 	template<typename _type>
 	Vector<_type*> Component::GetComponentsInChildren() const
 	{
@@ -186,7 +203,7 @@ namespace o2
 	Vector<_type*> Component::GetComponents() const
 	{
 		if (mOwner)
-			return mOwner->GetComponents();
+			return mOwner->GetComponents<_type>();
 
 		return Vector<_type*>();
 	}
@@ -208,9 +225,10 @@ namespace o2
 
 		return nullptr;
 	}
-
 }
 
+PRE_ENUM_META(o2::Component::UpdatePhase);
+
 CLASS_BASES_META(o2::Component)
 {
 	BASE_CLASS(o2::ISerializable);
@@ -246,6 +264,7 @@ CLASS_METHODS_META(o2::Component)
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableFromCreateMenu);
+	PUBLIC_STATIC_FUNCTION(UpdatePhase, GetUpdatePhase);
 	PUBLIC_FUNCTION(void, OnAddedFromEditor);
 	PROTECTED_FUNCTION(void, SetOwnerActor, Actor*);
 	PROTECTED_FUNCTION(void, OnAddToScene);
@@ -0,0 +1,132 @@
+#include "o2/stdafx.h"
+#include "ComponentUpdateList.h"
+
+namespace o2
+{
+	ComponentUpdateList::ComponentUpdateList(const Type* type):
+		mType(type)
+	{
+		mUpdatePhase = type->InvokeStatic<Component::UpdatePhase>("GetUpdatePhase");
+		mUpdatable = IsOverridden(type, "Update");
+		mFixedUpdatable = IsOverridden(type, "FixedUpdate");
+	}
+
+	ComponentUpdateList::~ComponentUpdateList()
+	{
+		for (auto comp : mComponents)
+		{
+			if (comp)
+				comp->mUpdateList = nullptr;
+		}
+	}
+
+	const Type* ComponentUpdateList::GetComponentsType() const
+	{
+		return mType;
+	}
+
+	Component::UpdatePhase ComponentUpdateList::GetUpdatePhase() const
+	{
+		return mUpdatePhase;
+	}
+
+	bool ComponentUpdateList::IsUpdatable() const
+	{
+		return mUpdatable;
+	}
+
+	bool ComponentUpdateList::IsFixedUpdatable() const
+	{
+		return mFixedUpdatable;
+	}
+
+	int ComponentUpdateList::GetComponentsCount() const
+	{
+		return mComponents.Count() - mRemovedCount;
+	}
+
+	void ComponentUpdateList::Add(Component* component)
+	{
+		if (component->mUpdateList)
+			return;
+
+		component->mUpdateList = this;
+		component->mUpdateListIdx = mComponents.Count();
+		mComponents.Add(component);
+	}
+
+	void ComponentUpdateList::Remove(Component* component)
+	{
+		if (component->mUpdateList != this)
+			return;
+
+		mComponents[component->mUpdateListIdx] = nullptr;
+		mRemovedCount++;
+
+		component->mUpdateList = nullptr;
+		component->mUpdateListIdx = -1;
+	}
+
+	void ComponentUpdateList::Update(float dt)
+	{
+		if (mRemovedCount > 0)
+			Compact();
+
+		// Components added while updating are updated from next frame
+		int count = mComponents.Count();
+		for (int i = 0; i < count; i++)
+		{
+			if (auto comp = mComponents[i])
+				comp->Update(dt);
+		}
+	}
+
+	void ComponentUpdateList::FixedUpdate(float dt)
+	{
+		if (mRemovedCount > 0)
+			Compact();
+
+		int count = mComponents.Count();
+		for (int i = 0; i < count; i++)
+		{
+			if (auto comp = mComponents[i])
+				comp->FixedUpdate(dt);
+		}
+	}
+
+	bool ComponentUpdateList::IsOverridden(const Type* type, const String& functionName)
+	{
+		if (*type == TypeOf(Component))
+			return false;
+
+		for (auto func : type->GetFunctions())
+		{
+			if (func->GetName() == functionName)
+				return true;
+		}
+
+		for (auto& baseType : type->GetBaseTypes())
+		{
+			if (baseType.type->IsBasedOn(TypeOf(Component)) && IsOverridden(baseType.type, functionName))
+				return true;
+		}
+
+		return false;
+	}
+
+	void ComponentUpdateList::Compact()
+	{
+		int count = 0;
+		for (int i = 0; i < mComponents.Count(); i++)
+		{
+			if (auto comp = mComponents[i])
+			{
+				comp->mUpdateListIdx = count;
+				mComponents[count++] = comp;
+			}
+		}
+
+		mComponents.Resize(count);
+		mRemovedCount = 0;
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "o2/Scene/Component.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Type;
+
+	// ----------------------------------------------------------------------------------------------------
+	// List of scene components of one type, that are updated together. Components can be added and removed
+	// while updating: removed components are cleared in place and list is compacted before next update
+	// ----------------------------------------------------------------------------------------------------
+	class ComponentUpdateList
+	{
+	public:
+		// Constructor. Checks which updates are overridden by components type
+		ComponentUpdateList(const Type* type);
+
+		// Destructor. Unregisters components
+		~ComponentUpdateList();
+
+		// Returns components type
+		const Type* GetComponentsType() const;
+
+		// Returns update phase of components type
+		Component::UpdatePhase GetUpdatePhase() const;
+
+		// Is components type overrides Update
+		bool IsUpdatable() const;
+
+		// Is components type overrides FixedUpdate
+		bool IsFixedUpdatable() const;
+
+		// Returns count of registered components
+		int GetComponentsCount() const;
+
+		// Registers component
+		void Add(Component* component);
+
+		// Unregisters component
+		void Remove(Component* component);
+
+		// Updates registered components
+		void Update(float dt);
+
+		// Updates registered components with fixed delta time
+		void FixedUpdate(float dt);
+
+		// Is components type overrides function with name in Component derived types
+		static bool IsOverridden(const Type* type, const String& functionName);
+
+	protected:
+		const Type*            mType;                   // Components type
+		Component::UpdatePhase mUpdatePhase;            // Update phase of components type
+		bool                   mUpdatable = false;      // Is components type overrides Update
+		bool                   mFixedUpdatable = false; // Is components type overrides FixedUpdate
+
+		Vector<Component*> mComponents;       // Registered components. Removed components are null until compaction
+		int                mRemovedCount = 0; // Count of removed components, waiting for compaction
+
+	protected:
+		// Removes cleared components and updates indices of others
+		void Compact();
+	};
+}
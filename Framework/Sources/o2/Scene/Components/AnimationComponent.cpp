@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "AnimationComponent.h"
 
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Animation/Tracks/AnimationTrack.h"
 
 namespace o2
@@ -16,6 +17,9 @@ namespace o2
 
 	AnimationComponent::~AnimationComponent()
 	{
+		if (mBatchIdx >= 0)
+			AnimationTracksBatch::Remove(this);
+
 		RemoveAllStates();
 	}
 
@@ -40,13 +44,20 @@ namespace o2
 				state->player.Update(dt);
 		}
 
-		for (auto val : mValues)
-			val->Update();
+		// Players values are evaluated at the end of animation tracks batch, so mixers are updated after them
+		if (!AnimationTracksBatch::Add(this))
+			UpdateMixers();
 
 		if (mBlend.time > 0)
 			mBlend.Update(dt);
 	}
 
+	void AnimationComponent::UpdateMixers()
+	{
+		for (auto val : mValues)
+			val->Update();
+	}
+
 	AnimationState* AnimationComponent::AddState(AnimationState* state)
 	{
 		state->player.SetTarget(mOwner);
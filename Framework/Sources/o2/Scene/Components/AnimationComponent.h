@@ -170,6 +170,7 @@ namespace o2
 		BlendState mBlend;  // Current blend parameters
 
 		bool mInEditMode = false; // True when some state animation is editing now, disables update
+		int  mBatchIdx = -1;      // Index in animation tracks batch, where component waits mixers update. -1 when it isn't collected @IGNORE
 
 	protected:
 		// Registers value by path and state
@@ -179,6 +180,9 @@ namespace o2
 		// Removes Animation track from agent by path
 		void UnregTrack(IAnimationTrack::IPlayer* player, const String& path);
 
+		// Updates values mixers and assigns blended values
+		void UpdateMixers();
+
 		// It is called when new track added in animation state, registers track player in mixer
 		void OnStateAnimationTrackAdded(AnimationState* state, IAnimationTrack::IPlayer* player);
 
@@ -190,6 +194,7 @@ namespace o2
 
 		friend class AnimationClip;
 		friend class AnimationState;
+		friend class AnimationTracksBatch;
 		friend class IAnimationTrack;
 
 		template<typename _type>
@@ -262,7 +267,7 @@ namespace o2
 	void AnimationComponent::TrackMixer<_type>::Update()
 	{
 		AnimationState* firstValueState = tracks[0].first;
-		AnimationTrack<_type>::Player* firstValue = tracks[0].second;
+		typename AnimationTrack<_type>::Player* firstValue = tracks[0].second;
 
 		float weightsSum = firstValueState->mWeight*firstValueState->blend*firstValueState->mask.GetNodeWeight(path);
 		_type valueSum = firstValue->GetValue();
@@ -270,7 +275,7 @@ namespace o2
 		for (int i = 1; i < tracks.Count(); i++)
 		{
 			AnimationState* valueState = tracks[i].first;
-			AnimationTrack<_type>::Player* value = tracks[i].second;
+			typename AnimationTrack<_type>::Player* value = tracks[i].second;
 
 			weightsSum += valueState->mWeight*valueState->blend*valueState->mask.GetNodeWeight(path);
 			valueSum += value->GetValue();
@@ -322,6 +327,7 @@ CLASS_METHODS_META(o2::AnimationComponent)
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PROTECTED_FUNCTION(void, UnregTrack, IAnimationTrack::IPlayer*, const String&);
+	PROTECTED_FUNCTION(void, UpdateMixers);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackAdded, AnimationState*, IAnimationTrack::IPlayer*);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackRemoved, AnimationState*, IAnimationTrack::IPlayer*);
 	PROTECTED_FUNCTION(void, OnStatesListChanged);
@@ -82,6 +82,16 @@ namespace o2
 	void ImageComponent::OnTransformUpdated()
 	{
 		SetBasis(mOwner->transform->GetWorldBasis());
+		UpdateSceneDrawableBounds();
+	}
+
+	bool ImageComponent::CalculateSceneDrawableBounds(RectF& bounds) const
+	{
+		if (!mOwner)
+			return false;
+
+		bounds = mOwner->transform->GetWorldBasis().AABB();
+		return true;
 	}
 
 	void ImageComponent::SetOwnerActor(Actor* actor)
@@ -71,6 +71,9 @@ namespace o2
 		// It is called when actor's transform was changed
 		void OnTransformUpdated() override;
 
+		// Calculates world space bounds by actor's transform
+		bool CalculateSceneDrawableBounds(RectF& bounds) const override;
+
 		// Sets owner actor
 		void SetOwnerActor(Actor* actor) override;
 
@@ -101,6 +104,7 @@ CLASS_METHODS_META(o2::ImageComponent)
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PROTECTED_FUNCTION(void, OnTransformUpdated);
+	PROTECTED_FUNCTION(bool, CalculateSceneDrawableBounds, RectF&);
 	PROTECTED_FUNCTION(void, SetOwnerActor, Actor*);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
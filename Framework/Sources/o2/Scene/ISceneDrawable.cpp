@@ -81,6 +81,30 @@ namespace o2
 			layer->SetLastByDepth(this);
 	}
 
+	const RectF& ISceneDrawable::GetSceneDrawableBounds() const
+	{
+		return mSceneDrawableBounds;
+	}
+
+	bool ISceneDrawable::IsSceneDrawableBoundsValid() const
+	{
+		return mSceneDrawableBoundsValid;
+	}
+
+	bool ISceneDrawable::CalculateSceneDrawableBounds(RectF& bounds) const
+	{
+		return false;
+	}
+
+	void ISceneDrawable::UpdateSceneDrawableBounds()
+	{
+		if (!mInCulling)
+			return;
+
+		if (auto layer = GetSceneDrawableSceneLayer())
+			layer->OnDrawableBoundsChanged(this);
+	}
+
 #if IS_EDITOR
 	SceneEditableObject* ISceneDrawable::GetEditableOwner()
 	{
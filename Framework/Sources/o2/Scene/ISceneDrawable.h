@@ -47,12 +47,33 @@ namespace o2
 		// Sets this drawable as last drawing object in layer with same depth
 		void SetLastOnCurrentDepth();
 
+		// Returns cached world space bounds, used for culling
+		const RectF& GetSceneDrawableBounds() const;
+
+		// Returns true when drawable has bounds and can be culled
+		bool IsSceneDrawableBoundsValid() const;
+
 		SERIALIZABLE(ISceneDrawable);
 
 	protected:
 		float mDrawingDepth = 0.0f; // Drawing depth. Objects with higher depth will be drawn later @SERIALIZABLE
 
+		RectF mSceneDrawableBounds;              // Cached world space bounds, used for culling @IGNORE
+		bool  mSceneDrawableBoundsValid = false; // True when drawable has bounds and can be culled @IGNORE
+
+		bool   mInCulling = false;     // True when drawable is placed in layer's culling structures @IGNORE
+		bool   mInCullingGrid = false; // True when drawable is placed in layer's culling grid, false when it is checked always @IGNORE
+		RectI  mCullingCells;          // Range of layer's culling grid cells, that contains drawable @IGNORE
+		UInt64 mCullingQueryIdx = 0;   // Index of last culling query of any layer, that collected this drawable @IGNORE
+		int    mLayerDrawOrder = 0;    // Position in layer's enabled drawables list @IGNORE
+
 	protected:
+		// Calculates world space bounds. Returns false when drawable has no bounds and must be drawn always
+		virtual bool CalculateSceneDrawableBounds(RectF& bounds) const;
+
+		// Updates cached bounds and moves drawable in layer's culling grid
+		void UpdateSceneDrawableBounds();
+
 		// Returns current scene layer
 		virtual SceneLayer* GetSceneDrawableSceneLayer() const = 0;
 
@@ -104,6 +125,10 @@ CLASS_METHODS_META(o2::ISceneDrawable)
 	PUBLIC_FUNCTION(void, SetDrawingDepth, float);
 	PUBLIC_FUNCTION(float, GetSceneDrawableDepth);
 	PUBLIC_FUNCTION(void, SetLastOnCurrentDepth);
+	PUBLIC_FUNCTION(const RectF&, GetSceneDrawableBounds);
+	PUBLIC_FUNCTION(bool, IsSceneDrawableBoundsValid);
+	PROTECTED_FUNCTION(bool, CalculateSceneDrawableBounds, RectF&);
+	PROTECTED_FUNCTION(void, UpdateSceneDrawableBounds);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
 	PROTECTED_FUNCTION(void, OnEnabled);
@@ -1,19 +1,23 @@
 #include "o2/stdafx.h"
 #include "Scene.h"
 
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Application/Input.h"
 #include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Render/Render.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ActorDataValueConverter.h"
+#include "o2/Scene/ActorTransformsHierarchy.h"
 #include "o2/Scene/CameraActor.h"
 #include "o2/Scene/Component.h"
+#include "o2/Scene/ComponentUpdateList.h"
 #include "o2/Scene/DrawableComponent.h"
 #include "o2/Scene/SceneLayer.h"
 #include "o2/Scene/Tags.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Render/VectorFontEffects.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -31,24 +35,38 @@ namespace o2
 		Clear();
 		ClearCache();
 
+		for (auto& kv : mComponentUpdateListsMap)
+			delete kv.second;
+
 		delete mDefaultLayer;
 	}
 
 	void Scene::Update(float dt)
 	{
+		PROFILE_SCOPE("Scene::Update");
+
 		UpdateAddedEntities();
 		UpdateStartingEntities();
 		UpdateDestroyingEntities();
+
+		// Animations of all actors are evaluated together after actors update
+		AnimationTracksBatch::Begin();
 		UpdateActors(dt);
+		AnimationTracksBatch::End();
 	}
 
 	void Scene::FixedUpdate(float dt)
 	{
+		PROFILE_SCOPE("Scene::FixedUpdate");
+
 		for (auto actor : mRootActors)
 			actor->FixedUpdate(dt);
 
 		for (auto actor : mRootActors)
 			actor->FixedUpdateChildren(dt);
+
+		for (auto list : mFixedUpdateLists)
+			list->FixedUpdate(dt);
 	}
 
 	void Scene::UpdateAddedEntities()
@@ -105,16 +123,44 @@ namespace o2
 
 	void Scene::UpdateActors(float dt)
 	{
-		for (auto actor : mRootActors)
-			actor->Update(dt);
+		{
+			PROFILE_SCOPE("Scene::EarlyUpdateComponents");
+			for (auto list : mEarlyUpdateLists)
+				list->Update(dt);
+		}
 
-		for (auto actor : mRootActors)
-			actor->UpdateChildren(dt);
+		// Plain actors transforms are updated in one pass, actors update only transforms changed after it
+		ActorTransformsHierarchy::Update(mRootActors);
+
+		{
+			PROFILE_SCOPE("Scene::UpdateActors");
+
+			for (auto actor : mRootActors)
+				actor->Update(dt);
+
+			for (auto actor : mRootActors)
+				actor->UpdateChildren(dt);
+		}
+
+		// Components of plain actors are updated by types, not by actors
+		{
+			PROFILE_SCOPE("Scene::UpdateComponents");
+			for (auto list : mUpdateLists)
+				list->Update(dt);
+		}
+
+		{
+			PROFILE_SCOPE("Scene::LateUpdateComponents");
+			for (auto list : mLateUpdateLists)
+				list->Update(dt);
+		}
 	}
 
 #undef DrawText
 	void Scene::Draw()
 	{
+		PROFILE_SCOPE("Scene::Draw");
+
 		if constexpr (IS_EDITOR)
 			BeginDrawingScene();
 
@@ -209,8 +255,13 @@ namespace o2
 			mRootActors.Add(actor);
 
 		mAllActors.Add(actor);
+		RegisterActorID(actor);
+		ActorTransformsHierarchy::Invalidate();
 		actor->OnAddToScene();
 
+		for (auto comp : actor->mComponents)
+			RegisterComponentUpdate(comp);
+
 		if constexpr (IS_EDITOR)
 		{
 			mChangedObjects.Add(actor);
@@ -225,10 +276,16 @@ namespace o2
 		mRootActors.Remove(actor);
 
 		mAllActors.Remove(actor);
+		UnregisterActorID(actor, actor->mId);
 
 		mStartActors.Remove(actor);
 		mAddedActors.Remove(actor);
 
+		for (auto comp : actor->mComponents)
+			UnregisterComponentUpdate(comp);
+
+		ActorTransformsHierarchy::Invalidate();
+
 		if constexpr (IS_EDITOR)
 		{
 			if (!keepEditorObjects)
@@ -239,14 +296,110 @@ namespace o2
 		}
 	}
 
+	void Scene::OnActorIdChanged(Actor* actor, SceneUID oldId)
+	{
+		if (UnregisterActorID(actor, oldId))
+			RegisterActorID(actor);
+	}
+
+	void Scene::RegisterActorID(Actor* actor)
+	{
+		Actor* registered = nullptr;
+		if (mActorsMap.TryGetValue(actor->mId, registered) && registered != actor)
+			mDuplicatedIdActors.Add(actor);
+		else
+			mActorsMap[actor->mId] = actor;
+	}
+
+	bool Scene::UnregisterActorID(Actor* actor, SceneUID id)
+	{
+		Actor* registered = nullptr;
+		if (!mActorsMap.TryGetValue(id, registered))
+			return false;
+
+		if (registered != actor)
+		{
+			int idx = mDuplicatedIdActors.IndexOf(actor);
+			if (idx < 0)
+				return false;
+
+			mDuplicatedIdActors.RemoveAt(idx);
+			return true;
+		}
+
+		mActorsMap.Remove(id);
+
+		// Other actor with same id becomes found by id
+		for (int i = 0; i < mDuplicatedIdActors.Count(); i++)
+		{
+			if (mDuplicatedIdActors[i]->mId == id)
+			{
+				mActorsMap.Add(id, mDuplicatedIdActors[i]);
+				mDuplicatedIdActors.RemoveAt(i);
+				break;
+			}
+		}
+
+		return true;
+	}
+
 	void Scene::OnComponentAdded(Component* component)
 	{
 		mStartComponents.Add(component);
+		RegisterComponentUpdate(component);
 	}
 
 	void Scene::OnComponentRemoved(Component* component)
 	{
 		mStartComponents.Remove(component);
+		UnregisterComponentUpdate(component);
+	}
+
+	void Scene::RegisterComponentUpdate(Component* component)
+	{
+		// Widgets update their components by themselves, only when enabled in hierarchy
+		if (dynamic_cast<Widget*>(component->mOwner))
+			return;
+
+		const Type* type = &component->GetType();
+
+		ComponentUpdateList* list = nullptr;
+		if (!mComponentUpdateListsMap.TryGetValue(type, list))
+		{
+			list = mnew ComponentUpdateList(type);
+
+			if (list->IsUpdatable())
+			{
+				if (list->GetUpdatePhase() == Component::UpdatePhase::Early)
+					mEarlyUpdateLists.Add(list);
+				else if (list->GetUpdatePhase() == Component::UpdatePhase::Late)
+					mLateUpdateLists.Add(list);
+				else
+					mUpdateLists.Add(list);
+			}
+
+			if (list->IsFixedUpdatable())
+				mFixedUpdateLists.Add(list);
+
+			// Types without updates are remembered too, to not check them again
+			if (!list->IsUpdatable() && !list->IsFixedUpdatable())
+			{
+				delete list;
+				list = nullptr;
+			}
+
+			mComponentUpdateListsMap.Add(type, list);
+		}
+
+		if (list)
+			list->Add(component);
+	}
+
+	void Scene::UnregisterComponentUpdate(Component* component)
+	{
+		// Component's type can't be used here, it may be called from component's destructor
+		if (component->mUpdateList)
+			component->mUpdateList->Remove(component);
 	}
 
 	void Scene::OnLayerRenamed(SceneLayer* layer, const String& oldName)
@@ -377,7 +530,7 @@ namespace o2
 		return mLayers.Convert<String>([](SceneLayer* x) { return x->GetName(); });
 	}
 
-	const Map<String, SceneLayer*>& Scene::GetLayersMap() const
+	const UnorderedMap<String, SceneLayer*>& Scene::GetLayersMap() const
 	{
 		return mLayersMap;
 	}
@@ -409,17 +562,19 @@ namespace o2
 
 	Actor* Scene::GetActorByID(SceneUID id) const
 	{
-		return mAllActors.FindOrDefault([=](Actor* x) { return x->mId == id; });
+		Actor* actor = nullptr;
+		mActorsMap.TryGetValue(id, actor);
+		return actor;
 	}
 
 	Actor* Scene::GetAssetActorByID(const UID& id)
 	{
-		auto cached = mCache.FindOrDefault([=](const ActorAssetRef& x) { return x->GetUID() == id; });
-
-		if (!cached)
+		ActorAssetRef cached;
+		if (!mCacheMap.TryGetValue(id, cached))
 		{
 			cached = ActorAssetRef(id);
 			mCache.Add(cached);
+			mCacheMap.Add(id, cached);
 		}
 
 		return cached->GetActor();
@@ -471,6 +626,7 @@ namespace o2
 	void Scene::ClearCache()
 	{
 		mCache.Clear();
+		mCacheMap.Clear();
 	}
 
 	void Scene::Load(const String& path, bool append /*= false*/)
@@ -746,7 +902,7 @@ namespace o2
 
 	void Scene::OnActorPrototypeBroken(Actor* actor)
 	{
-		for (auto& it = mPrototypeLinksCache.Begin(); it != mPrototypeLinksCache.End();)
+		for (auto it = mPrototypeLinksCache.Begin(); it != mPrototypeLinksCache.End();)
 		{
 			it->second.Remove(actor);
 			if (it->second.IsEmpty())
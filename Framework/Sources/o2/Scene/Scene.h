@@ -3,6 +3,7 @@
 #include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/UnorderedMap.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Types/UID.h"
@@ -16,6 +17,7 @@ namespace o2
 	class Actor;
 	class CameraActor;
 	class Component;
+	class ComponentUpdateList;
 	class SceneLayer;
 	class Tag;
 
@@ -73,7 +75,7 @@ namespace o2
 		Vector<String> GetLayersNames() const;
 
 		// Returns layers map by name
-		const Map<String, SceneLayer*>& GetLayersMap() const;
+		const UnorderedMap<String, SceneLayer*>& GetLayersMap() const;
 
 		// Returns tag with name
 		Tag* GetTag(const String& name) const;
@@ -151,8 +153,10 @@ namespace o2
 	protected:
 		Vector<CameraActor*> mCameras; // List of cameras on scene
 
-		Vector<Actor*> mRootActors; // Scene root actors		
-		Vector<Actor*> mAllActors;  // All scene actors
+		Vector<Actor*>                 mRootActors;         // Scene root actors		
+		Vector<Actor*>                 mAllActors;          // All scene actors
+		UnorderedMap<SceneUID, Actor*> mActorsMap;          // All scene actors by ids @IGNORE
+		Vector<Actor*>                 mDuplicatedIdActors; // Scene actors with ids, already registered by other actors. Found by id when that actor is removed @IGNORE
 
 		Vector<Actor*> mAddedActors; // List of added on previous frame actors. Will receive OnAddToScene at current frame
 		
@@ -162,13 +166,20 @@ namespace o2
 		Vector<Actor*>     mDestroyActors;     // List of destroying on current frame actors
 		Vector<Component*> mDestroyComponents; // List of destroying on current frame components
 
-		Map<String, SceneLayer*> mLayersMap;    // Layers by names map
-		Vector<SceneLayer*>      mLayers;       // Scene layers
-		SceneLayer*              mDefaultLayer; // Default scene layer
+		UnorderedMap<const Type*, ComponentUpdateList*> mComponentUpdateListsMap; // Update lists by components types. Null for types without updates @IGNORE
+		Vector<ComponentUpdateList*>                    mEarlyUpdateLists;        // Update lists of early phase components, updated before actors @IGNORE
+		Vector<ComponentUpdateList*>                    mUpdateLists;             // Update lists of default phase components, updated after actors @IGNORE
+		Vector<ComponentUpdateList*>                    mLateUpdateLists;         // Update lists of late phase components, updated last @IGNORE
+		Vector<ComponentUpdateList*>                    mFixedUpdateLists;        // Update lists of components with fixed update @IGNORE
+
+		UnorderedMap<String, SceneLayer*> mLayersMap;    // Layers by names map @IGNORE
+		Vector<SceneLayer*>               mLayers;       // Scene layers
+		SceneLayer*                       mDefaultLayer; // Default scene layer
 
 		Vector<Tag*> mTags; // Scene tags
 
-		Vector<ActorAssetRef> mCache; // Cached actors assets
+		Vector<ActorAssetRef>            mCache;    // Cached actors assets
+		UnorderedMap<UID, ActorAssetRef> mCacheMap; // Cached actors assets by asset ids @IGNORE
 
 	protected:
 		// Default constructor
@@ -204,12 +215,27 @@ namespace o2
 		// It is called when actor removing from scene; unregisters from actors list and events list
 		void RemoveActorFromScene(Actor* actor, bool keepEditorObjects = false);
 
+		// It is called when actor's id was changed, updates actors map
+		void OnActorIdChanged(Actor* actor, SceneUID oldId);
+
+		// Registers actor in actors map by id. Actor with already registered id is kept in duplicated ids actors list
+		void RegisterActorID(Actor* actor);
+
+		// Unregisters actor from actors map by id. Returns false when actor wasn't registered
+		bool UnregisterActorID(Actor* actor, SceneUID id);
+
 		// It is called when component added to actor, registers for calling OnAddOnScene
 		void OnComponentAdded(Component* component);
 
 		// It is called when component removed, register for calling OnRemovFromScene
 		void OnComponentRemoved(Component* component);
 
+		// Registers component in update list of its type, if type overrides Update or FixedUpdate
+		void RegisterComponentUpdate(Component* component);
+
+		// Unregisters component from update list
+		void UnregisterComponentUpdate(Component* component);
+
 		// It is called when scene layer renamed, updates layers map
 		void OnLayerRenamed(SceneLayer* layer, const String& oldName);
 
@@ -358,7 +384,6 @@ CLASS_FIELDS_META(o2::Scene)
 	PROTECTED_FIELD(mStartComponents);
 	PROTECTED_FIELD(mDestroyActors);
 	PROTECTED_FIELD(mDestroyComponents);
-	PROTECTED_FIELD(mLayersMap);
 	PROTECTED_FIELD(mLayers);
 	PROTECTED_FIELD(mDefaultLayer);
 	PROTECTED_FIELD(mTags);
@@ -373,7 +398,7 @@ END_META;
 CLASS_METHODS_META(o2::Scene)
 {
 
-	typedef const Map<String, SceneLayer*>& _tmp1;
+	typedef const UnorderedMap<String, SceneLayer*>& _tmp1;
 	typedef Map<ActorAssetRef, Vector<Actor*>>& _tmp2;
 
 	PUBLIC_FUNCTION(bool, HasLayer, const String&);
@@ -416,8 +441,13 @@ CLASS_METHODS_META(o2::Scene)
 	PROTECTED_FUNCTION(void, AddActorToScene, Actor*);
 	PROTECTED_FUNCTION(void, AddActorToSceneDeferred, Actor*);
 	PROTECTED_FUNCTION(void, RemoveActorFromScene, Actor*, bool);
+	PROTECTED_FUNCTION(void, OnActorIdChanged, Actor*, SceneUID);
+	PROTECTED_FUNCTION(void, RegisterActorID, Actor*);
+	PROTECTED_FUNCTION(bool, UnregisterActorID, Actor*, SceneUID);
 	PROTECTED_FUNCTION(void, OnComponentAdded, Component*);
 	PROTECTED_FUNCTION(void, OnComponentRemoved, Component*);
+	PROTECTED_FUNCTION(void, RegisterComponentUpdate, Component*);
+	PROTECTED_FUNCTION(void, UnregisterComponentUpdate, Component*);
 	PROTECTED_FUNCTION(void, OnLayerRenamed, SceneLayer*, const String&);
 	PROTECTED_FUNCTION(void, OnCameraAddedOnScene, CameraActor*);
 	PROTECTED_FUNCTION(void, OnCameraRemovedScene, CameraActor*);
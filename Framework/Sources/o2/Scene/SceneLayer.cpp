@@ -7,6 +7,8 @@
 
 namespace o2
 {
+	UInt64 SceneLayer::mLastCullingQueryIdx = 0;
+
 	void SceneLayer::SetName(const String& name)
 	{
 		String oldName = mName;
@@ -43,6 +45,97 @@ namespace o2
 		return mEnabledDrawables;
 	}
 
+	const Vector<ISceneDrawable*>& SceneLayer::GetEnabledDrawablesInRect(const RectF& rect)
+	{
+		if (mDrawablesOrderChanged)
+		{
+			for (int i = 0; i < mEnabledDrawables.Count(); i++)
+				mEnabledDrawables[i]->mLayerDrawOrder = i;
+
+			mDrawablesOrderChanged = false;
+		}
+
+		UInt64 queryIdx = ++mLastCullingQueryIdx;
+		mVisibleDrawables.Clear();
+
+		for (auto drawable : mNotGriddedDrawables)
+		{
+			if (drawable->mCullingQueryIdx == queryIdx)
+				continue;
+
+			if (!drawable->mSceneDrawableBoundsValid || drawable->mSceneDrawableBounds.IsIntersects(rect))
+			{
+				drawable->mCullingQueryIdx = queryIdx;
+				mVisibleDrawables.Add(drawable);
+			}
+		}
+
+		auto collectCell = [&](const Vector<ISceneDrawable*>& cell)
+		{
+			for (auto drawable : cell)
+			{
+				if (drawable->mCullingQueryIdx == queryIdx)
+					continue;
+
+				if (drawable->mSceneDrawableBounds.IsIntersects(rect))
+				{
+					drawable->mCullingQueryIdx = queryIdx;
+					mVisibleDrawables.Add(drawable);
+				}
+			}
+		};
+
+		RectI cells = GetCullingCells(rect);
+		UInt64 cellsCount = (UInt64)(cells.right - cells.left + 1)*(UInt64)(cells.top - cells.bottom + 1);
+
+		// When rectangle covers more cells than grid has, it's cheaper to check all grid cells
+		if (cellsCount > (UInt64)mCullingGrid.Count())
+		{
+			for (auto& kv : mCullingGrid)
+			{
+				int x = (int)(UInt)(kv.first >> 32), y = (int)(UInt)(kv.first & 0xffffffff);
+				if (x >= cells.left && x <= cells.right && y >= cells.bottom && y <= cells.top)
+					collectCell(kv.second);
+			}
+		}
+		else
+		{
+			for (int x = cells.left; x <= cells.right; x++)
+			{
+				for (int y = cells.bottom; y <= cells.top; y++)
+				{
+					auto fnd = mCullingGrid.find(GetCullingCellKey(x, y));
+					if (fnd != mCullingGrid.end())
+						collectCell(fnd->second);
+				}
+			}
+		}
+
+		std::sort(mVisibleDrawables.begin(), mVisibleDrawables.end(),
+				  [](ISceneDrawable* a, ISceneDrawable* b) { return a->mLayerDrawOrder < b->mLayerDrawOrder; });
+
+		return mVisibleDrawables;
+	}
+
+	void SceneLayer::SetCullingCellSize(float size)
+	{
+		mCullingCellSize = Math::Max(size, 1.0f);
+
+		mCullingGrid.Clear();
+		mNotGriddedDrawables.Clear();
+
+		for (auto drawable : mEnabledDrawables)
+		{
+			drawable->mInCulling = false;
+			AddToCulling(drawable);
+		}
+	}
+
+	float SceneLayer::GetCullingCellSize() const
+	{
+		return mCullingCellSize;
+	}
+
 	void SceneLayer::RegisterActor(Actor* actor)
 	{
 		mActors.Add(actor);
@@ -113,11 +206,17 @@ namespace o2
 		}
 
 		mEnabledDrawables.Insert(drawable, position);
+		mDrawablesOrderChanged = true;
+
+		AddToCulling(drawable);
 	}
 
 	void SceneLayer::OnDrawableDisabled(ISceneDrawable* drawable)
 	{
 		mEnabledDrawables.Remove(drawable);
+		mDrawablesOrderChanged = true;
+
+		RemoveFromCulling(drawable);
 	}
 
 	void SceneLayer::SetLastByDepth(ISceneDrawable* drawable)
@@ -129,11 +228,103 @@ namespace o2
 			if (mEnabledDrawables[position]->mDrawingDepth > drawable->mDrawingDepth)
 			{
 				mEnabledDrawables.Insert(drawable, position);
+				mDrawablesOrderChanged = true;
+				AddToCulling(drawable);
 				return;
 			}
 		}
 
 		mEnabledDrawables.Add(drawable);
+		mDrawablesOrderChanged = true;
+		AddToCulling(drawable);
+	}
+
+	void SceneLayer::OnDrawableBoundsChanged(ISceneDrawable* drawable)
+	{
+		RectF bounds;
+		bool boundsValid = drawable->CalculateSceneDrawableBounds(bounds);
+
+		if (boundsValid && drawable->mInCullingGrid && GetCullingCells(bounds) == drawable->mCullingCells)
+		{
+			drawable->mSceneDrawableBounds = bounds;
+			return;
+		}
+
+		RemoveFromCulling(drawable);
+		AddToCulling(drawable);
+	}
+
+	void SceneLayer::AddToCulling(ISceneDrawable* drawable)
+	{
+		if (drawable->mInCulling)
+			RemoveFromCulling(drawable);
+
+		drawable->mInCulling = true;
+		drawable->mSceneDrawableBoundsValid = drawable->CalculateSceneDrawableBounds(drawable->mSceneDrawableBounds);
+
+		if (drawable->mSceneDrawableBoundsValid)
+		{
+			RectI cells = GetCullingCells(drawable->mSceneDrawableBounds);
+			int cellsCount = (cells.right - cells.left + 1)*(cells.top - cells.bottom + 1);
+
+			if (cellsCount > 0 && cellsCount <= mMaxCullingCellsPerDrawable)
+			{
+				drawable->mInCullingGrid = true;
+				drawable->mCullingCells = cells;
+
+				for (int x = cells.left; x <= cells.right; x++)
+				{
+					for (int y = cells.bottom; y <= cells.top; y++)
+						mCullingGrid[GetCullingCellKey(x, y)].Add(drawable);
+				}
+
+				return;
+			}
+		}
+
+		drawable->mInCullingGrid = false;
+		mNotGriddedDrawables.Add(drawable);
+	}
+
+	void SceneLayer::RemoveFromCulling(ISceneDrawable* drawable)
+	{
+		if (!drawable->mInCulling)
+			return;
+
+		if (drawable->mInCullingGrid)
+		{
+			RectI cells = drawable->mCullingCells;
+			for (int x = cells.left; x <= cells.right; x++)
+			{
+				for (int y = cells.bottom; y <= cells.top; y++)
+				{
+					auto fnd = mCullingGrid.find(GetCullingCellKey(x, y));
+					if (fnd == mCullingGrid.end())
+						continue;
+
+					fnd->second.Remove(drawable);
+					if (fnd->second.IsEmpty())
+						mCullingGrid.erase(fnd);
+				}
+			}
+		}
+		else
+			mNotGriddedDrawables.Remove(drawable);
+
+		drawable->mInCulling = false;
+		drawable->mInCullingGrid = false;
+	}
+
+	RectI SceneLayer::GetCullingCells(const RectF& rect) const
+	{
+		float invCellSize = 1.0f/mCullingCellSize;
+		return RectI(Math::FloorToInt(rect.left*invCellSize), Math::FloorToInt(rect.top*invCellSize),
+					 Math::FloorToInt(rect.right*invCellSize), Math::FloorToInt(rect.bottom*invCellSize));
+	}
+
+	UInt64 SceneLayer::GetCullingCellKey(int x, int y)
+	{
+		return ((UInt64)(UInt)x << 32) | (UInt64)(UInt)y;
 	}
 
 
@@ -36,9 +36,22 @@ namespace o2
 		// Returns enabled drawable objects of actors in layer
 		const Vector<ISceneDrawable*>& GetEnabledDrawables() const;
 
+		// Returns enabled drawable objects intersecting rectangle, or without bounds, in drawing order
+		const Vector<ISceneDrawable*>& GetEnabledDrawablesInRect(const RectF& rect);
+
+		// Sets culling grid cell size. Rebuilds culling grid
+		void SetCullingCellSize(float size);
+
+		// Returns culling grid cell size
+		float GetCullingCellSize() const;
+
 		SERIALIZABLE(SceneLayer);
 
 	protected:
+		static const int mMaxCullingCellsPerDrawable = 16; // Drawables covering more cells are checked on each query
+
+		static UInt64 mLastCullingQueryIdx; // Index of last culling query. Shared by all layers, so drawable's mark stays valid when it changes layer
+
 		String mName; // Name of layer @SERIALIZABLE
 
 		Vector<Actor*>  mActors;        // Actors in layer
@@ -47,6 +60,12 @@ namespace o2
 		Vector<ISceneDrawable*> mDrawables;        // Drawable objects in layer
 		Vector<ISceneDrawable*> mEnabledDrawables; // Enabled drawable objects in layer
 
+		float                                mCullingCellSize = 512.0f;     // Culling grid cell size
+		Map<UInt64, Vector<ISceneDrawable*>> mCullingGrid;                  // Enabled drawables by culling grid cells @IGNORE
+		Vector<ISceneDrawable*>              mNotGriddedDrawables;          // Enabled drawables without bounds or too large for grid @IGNORE
+		Vector<ISceneDrawable*>              mVisibleDrawables;             // Result buffer of culling query @IGNORE
+		bool                                 mDrawablesOrderChanged = true; // True when enabled drawables order changed since last query @IGNORE
+
 	protected:
 		// Registers actor in list
 		void RegisterActor(Actor* actor);
@@ -78,6 +97,21 @@ namespace o2
 		// Sets drawable order as last of all objects with same depth
 		void SetLastByDepth(ISceneDrawable* drawable);
 
+		// It is called when drawable bounds was changed, moves it in culling grid
+		void OnDrawableBoundsChanged(ISceneDrawable* drawable);
+
+		// Places drawable into culling grid or into not gridded list
+		void AddToCulling(ISceneDrawable* drawable);
+
+		// Removes drawable from culling structures
+		void RemoveFromCulling(ISceneDrawable* drawable);
+
+		// Returns range of culling grid cells covering rectangle
+		RectI GetCullingCells(const RectF& rect) const;
+
+		// Returns culling grid key for cell
+		static UInt64 GetCullingCellKey(int x, int y);
+
 		friend class Actor;
 		friend class CameraActor;
 		friend class DrawableComponent;
@@ -116,6 +150,7 @@ CLASS_FIELDS_META(o2::SceneLayer)
 	PROTECTED_FIELD(mEnabledActors);
 	PROTECTED_FIELD(mDrawables);
 	PROTECTED_FIELD(mEnabledDrawables);
+	PROTECTED_FIELD(mCullingCellSize).DEFAULT_VALUE(512.0f);
 }
 END_META;
 CLASS_METHODS_META(o2::SceneLayer)
@@ -127,6 +162,9 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PUBLIC_FUNCTION(const Vector<Actor*>&, GetEnabledActors);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetDrawables);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetEnabledDrawables);
+	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetEnabledDrawablesInRect, const RectF&);
+	PUBLIC_FUNCTION(void, SetCullingCellSize, float);
+	PUBLIC_FUNCTION(float, GetCullingCellSize);
 	PROTECTED_FUNCTION(void, RegisterActor, Actor*);
 	PROTECTED_FUNCTION(void, UnregisterActor, Actor*);
 	PROTECTED_FUNCTION(void, OnActorEnabled, Actor*);
@@ -137,5 +175,10 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PROTECTED_FUNCTION(void, OnDrawableEnabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, OnDrawableDisabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, SetLastByDepth, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, OnDrawableBoundsChanged, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, AddToCulling, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, RemoveFromCulling, ISceneDrawable*);
+	PROTECTED_FUNCTION(RectI, GetCullingCells, const RectF&);
+	PROTECTED_STATIC_FUNCTION(UInt64, GetCullingCellKey, int, int);
 }
 END_META;
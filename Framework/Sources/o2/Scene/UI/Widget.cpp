@@ -9,6 +9,7 @@
 #include "o2/Scene/UI/WidgetLayer.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Scene/UI/WidgetState.h"
+#include "o2/Scene/UI/Widgets/CachedWidget.h"
 
 namespace o2
 {
@@ -150,7 +151,12 @@ namespace o2
 				for (auto state : mStates)
 				{
 					if (state)
+					{
+						if (state->player.IsPlaying())
+							InvalidateComposition();
+
 						state->Update(dt);
+					}
 				}
 			}
 
@@ -214,6 +220,15 @@ namespace o2
 		layout->SetDirty(false);
 	}
 
+	void Widget::InvalidateComposition()
+	{
+		if (CachedWidget::GetInstancesCount() == 0)
+			return;
+
+		for (Widget* widget = this; widget; widget = widget->mParentWidget)
+			widget->OnCompositionInvalidated(this);
+	}
+
 	void Widget::Draw()
 	{
 		if (!mResEnabledInHierarchy || mIsClipped)
@@ -265,6 +280,7 @@ namespace o2
 		mIsClipped = false;
 		Actor::OnTransformUpdated();
 		UpdateLayersLayouts();
+		InvalidateComposition();
 		onLayoutUpdated();
 	}
 
@@ -728,6 +744,8 @@ namespace o2
 		for (auto layer : mLayers)
 			layer->UpdateResTransparency();
 
+		InvalidateComposition();
+
 		for (auto child : mChildWidgets)
 			child->UpdateTransparency();
 
@@ -770,6 +788,8 @@ namespace o2
 			if (!child->mOverrideDepth)
 				mDrawingChildren.Add(child);
 		}
+
+		InvalidateComposition();
 	}
 
 	void Widget::UpdateBounds()
@@ -828,6 +848,8 @@ namespace o2
 
 		mDrawingLayers.Sort([](auto a, auto b) { return a->mDepth < b->mDepth; });
 		mTopDrawingLayers.Sort([](auto a, auto b) { return a->mDepth < b->mDepth; });
+
+		InvalidateComposition();
 	}
 
 	void Widget::SetParentWidget(Widget* widget)
@@ -913,6 +935,9 @@ namespace o2
 	void Widget::OnStateAdded(WidgetState* state)
 	{}
 
+	void Widget::OnCompositionInvalidated(Widget* source)
+	{}
+
 	void Widget::OnStatesListChanged()
 	{
 		auto statesCopy = mStates;
@@ -1155,6 +1180,7 @@ namespace o2
 			}
 
 			layout->SetDirty(false);
+			InvalidateComposition();
 
 			if constexpr (IS_EDITOR)
 			{
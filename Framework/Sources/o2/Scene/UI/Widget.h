@@ -92,6 +92,9 @@ namespace o2
 		// Sets layout dirty, and update it in update loop
 		void SetLayoutDirty();
 
+		// Invalidates cached compositions, containing this widget. Call it when drawing content was changed
+		void InvalidateComposition();
+
 		// Returns parent widget
 		Widget* GetParentWidget() const;
 
@@ -385,6 +388,9 @@ namespace o2
 		// It is called when widget state was added
 		virtual void OnStateAdded(WidgetState* state);
 
+		// It is called when drawing of this widget or some of its children was changed
+		virtual void OnCompositionInvalidated(Widget* source);
+
 		// It is called from editor, refreshes states
 		void OnStatesListChanged();
 
@@ -758,6 +764,7 @@ CLASS_METHODS_META(o2::Widget)
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, ForceDraw, const RectF&, float);
 	PUBLIC_FUNCTION(void, SetLayoutDirty);
+	PUBLIC_FUNCTION(void, InvalidateComposition);
 	PUBLIC_FUNCTION(Widget*, GetParentWidget);
 	PUBLIC_FUNCTION(const RectF&, GetChildrenWorldRect);
 	PUBLIC_FUNCTION(Widget*, GetChildWidget, const String&);
@@ -837,6 +844,7 @@ CLASS_METHODS_META(o2::Widget)
 	PROTECTED_FUNCTION(void, OnChildFocused, Widget*);
 	PROTECTED_FUNCTION(void, OnLayerAdded, WidgetLayer*);
 	PROTECTED_FUNCTION(void, OnStateAdded, WidgetState*);
+	PROTECTED_FUNCTION(void, OnCompositionInvalidated, Widget*);
 	PROTECTED_FUNCTION(void, OnStatesListChanged);
 	PROTECTED_FUNCTION(void, DrawDebugFrame);
 	PROTECTED_FUNCTION(void, UpdateDrawingChildren);
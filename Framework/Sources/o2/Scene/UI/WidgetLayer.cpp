@@ -133,6 +133,9 @@ namespace o2
 	void WidgetLayer::SetEnabled(bool enabled)
 	{
 		mEnabled = enabled;
+
+		if (mOwnerWidget)
+			mOwnerWidget->InvalidateComposition();
 	}
 
 	WidgetLayer* WidgetLayer::AddChild(WidgetLayer* node)
@@ -379,6 +382,7 @@ namespace o2
 		if (mOwnerWidget)
 		{
 			mOwnerWidget->UpdateLayersLayouts();
+			mOwnerWidget->InvalidateComposition();
 			mOwnerWidget->OnChanged();
 		}
 
@@ -411,6 +415,9 @@ namespace o2
 		if (mDrawable)
 			mDrawable->SetTransparency(mResTransparency);
 
+		if (mOwnerWidget)
+			mOwnerWidget->InvalidateComposition();
+
 		for (auto child : mChildren)
 			child->UpdateResTransparency();
 	}
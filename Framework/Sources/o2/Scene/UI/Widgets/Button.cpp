@@ -3,6 +3,7 @@
 
 #include "o2/Render/Text.h"
 #include "o2/Scene/UI/UIManager.h"
+#include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Scene/UI/WidgetLayer.h"
 #include "o2/Scene/UI/WidgetState.h"
 
@@ -79,6 +80,15 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && isPointInside(point);
 	}
 
+	bool Button::GetCursorAreaBounds(RectF& bounds) const
+	{
+		if (!isPointInside.IsEmpty())
+			return false;
+
+		bounds = layout->GetWorldBasis().AABB();
+		return true;
+	}
+
 	String Button::GetCreateMenuGroup()
 	{
 		return "Basic";
@@ -0,0 +1,185 @@
+#include "o2/stdafx.h"
+#include "CachedWidget.h"
+
+#include "o2/Render/Render.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/System/Time/Time.h"
+
+namespace o2
+{
+	bool CachedWidget::isDebugOverlayEnabled = false;
+	int CachedWidget::mInstancesCount = 0;
+	bool CachedWidget::mRedrawingComposition = false;
+
+	CachedWidget::CachedWidget():
+		Widget()
+	{
+		mRenderTargetSprite = mnew Sprite();
+		mInstancesCount++;
+	}
+
+	CachedWidget::CachedWidget(const CachedWidget& other):
+		Widget(other), cachingEnabled(this), mCachingEnabled(other.mCachingEnabled)
+	{
+		mRenderTargetSprite = mnew Sprite();
+		mInstancesCount++;
+	}
+
+	CachedWidget::~CachedWidget()
+	{
+		EventSystem::ReleaseDrawnListenersRecord(&mDrawnListeners);
+		delete mRenderTargetSprite;
+
+		mInstancesCount--;
+	}
+
+	CachedWidget& CachedWidget::operator=(const CachedWidget& other)
+	{
+		Widget::operator=(other);
+		return *this;
+	}
+
+	void CachedWidget::Draw()
+	{
+		if (!mCachingEnabled || mRedrawingComposition || !mResEnabledInHierarchy || mIsClipped ||
+			!o2Render.IsRenderTextureAvailable() || o2Render.GetRenderTexture())
+		{
+			Widget::Draw();
+			return;
+		}
+
+		RectF scissorRect = o2Render.GetResScissorRect();
+		if (!mBoundsWithChilds.IsIntersects(scissorRect))
+			return;
+
+		RectF bounds = mBoundsWithChilds.GetIntersection(scissorRect);
+		RectF compositionRect(Math::Floor(bounds.left), Math::Ceil(bounds.top), Math::Ceil(bounds.right), Math::Floor(bounds.bottom));
+
+		bool redraw = mCompositionDirty || compositionRect != mCompositionRect || scissorRect != mCompositionScissorRect;
+		if (redraw)
+			RedrawComposition(compositionRect, scissorRect);
+
+		mRenderTargetSprite->Draw();
+
+		if (!redraw)
+			OnDrawn();
+
+		EventSystem::DrawnRecordedListeners(mDrawnListeners);
+
+		DrawDebugOverlay();
+	}
+
+	void CachedWidget::SetCachingEnabled(bool enabled)
+	{
+		mCachingEnabled = enabled;
+		mCompositionDirty = true;
+
+		if (!mCachingEnabled)
+		{
+			mRenderTarget = TextureRef();
+			mDrawnListeners.listeners.Clear();
+			mDrawnListeners.dragListeners.Clear();
+		}
+	}
+
+	bool CachedWidget::IsCachingEnabled() const
+	{
+		return mCachingEnabled;
+	}
+
+	bool CachedWidget::IsCompositionDirty() const
+	{
+		return mCompositionDirty;
+	}
+
+	int CachedWidget::GetRedrawsCount() const
+	{
+		return mRedrawsCount;
+	}
+
+	int CachedWidget::GetInstancesCount()
+	{
+		return mInstancesCount;
+	}
+
+	String CachedWidget::GetCreateMenuGroup()
+	{
+		return "Layout";
+	}
+
+	void CachedWidget::OnCompositionInvalidated(Widget* source)
+	{
+		mCompositionDirty = true;
+
+		if (isDebugOverlayEnabled)
+			mLastInvalidationSourceRect = source->layout->GetWorldRect();
+	}
+
+	void CachedWidget::RedrawComposition(const RectF& compositionRect, const RectF& scissorRect)
+	{
+		Vec2I maxSize = o2Render.GetMaxTextureSize();
+		Vec2I size(Math::Clamp((int)compositionRect.Width(), 1, maxSize.x),
+				   Math::Clamp((int)compositionRect.Height(), 1, maxSize.y));
+
+		if (!mRenderTarget || mRenderTarget->GetSize() != size)
+		{
+			mRenderTarget = TextureRef(size, PixelFormat::R8G8B8A8, Texture::Usage::RenderTarget);
+			*mRenderTargetSprite = Sprite(mRenderTarget, RectI(Vec2I(), size));
+		}
+
+		mRenderTargetSprite->SetRect(compositionRect);
+
+		mCompositionRect = compositionRect;
+		mCompositionScissorRect = scissorRect;
+
+		Camera lastCamera = o2Render.GetCamera();
+
+		mRedrawingComposition = true;
+
+		o2Render.BindRenderTexture(mRenderTarget);
+		o2Render.SetCamera(Camera(compositionRect.Center(), compositionRect.Size()));
+		o2Render.Clear(Color4(0, 0, 0, 0));
+		o2Render.EnableScissorTest(compositionRect);
+
+		EventSystem::BeginDrawnListenersRecording(&mDrawnListeners);
+		Widget::Draw();
+		EventSystem::EndDrawnListenersRecording();
+
+		o2Render.DisableScissorTest();
+		o2Render.UnbindRenderTexture();
+		o2Render.SetCamera(lastCamera);
+
+		mRedrawingComposition = false;
+
+		mCompositionDirty = false;
+		mRedrawsCount++;
+		mLastRedrawFrame = o2Time.GetCurrentFrame();
+	}
+
+	void CachedWidget::DrawDebugOverlay()
+	{
+		if (!isDebugOverlayEnabled)
+			return;
+
+		if (mLastRedrawFrame == o2Time.GetCurrentFrame())
+		{
+			o2Render.DrawRectFrame(mCompositionRect, Color4::Red());
+			o2Render.DrawRectFrame(mLastInvalidationSourceRect, Color4(255, 255, 0, 255));
+		}
+		else
+			o2Render.DrawRectFrame(mCompositionRect, Color4::Green());
+	}
+
+	void CachedWidget::CopyData(const Actor& otherActor)
+	{
+		const CachedWidget& other = dynamic_cast<const CachedWidget&>(otherActor);
+
+		Widget::CopyData(other);
+
+		mCachingEnabled = other.mCachingEnabled;
+		mCompositionDirty = true;
+	}
+}
+
+DECLARE_CLASS(o2::CachedWidget);
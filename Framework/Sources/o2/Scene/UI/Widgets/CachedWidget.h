@@ -0,0 +1,121 @@
+#pragma once
+
+#include "o2/Events/EventSystem.h"
+#include "o2/Render/TextureRef.h"
+#include "o2/Scene/UI/Widget.h"
+
+namespace o2
+{
+	class Sprite;
+
+	// -------------------------------------------------------------------------------------------------------
+	// Cached widget. Draws layers and children into render texture and redraws it only when layout, layers,
+	// transparency or children in subtree were changed. Otherwise texture is drawn and cursor listeners, drawn
+	// in subtree, are registered again. Content is blended into transparent texture, so subtrees with opaque
+	// background look best. Subtree must not contain widgets drawing into own render textures
+	// -------------------------------------------------------------------------------------------------------
+	class CachedWidget: public Widget
+	{
+	public:
+		PROPERTIES(CachedWidget);
+		PROPERTY(bool, cachingEnabled, SetCachingEnabled, IsCachingEnabled); // Is caching enabled property
+
+	public:
+		static bool isDebugOverlayEnabled; // Draws composition frames: red when redrawn on this frame, green when cached, yellow for last invalidation source
+
+	public:
+		// Default constructor
+		CachedWidget();
+
+		// Copy-constructor
+		CachedWidget(const CachedWidget& other);
+
+		// Destructor
+		~CachedWidget();
+
+		// Copy operator
+		CachedWidget& operator=(const CachedWidget& other);
+
+		// Draws cached composition, redraws it when something was changed
+		void Draw() override;
+
+		// Sets caching enabled. When caching is disabled, widget is drawn as usual
+		void SetCachingEnabled(bool enabled);
+
+		// Returns is caching enabled
+		bool IsCachingEnabled() const;
+
+		// Returns is composition will be redrawn on next drawing
+		bool IsCompositionDirty() const;
+
+		// Returns count of composition redraws
+		int GetRedrawsCount() const;
+
+		// Returns count of cached widgets instances. Compositions invalidation is skipped when there are no cached widgets
+		static int GetInstancesCount();
+
+		// Returns create menu group in editor
+		static String GetCreateMenuGroup();
+
+		SERIALIZABLE(CachedWidget);
+
+	protected:
+		static int  mInstancesCount;       // Count of cached widgets instances
+		static bool mRedrawingComposition; // True when some cached widget redraws composition, nested cached widgets are drawn as usual
+
+		bool mCachingEnabled = true; // Is caching enabled @SERIALIZABLE
+
+		TextureRef mRenderTarget;                 // Composition render texture @IGNORE
+		Sprite*    mRenderTargetSprite = nullptr; // Composition render texture sprite @IGNORE
+		RectF      mCompositionRect;              // Composition world rectangle, aligned by pixels @IGNORE
+		RectF      mCompositionScissorRect;       // Render scissor rect at composition drawing moment @IGNORE
+
+		DrawnListenersRecord mDrawnListeners; // Cursor listeners, drawn in composition. Registered again when composition isn't redrawn @IGNORE
+
+		bool  mCompositionDirty = true;    // Is composition will be redrawn on next drawing @IGNORE
+		int   mRedrawsCount = 0;           // Count of composition redraws @IGNORE
+		int   mLastRedrawFrame = -1;       // Frame index of last composition redraw @IGNORE
+		RectF mLastInvalidationSourceRect; // World rectangle of last invalidation source widget, used in debug overlay @IGNORE
+
+	protected:
+		// It is called when drawing of this widget or some of its children was changed, marks composition dirty
+		void OnCompositionInvalidated(Widget* source) override;
+
+		// Draws layers and children into render texture and records drawn cursor listeners
+		void RedrawComposition(const RectF& compositionRect, const RectF& scissorRect);
+
+		// Draws composition frames when debug overlay is enabled
+		void DrawDebugOverlay();
+
+		// Copies data of actor from other to this
+		void CopyData(const Actor& otherActor) override;
+	};
+}
+
+CLASS_BASES_META(o2::CachedWidget)
+{
+	BASE_CLASS(o2::Widget);
+}
+END_META;
+CLASS_FIELDS_META(o2::CachedWidget)
+{
+	PUBLIC_FIELD(cachingEnabled);
+	PROTECTED_FIELD(mCachingEnabled).DEFAULT_VALUE(true).SERIALIZABLE_ATTRIBUTE();
+}
+END_META;
+CLASS_METHODS_META(o2::CachedWidget)
+{
+
+	PUBLIC_FUNCTION(void, Draw);
+	PUBLIC_FUNCTION(void, SetCachingEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsCachingEnabled);
+	PUBLIC_FUNCTION(bool, IsCompositionDirty);
+	PUBLIC_FUNCTION(int, GetRedrawsCount);
+	PUBLIC_STATIC_FUNCTION(int, GetInstancesCount);
+	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
+	PROTECTED_FUNCTION(void, OnCompositionInvalidated, Widget*);
+	PROTECTED_FUNCTION(void, RedrawComposition, const RectF&, const RectF&);
+	PROTECTED_FUNCTION(void, DrawDebugOverlay);
+	PROTECTED_FUNCTION(void, CopyData, const Actor&);
+}
+END_META;
@@ -709,7 +709,7 @@ namespace o2
 
 	void ContextMenu::RebuildItems()
 	{
-		PushEditorScopeOnStack scope(IEventsListener::mIsEditorMode ? 1 : 0);
+		PushEditorScopeOnStack scope(KeyboardEventsListener::mIsEditorMode ? 1 : 0);
 
 		Vector<ContextMenuItem*> cache;
 
@@ -102,6 +102,9 @@ namespace o2
 
 		UpdateCaretBlinking(dt);
 
+		if (mIsFocused)
+			InvalidateComposition();
+
 		mJustFocused = false;
 	}
 
@@ -700,6 +703,12 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && mAbsoluteViewArea.IsInside(point);
 	}
 
+	bool EditBox::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = mAbsoluteViewArea;
+		return true;
+	}
+
 	bool EditBox::IsInputTransparent() const
 	{
 		return false;
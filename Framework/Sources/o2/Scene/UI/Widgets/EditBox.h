@@ -147,6 +147,9 @@ namespace o2
 		// Returns true if point is under drawable
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns bounds of area where listener can be under point, view area
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns true when input events can be handled by down listeners, always returns false
 		bool IsInputTransparent() const override;
 
@@ -365,6 +368,7 @@ CLASS_METHODS_META(o2::EditBox)
 	PUBLIC_FUNCTION(bool, IsScrollable);
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(bool, IsInputTransparent);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
@@ -98,6 +98,8 @@ namespace o2
 	{
 		if (mTextDrawable)
 			mTextDrawable->SetFontAsset(asset);
+
+		InvalidateComposition();
 	}
 
 	FontAssetRef Label::GetFontAsset() const
@@ -113,6 +115,8 @@ namespace o2
 		if (mTextDrawable)
 			mTextDrawable->SetText(text);
 
+		InvalidateComposition();
+
 		if (mHorOverflow == HorOverflow::Expand || mVerOverflow == VerOverflow::Expand)
 			SetLayoutDirty();
 	}
@@ -129,6 +133,8 @@ namespace o2
 	{
 		if (mTextDrawable)
 			mTextDrawable->SetColor(color);
+
+		InvalidateComposition();
 	}
 
 	Color4 Label::GetColor() const
@@ -247,6 +253,8 @@ namespace o2
 	{
 		if (mTextDrawable)
 			mTextDrawable->SetHeight(height);
+
+		InvalidateComposition();
 	}
 
 	int Label::GetHeight() const
@@ -444,6 +444,12 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool ScrollArea::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = layout->GetWorldBasis().AABB();
+		return true;
+	}
+
 	bool ScrollArea::IsScrollable() const
 	{
 		return true;
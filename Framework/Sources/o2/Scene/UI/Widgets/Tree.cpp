@@ -82,6 +82,12 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool TreeNode::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = layout->GetWorldBasis().AABB();
+		return true;
+	}
+
 	void TreeNode::SetSelectedState(bool state)
 	{
 		if (mSelectedState)
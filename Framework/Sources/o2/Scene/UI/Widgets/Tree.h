@@ -531,6 +531,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns bounds of area where listener can be under point, widget's world bounds
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Sets selected state
 		void SetSelectedState(bool state);
 
@@ -795,6 +798,7 @@ CLASS_METHODS_META(o2::TreeNode)
 	PUBLIC_FUNCTION(void, Collapse, bool);
 	PUBLIC_FUNCTION(void*, GetObject);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(void, SetSelectedState, bool);
 	PUBLIC_FUNCTION(void, SetFocusedState, bool);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
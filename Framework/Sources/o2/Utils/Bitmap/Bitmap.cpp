@@ -26,7 +26,7 @@ namespace o2
 	Bitmap::Bitmap(const Bitmap& other):
 		data(this), size(this), format(this)
 	{
-		short bpp[] ={ 4, 3 };
+		short bpp[] ={ 4, 3, 1 };
 
 		mFormat = other.mFormat;
 		mSize = other.mSize;
@@ -47,7 +47,7 @@ namespace o2
 		if (mData)
 			delete[] mData;
 
-		short bpp[] ={ 4, 3 };
+		short bpp[] ={ 4, 3, 1 };
 
 		mFormat = other.mFormat;
 		mSize = other.mSize;
@@ -69,7 +69,7 @@ namespace o2
 		if (mData)
 			delete[] mData;
 
-		short bpp[] ={ 4, 3 };
+		short bpp[] ={ 4, 3, 1 };
 
 		mFormat = format;
 		mSize = size;
@@ -148,7 +148,7 @@ namespace o2
 		if (imgSrcRect.Width() == 0)
 			imgSrcRect.Set(Vec2I(), img->GetSize());
 
-		int bpp[] ={ 4, 3 };
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 		int pixelSize = curbpp;
 
@@ -165,7 +165,7 @@ namespace o2
 				UInt srcIdx = (img->mSize.y - (y + imgSrcRect.bottom) - 1)*img->mSize.x + x + imgSrcRect.left;
 				UInt dstIdx = (mSize.y - 1 - (y + position.y))*mSize.x + x + position.x;
 
-                *(int*)&mData[dstIdx*pixelSize] = *(int*)&img->mData[srcIdx*pixelSize];
+				memcpy(&mData[dstIdx*pixelSize], &img->mData[srcIdx*pixelSize], pixelSize);
 			}
 		}
 	}
@@ -180,7 +180,7 @@ namespace o2
 		if (imgSrcRect.Width() == 0)
 			imgSrcRect.Set(Vec2I(), img->GetSize());
 
-		int bpp[] ={ 4, 3 };
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 		int pixelSize = curbpp;
 
@@ -211,7 +211,7 @@ namespace o2
 
 	void Bitmap::Colorise(const Color4& color)
 	{
-		int bpp[] ={ 4, 3 };
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		for (int x = 0; x < mSize.x*mSize.y; x++)
@@ -226,7 +226,7 @@ namespace o2
 	void Bitmap::GradientByAlpha(const Color4& color1, const Color4& color4, float angle /*= 0*/, float size /*= 0*/,
 								 Vec2F origin /*= Vec2F()*/)
 	{
-		int bpp[] ={ 4, 3 };
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		Vec2F dir = Vec2F::Rotated(Math::Deg2rad(angle + 90.0f));
@@ -256,8 +256,9 @@ namespace o2
 
 	void Bitmap::Fill(const Color4& color)
 	{
-		unsigned long colrDw = color.ARGB();
-		int bpp[] ={ 4, 3 };
+		// Alpha format pixels contain only alpha component
+		unsigned long colrDw = mFormat == PixelFormat::A8 ? (unsigned long)color.a : color.ARGB();
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		for (int x = 0; x < mSize.x*mSize.y; x++)
@@ -266,8 +267,9 @@ namespace o2
 
 	void Bitmap::FillRect(int rtLeft, int rtTop, int rtRight, int rtBottom, const Color4& color)
 	{
-		unsigned long colrDw = color.ARGB();
-		int bpp[] = { 4, 3 };
+		// Alpha format pixels contain only alpha component
+		unsigned long colrDw = mFormat == PixelFormat::A8 ? (unsigned long)color.a : color.ARGB();
+		int bpp[] = { 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		for (int x = Math::Max(rtLeft, 0); x < Math::Min(mSize.x, rtRight); x++)
@@ -295,7 +297,7 @@ namespace o2
 			}
 		}
 
-		int bpp[] = { 4, 3 };
+		int bpp[] = { 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 		UInt8* srcData = mnew UInt8[mSize.x*mSize.y*curbpp];
 		memcpy(srcData, mData, mSize.x*mSize.y*curbpp);
@@ -344,7 +346,7 @@ namespace o2
 		int alphaThreshold = threshold;
 		int radiusSquare = Math::Sqr(Math::FloorToInt(radius));
 
-		int bpp[] = { 4, 3 };
+		int bpp[] = { 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		UInt8* srcData = mnew UInt8[mSize.x*mSize.y*curbpp];
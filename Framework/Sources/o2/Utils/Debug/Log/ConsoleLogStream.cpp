@@ -30,7 +30,7 @@ namespace o2
 
 	void ConsoleLogStream::OutStrEx(const WString& str)
 	{
-#if defined PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS || defined PLATFORM_LINUX
 		puts(((String)str).Data());
 #elif defined PLATFORM_ANDROID
 		__android_log_print(ANDROID_LOG_INFO, "o2: ", "%s", ((String)str).Data());
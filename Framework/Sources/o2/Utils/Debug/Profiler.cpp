@@ -0,0 +1,334 @@
+#include "o2/stdafx.h"
+#include "Profiler.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Render/Camera.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Text.h"
+#include "o2/Render/VectorFont.h"
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/Math/Math.h"
+
+namespace o2
+{
+	std::atomic<bool> Profiler::mCapturing(false);
+	std::atomic<UInt> Profiler::mCaptureIdx(0);
+
+	thread_local Profiler::ThreadMarkers* Profiler::mCurrentThreadMarkers = nullptr;
+
+	Profiler::Profiler():
+		mStartTime(std::chrono::steady_clock::now()), mMainThreadId(std::this_thread::get_id())
+	{
+		mFrameTimes.Resize(mFrameTimesCount);
+		for (auto& time : mFrameTimes)
+			time = 0.0f;
+	}
+
+	Profiler::~Profiler()
+	{
+		mCapturing = false;
+
+		for (auto thread : mThreads)
+			delete thread;
+
+		delete mOverlayText;
+		delete mOverlayFont;
+	}
+
+	void Profiler::StartCapture()
+	{
+		// Threads buffers aren't reset here, threads may write markers now. Each thread restarts own buffer
+		// when it sees new capture index
+		mCapturing = false;
+		mCaptureIdx++;
+
+		mLastFrameMarkers.Clear();
+		mCapturing = true;
+	}
+
+	void Profiler::StopCapture()
+	{
+		mCapturing = false;
+	}
+
+	bool Profiler::SaveChromeTrace(const String& path)
+	{
+		String trace = GetChromeTrace();
+
+		OutFile file(path);
+		if (!file.IsOpened())
+			return false;
+
+		file.WriteData(trace.Data(), trace.Length());
+		return true;
+	}
+
+	String Profiler::GetChromeTrace()
+	{
+		StopCapture();
+
+		String trace = "{\"traceEvents\":[\n";
+		bool firstEvent = true;
+
+		{
+			std::unique_lock<std::mutex> lock(mThreadsMutex);
+			for (auto thread : mThreads)
+				WriteThreadTrace(trace, thread, firstEvent);
+		}
+
+		trace += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+		return trace;
+	}
+
+	void Profiler::WriteThreadTrace(String& trace, ThreadMarkers* thread, bool& firstEvent)
+	{
+		if (!firstEvent)
+			trace += ",\n";
+
+		firstEvent = false;
+
+		String threadName = thread->isMainThread ? String("Main thread") : String::Format("Thread %i", thread->threadIdx);
+		trace += String::Format("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%i,\"args\":{\"name\":\"%s\"}}",
+								thread->threadIdx, threadName.Data());
+
+		// Capture is stopped, so thread can only finish marker, that it started writing before stop
+		while (thread->writing)
+			std::this_thread::yield();
+
+		UInt64 written = GetCapturedMarkersCount(thread);
+		UInt64 first = written > (UInt64)mMarkersBufferSize ? written - mMarkersBufferSize : 0;
+
+		for (UInt64 i = first; i < written; i++)
+		{
+			const Marker& marker = thread->markers[(int)(i%mMarkersBufferSize)];
+
+			// Names are static strings from code, only quotes and slashes need escaping
+			String name;
+			for (const char* c = marker.name; *c; c++)
+			{
+				if (*c == '"' || *c == '\\')
+					name += '\\';
+
+				name += *c;
+			}
+
+			trace += String::Format(",\n{\"name\":\"%s\",\"cat\":\"o2\",\"ph\":\"X\",\"pid\":0,\"tid\":%i,\"ts\":%llu,\"dur\":%llu}",
+									name.Data(), thread->threadIdx, marker.begin, marker.end - marker.begin);
+		}
+	}
+
+	void Profiler::SetOverlayEnabled(bool enabled)
+	{
+		mOverlayEnabled = enabled;
+	}
+
+	bool Profiler::IsOverlayEnabled() const
+	{
+		return mOverlayEnabled;
+	}
+
+	float Profiler::GetLastFrameTime() const
+	{
+		return mLastFrameTime;
+	}
+
+	const Vector<Profiler::Marker>& Profiler::GetLastFrameMarkers() const
+	{
+		return mLastFrameMarkers;
+	}
+
+	void Profiler::BeginFrame()
+	{
+		mFrameMarkerBegun = IsCapturing();
+
+		if (mFrameMarkerBegun)
+			mFrameBegin = BeginMarker();
+		else
+			mFrameBegin = GetTime();
+	}
+
+	void Profiler::EndFrame()
+	{
+		if (mFrameMarkerBegun)
+			EndMarker("Frame", mFrameBegin);
+
+		UInt64 frameEnd = GetTime();
+		mLastFrameTime = (float)(frameEnd - mFrameBegin)/1000000.0f;
+
+		mFrameTimes[mFrameTimesIdx] = mLastFrameTime;
+		mFrameTimesIdx = (mFrameTimesIdx + 1)%mFrameTimesCount;
+
+		mLastFrameMarkers.Clear();
+
+		if (!IsCapturing())
+			return;
+
+		// Main thread buffer is written only by this thread, so it is safe to read it here
+		ThreadMarkers* thread = GetThreadMarkers();
+		UInt64 written = GetCapturedMarkersCount(thread);
+		UInt64 first = written > (UInt64)mMarkersBufferSize ? written - mMarkersBufferSize : 0;
+
+		for (UInt64 i = written; i > first; i--)
+		{
+			const Marker& marker = thread->markers[(int)((i - 1)%mMarkersBufferSize)];
+			if (marker.end < mFrameBegin)
+				break;
+
+			mLastFrameMarkers.Add(marker);
+		}
+
+		// Markers are written when scopes end, so they are sorted by begin to restore hierarchy order
+		mLastFrameMarkers.Sort([](const Marker& a, const Marker& b) { return a.begin < b.begin; });
+	}
+
+	void Profiler::DrawOverlay()
+	{
+		if (!mOverlayEnabled)
+			return;
+
+		if (!mOverlayText)
+		{
+			mOverlayFont = mnew VectorFont(o2Assets.GetBuiltAssetsPath() + "debugFont.ttf");
+			mOverlayText = mnew Text(FontRef(mOverlayFont));
+			mOverlayText->SetHorAlign(HorAlign::Left);
+			mOverlayText->SetVerAlign(VerAlign::Top);
+		}
+
+		const float graphWidth = 240.0f;
+		const float graphHeight = 60.0f;
+		const float graphMaxTime = 1.0f/20.0f;
+		const float frameBudget = 1.0f/60.0f;
+		const int maxDepth = 2;
+
+		Camera prevCamera = o2Render.GetCamera();
+		o2Render.SetCamera(Camera::Default());
+
+		Vec2F resolution = (Vec2F)o2Render.GetResolution();
+		Vec2F leftTop(-resolution.x*0.5f + 10.0f, resolution.y*0.5f - 10.0f);
+		Vec2F leftBottom = leftTop - Vec2F(0.0f, graphHeight);
+
+		o2Render.DrawFilledPolygon({ leftBottom, leftTop, leftTop + Vec2F(graphWidth, 0.0f),
+								   leftBottom + Vec2F(graphWidth, 0.0f) }, Color4(0, 0, 0, 150));
+
+		float barWidth = graphWidth/(float)mFrameTimesCount;
+		float maxFrameTime = 0.0f;
+		for (int i = 0; i < mFrameTimesCount; i++)
+		{
+			float time = mFrameTimes[(mFrameTimesIdx + i)%mFrameTimesCount];
+			maxFrameTime = Math::Max(maxFrameTime, time);
+
+			float height = Math::Min(time/graphMaxTime, 1.0f)*graphHeight;
+			Vec2F barBottom = leftBottom + Vec2F(barWidth*((float)i + 0.5f), 0.0f);
+			o2Render.DrawLine(barBottom, barBottom + Vec2F(0.0f, height), time > frameBudget ? Color4::Red() : Color4::Green());
+		}
+
+		float budgetHeight = frameBudget/graphMaxTime*graphHeight;
+		o2Render.DrawLine(leftBottom + Vec2F(0.0f, budgetHeight), leftBottom + Vec2F(graphWidth, budgetHeight),
+						  Color4(255, 255, 0, 200));
+
+		String caption = String::Format("Frame %.2f ms, max %.2f ms", mLastFrameTime*1000.0f, maxFrameTime*1000.0f);
+		if (!IsCapturing())
+			caption += "\nNot capturing";
+
+		for (auto& marker : mLastFrameMarkers)
+		{
+			if (marker.depth > maxDepth)
+				continue;
+
+			caption += "\n";
+			for (int i = 0; i < marker.depth; i++)
+				caption += "  ";
+
+			caption += String::Format("%s %.2f ms", marker.name, (float)(marker.end - marker.begin)/1000.0f);
+		}
+
+		mOverlayText->SetRect(RectF(leftBottom.x, leftBottom.y - 5.0f, leftBottom.x + 500.0f, -resolution.y*0.5f));
+		mOverlayText->SetText(caption);
+		mOverlayText->Draw();
+
+		o2Render.SetCamera(prevCamera);
+	}
+
+	UInt64 Profiler::GetTime()
+	{
+		auto duration = std::chrono::steady_clock::now() - mInstance->mStartTime;
+		return (UInt64)std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+	}
+
+	UInt64 Profiler::BeginMarker()
+	{
+		GetThreadMarkers()->depth++;
+		return GetTime();
+	}
+
+	void Profiler::EndMarker(const char* name, UInt64 begin)
+	{
+		UInt64 end = GetTime();
+
+		ThreadMarkers* thread = GetThreadMarkers();
+		thread->depth--;
+
+		if (!IsCapturing())
+			return;
+
+		// Writing flag is set before capturing is checked again with sequentially consistent order, so when capture
+		// is stopped after this check, exporter sees the flag and waits for the marker
+		thread->writing = true;
+
+		if (!mCapturing.load())
+		{
+			thread->writing = false;
+			return;
+		}
+
+		UInt captureIdx = mCaptureIdx.load();
+		if (thread->captureIdx.load(std::memory_order_relaxed) != captureIdx)
+		{
+			thread->written.store(0, std::memory_order_relaxed);
+			thread->captureIdx.store(captureIdx, std::memory_order_relaxed);
+		}
+
+		UInt64 written = thread->written.load(std::memory_order_relaxed);
+
+		Marker& marker = thread->markers[(int)(written%mMarkersBufferSize)];
+		marker.name = name;
+		marker.begin = begin;
+		marker.end = end;
+		marker.depth = thread->depth;
+
+		thread->written.store(written + 1, std::memory_order_release);
+		thread->writing = false;
+	}
+
+	UInt64 Profiler::GetCapturedMarkersCount(ThreadMarkers* thread)
+	{
+		// Buffer from previous capture wasn't restarted, thread hasn't written markers in current capture
+		if (thread->captureIdx != mCaptureIdx)
+			return 0;
+
+		return thread->written;
+	}
+
+	Profiler::ThreadMarkers* Profiler::GetThreadMarkers()
+	{
+		if (mCurrentThreadMarkers)
+			return mCurrentThreadMarkers;
+
+		ThreadMarkers* thread = mnew ThreadMarkers();
+		thread->isMainThread = std::this_thread::get_id() == mInstance->mMainThreadId;
+		thread->markers.Resize(mMarkersBufferSize);
+		thread->written = 0;
+		thread->captureIdx = mCaptureIdx.load();
+		thread->writing = false;
+
+		{
+			std::unique_lock<std::mutex> lock(mInstance->mThreadsMutex);
+			thread->threadIdx = mInstance->mThreads.Count();
+			mInstance->mThreads.Add(thread);
+		}
+
+		mCurrentThreadMarkers = thread;
+		return thread;
+	}
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "o2/EngineSettings.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+// Profiler access macros
+#define o2Profiler o2::Profiler::Instance()
+
+#define PROFILE_SCOPE_CONCAT_IMPL(A, B) A##B
+#define PROFILE_SCOPE_CONCAT(A, B) PROFILE_SCOPE_CONCAT_IMPL(A, B)
+
+// Profiles current scope with name. Name must be string literal, it is stored by pointer
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(NAME) o2::ProfileScope PROFILE_SCOPE_CONCAT(profileScope, __LINE__)(NAME)
+#else
+#define PROFILE_SCOPE(NAME)
+#endif
+
+namespace o2
+{
+	class Text;
+	class VectorFont;
+
+	// -------------------------------------------------------------------------------------------------------------
+	// Frame profiler. Collects scoped CPU markers from all threads while capturing. Each thread writes markers into
+	// own ring buffer without locking, so buffers keep last markers of long captures. Captures are exported into
+	// Chrome trace JSON format, last frame markers and frame times are shown in overlay
+	// -------------------------------------------------------------------------------------------------------------
+	class Profiler: public Singleton<Profiler>
+	{
+	public:
+		// ---------------------------------
+		// Finished marker of profiled scope
+		// ---------------------------------
+		struct Marker
+		{
+			const char* name;  // Name of marker
+			UInt64      begin; // Begin time in microseconds from profiler creation
+			UInt64      end;   // End time in microseconds from profiler creation
+			int         depth; // Depth of marker in thread markers hierarchy
+		};
+
+	public:
+		// Returns true when markers are recording
+		static bool IsCapturing();
+
+		// Starts recording markers. Previous capture is cleared: threads buffers from previous captures are skipped and
+		// each thread restarts own buffer when writes first marker of new capture
+		void StartCapture();
+
+		// Stops recording markers
+		void StopCapture();
+
+		// Stops capture and saves captured markers of all threads into file in Chrome trace format
+		bool SaveChromeTrace(const String& path);
+
+		// Stops capture and returns captured markers of all threads in Chrome trace format
+		String GetChromeTrace();
+
+		// Sets overlay with frame times and last frame markers visible
+		void SetOverlayEnabled(bool enabled);
+
+		// Returns is overlay visible
+		bool IsOverlayEnabled() const;
+
+		// Returns duration of last frame in seconds
+		float GetLastFrameTime() const;
+
+		// Returns markers of main thread in last frame. Filled only while capturing
+		const Vector<Marker>& GetLastFrameMarkers() const;
+
+		// Called from main thread when frame begins
+		void BeginFrame();
+
+		// Called from main thread when frame ends. Stores frame time and last frame markers
+		void EndFrame();
+
+		// Draws overlay in screen space, when it is enabled
+		void DrawOverlay();
+
+		// Returns current time in microseconds from profiler creation
+		static UInt64 GetTime();
+
+		// Called when profiled scope begins. Returns begin time
+		static UInt64 BeginMarker();
+
+		// Called when profiled scope ends. Writes marker into current thread buffer
+		static void EndMarker(const char* name, UInt64 begin);
+
+	protected:
+		// ----------------------------------------------------------------------------------------------------------
+		// Thread markers ring buffer. Written and restarted only by owner thread, written count grows within capture
+		// ----------------------------------------------------------------------------------------------------------
+		struct ThreadMarkers
+		{
+			int                 threadIdx;    // Index of thread in profiler
+			bool                isMainThread; // Is it main thread buffer
+			Vector<Marker>      markers;      // Markers ring buffer
+			std::atomic<UInt64> written;      // Count of written markers in capture
+			std::atomic<UInt>   captureIdx;   // Index of capture, which markers are written in buffer
+			std::atomic<bool>   writing;      // True while owner thread writes marker, buffer can't be read
+			int                 depth = 0;    // Current depth of scopes
+		};
+
+		static const int mMarkersBufferSize = 65536; // Size of thread markers ring buffer
+		static const int mFrameTimesCount = 120;     // Count of frame times, stored for overlay
+
+		static std::atomic<bool> mCapturing;  // Are markers recording
+		static std::atomic<UInt> mCaptureIdx; // Index of current capture. Increased when capture starts
+
+		static thread_local ThreadMarkers* mCurrentThreadMarkers; // Markers buffer of current thread
+
+		std::chrono::steady_clock::time_point mStartTime;    // Profiler creation time
+		std::thread::id                       mMainThreadId; // Main thread id, that creates profiler
+
+		std::mutex             mThreadsMutex; // Threads buffers list mutex
+		Vector<ThreadMarkers*> mThreads;      // Threads markers buffers. Kept until profiler is destroyed
+
+		UInt64         mFrameBegin = 0;           // Current frame begin time
+		bool           mFrameMarkerBegun = false; // Is current frame marker recording
+		float          mLastFrameTime = 0.0f;     // Duration of last frame in seconds
+		Vector<float>  mFrameTimes;               // Ring buffer of last frames durations in seconds
+		int            mFrameTimesIdx = 0;        // Next frame time index in ring buffer
+		Vector<Marker> mLastFrameMarkers;         // Markers of main thread in last frame
+
+		bool        mOverlayEnabled = false; // Is overlay visible
+		VectorFont* mOverlayFont = nullptr;  // Overlay captions font. Created on first drawing
+		Text*       mOverlayText = nullptr;  // Overlay captions text
+
+	protected:
+		// Returns current thread markers buffer, registers it on first call
+		static ThreadMarkers* GetThreadMarkers();
+
+		// Returns count of markers, written by thread in current capture
+		static UInt64 GetCapturedMarkersCount(ThreadMarkers* thread);
+
+		// Appends markers of thread in Chrome trace format. Waits until thread finishes writing marker
+		void WriteThreadTrace(String& trace, ThreadMarkers* thread, bool& firstEvent);
+
+	private:
+		// Default constructor
+		Profiler();
+
+		// Destructor
+		~Profiler();
+
+		friend class Singleton<Profiler>;
+		friend class Application;
+	};
+
+	// ---------------------------------------------------------------------------------------------------------
+	// Profiled scope. Writes marker when scope ends. Costs one atomic flag check when profiler is not capturing
+	// ---------------------------------------------------------------------------------------------------------
+	class ProfileScope
+	{
+	public:
+		// Constructor. Begins marker with name when profiler is capturing
+		ProfileScope(const char* name);
+
+		// Destructor. Ends marker
+		~ProfileScope();
+
+	protected:
+		const char* mName;  // Name of marker. Null when profiler wasn't capturing
+		UInt64      mBegin; // Begin time
+	};
+
+	inline bool Profiler::IsCapturing()
+	{
+		return mCapturing.load(std::memory_order_relaxed);
+	}
+
+	inline ProfileScope::ProfileScope(const char* name):
+		mName(Profiler::IsCapturing() ? name : nullptr), mBegin(0)
+	{
+		if (mName)
+			mBegin = Profiler::BeginMarker();
+	}
+
+	inline ProfileScope::~ProfileScope()
+	{
+		if (mName)
+			Profiler::EndMarker(mName, mBegin);
+	}
+}
@@ -7,7 +7,9 @@
 namespace o2
 {
 	DragableObject::DragableObject():CursorAreaEventsListener()
-	{}
+	{
+		mDragableObject = this;
+	}
 
 	DragableObject::~DragableObject()
 	{
@@ -127,6 +129,8 @@ namespace o2
 
 	void DragableObject::OnDrawn()
 	{
+		mDragableObject = this;
+
 		CursorAreaEventsListener::OnDrawn();
 		EventSystem::RegDragListener(this);
 	}
@@ -0,0 +1,302 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+#include "o2/Application/Application.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace o2
+{
+	// Converts file time to local time stamp
+	static TimeStamp ToLocalTimeStamp(time_t time)
+	{
+		struct tm local;
+		localtime_r(&time, &local);
+
+		return TimeStamp(local.tm_sec, local.tm_min, local.tm_hour, local.tm_mday, local.tm_mon + 1, local.tm_year + 1900);
+	}
+
+	FolderInfo FileSystem::GetFolderInfo(const String& path) const
+	{
+		FolderInfo res;
+		res.path = path;
+
+		DIR* dir = opendir(path.Data());
+		if (!dir)
+		{
+			mInstance->mLog->Error("Failed GetPathInfo: Error opening directory " + path);
+			return res;
+		}
+
+		while (dirent* entry = readdir(dir))
+		{
+			if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+				continue;
+
+			String entryPath = path + "/" + entry->d_name;
+			if (IsFolderExist(entryPath))
+				res.folders.Add(GetFolderInfo(entryPath));
+			else
+				res.files.Add(GetFileInfo(entryPath));
+		}
+
+		closedir(dir);
+
+		return res;
+	}
+
+	bool FileSystem::FileCopy(const String& source, const String& dest) const
+	{
+		FileDelete(dest);
+		FolderCreate(ExtractPathStr(dest));
+
+		FILE* sourceFile = fopen(source.Data(), "rb");
+		if (!sourceFile)
+			return false;
+
+		FILE* destFile = fopen(dest.Data(), "wb");
+		if (!destFile)
+		{
+			fclose(sourceFile);
+			return false;
+		}
+
+		char buffer[64*1024];
+		bool res = true;
+		while (size_t readBytes = fread(buffer, 1, sizeof(buffer), sourceFile))
+		{
+			if (fwrite(buffer, 1, readBytes, destFile) != readBytes)
+			{
+				res = false;
+				break;
+			}
+		}
+
+		fclose(sourceFile);
+		fclose(destFile);
+
+		return res;
+	}
+
+	bool FileSystem::FileDelete(const String& file) const
+	{
+		return unlink(file.Data()) == 0;
+	}
+
+	bool FileSystem::FileMove(const String& source, const String& dest) const
+	{
+		String destFolder = GetParentPath(dest);
+
+		if (!IsFolderExist(destFolder))
+			FolderCreate(destFolder);
+
+		return rename(source.Data(), dest.Data()) == 0;
+	}
+
+	FileInfo FileSystem::GetFileInfo(const String& path) const
+	{
+		FileInfo res;
+		res.path = "invalid_file";
+
+		struct stat info;
+		if (stat(path.Data(), &info) != 0)
+			return res;
+
+		// There is no creation time in POSIX stat, status change time is the nearest one
+		res.createdDate = ToLocalTimeStamp(info.st_ctime);
+		res.accessDate = ToLocalTimeStamp(info.st_atime);
+		res.editDate = ToLocalTimeStamp(info.st_mtime);
+
+		res.path = path;
+		res.size = info.st_size;
+
+		return res;
+	}
+
+	bool FileSystem::SetFileEditDate(const String& path, const TimeStamp& time) const
+	{
+		struct tm local = {};
+		local.tm_sec = time.mSecond;
+		local.tm_min = time.mMinute;
+		local.tm_hour = time.mHour;
+		local.tm_mday = time.mDay;
+		local.tm_mon = time.mMonth - 1;
+		local.tm_year = time.mYear - 1900;
+		local.tm_isdst = -1;
+
+		struct timespec times[2];
+		times[0].tv_sec = 0;
+		times[0].tv_nsec = UTIME_OMIT;
+		times[1].tv_sec = mktime(&local);
+		times[1].tv_nsec = 0;
+
+		return utimensat(AT_FDCWD, path.Data(), times, 0) == 0;
+	}
+
+	bool FileSystem::FolderCreate(const String& path, bool recursive /*= true*/) const
+	{
+		if (IsFolderExist(path))
+			return true;
+
+		if (!recursive)
+			return mkdir(path.Data(), 0755) == 0;
+
+		if (mkdir(path.Data(), 0755) == 0)
+			return true;
+
+		String extrPath = ExtractPathStr(path);
+		if (extrPath == path)
+			return false;
+
+		if (!FolderCreate(extrPath, true))
+			return false;
+
+		return mkdir(path.Data(), 0755) == 0;
+	}
+
+	bool FileSystem::FolderCopy(const String& from, const String& to) const
+	{
+		if (!IsFolderExist(from) || !IsFolderExist(to))
+			return false;
+
+		String destPath = to + "/" + GetPathWithoutDirectories(from);
+		if (!FolderCreate(destPath))
+			return false;
+
+		DIR* dir = opendir(from.Data());
+		if (!dir)
+			return false;
+
+		bool res = true;
+		while (dirent* entry = readdir(dir))
+		{
+			if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+				continue;
+
+			String entryPath = from + "/" + entry->d_name;
+			if (IsFolderExist(entryPath))
+				res = FolderCopy(entryPath, destPath) && res;
+			else
+				res = FileCopy(entryPath, destPath + "/" + entry->d_name) && res;
+		}
+
+		closedir(dir);
+
+		return res;
+	}
+
+	bool FileSystem::FolderRemove(const String& path, bool recursive /*= true*/) const
+	{
+		if (!IsFolderExist(path))
+			return false;
+
+		if (!recursive)
+			return rmdir(path.Data()) == 0;
+
+		DIR* dir = opendir(path.Data());
+		if (dir)
+		{
+			while (dirent* entry = readdir(dir))
+			{
+				if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+					continue;
+
+				String entryPath = path + "/" + entry->d_name;
+				if (IsFolderExist(entryPath))
+					FolderRemove(entryPath, true);
+				else
+					FileDelete(entryPath);
+			}
+
+			closedir(dir);
+		}
+
+		return rmdir(path.Data()) == 0;
+	}
+
+	bool FileSystem::Rename(const String& old, const String& newPath) const
+	{
+		int res = rename(old, newPath);
+		return res == 0;
+	}
+
+	bool FileSystem::IsFolderExist(const String& path) const
+	{
+		struct stat info;
+		if (stat(path.Data(), &info) != 0)
+			return false;
+
+		return S_ISDIR(info.st_mode);
+	}
+
+	bool FileSystem::IsFileExist(const String& path) const
+	{
+		struct stat info;
+		if (stat(path.Data(), &info) != 0)
+			return false;
+
+		return !S_ISDIR(info.st_mode);
+	}
+
+	String FileSystem::GetPathRelativeToPath(const String& from, const String& to)
+	{
+		auto fromParts = CanonicalizePath(from).Split("/");
+		auto toParts = CanonicalizePath(to).Split("/");
+
+		fromParts.RemoveAll([](const String& x) { return x.IsEmpty(); });
+		toParts.RemoveAll([](const String& x) { return x.IsEmpty(); });
+
+		int common = 0;
+		while (common < fromParts.Count() && common < toParts.Count() && fromParts[common] == toParts[common])
+			common++;
+
+		String res = ".";
+		for (int i = common; i < fromParts.Count(); i++)
+			res += "/..";
+
+		for (int i = common; i < toParts.Count(); i++)
+			res += "/" + toParts[i];
+
+		return res;
+	}
+
+	String FileSystem::CanonicalizePath(const String& path)
+	{
+		Vector<String> resParts;
+		for (auto& part : path.ReplacedAll("\\", "/").Split("/"))
+		{
+			if (part == ".")
+				continue;
+
+			if (part == ".." && !resParts.IsEmpty() && resParts.Last() != ".." && !resParts.Last().IsEmpty())
+			{
+				resParts.PopBack();
+				continue;
+			}
+
+			resParts.Add(part);
+		}
+
+		String res;
+		for (int i = 0; i < resParts.Count(); i++)
+		{
+			if (i > 0)
+				res += "/";
+
+			res += resParts[i];
+		}
+
+		return res;
+	}
+}
+
+#endif // PLATFORM_LINUX
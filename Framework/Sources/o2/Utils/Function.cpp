@@ -0,0 +1,60 @@
+#include "o2/stdafx.h"
+#include "Function.h"
+
+#include "o2/Utils/Memory/Allocators/BlocksPoolAllocator.h"
+
+namespace o2
+{
+	static constexpr int minPooledBlockCapacity = 4;     // Minimal slots block capacity
+	static constexpr int maxPooledBlockCapacity = 64;    // Maximal pooled slots block capacity, bigger blocks are allocated in heap
+	static constexpr int pooledBlockCapacitiesCount = 5; // Count of pooled capacities: 4, 8, 16, 32, 64
+
+	// Returns pools of slots blocks. Pools are never destroyed, so static delegates can be destroyed after them
+	static BlocksPoolAllocator** GetSlotsBlocksPools()
+	{
+		static BlocksPoolAllocator** pools = []()
+		{
+			BlocksPoolAllocator** res = new BlocksPoolAllocator*[pooledBlockCapacitiesCount];
+			for (int i = 0; i < pooledBlockCapacitiesCount; i++)
+			{
+				size_t blockSize = FunctionSlotsAllocator::slotSize*(minPooledBlockCapacity << i);
+				res[i] = new BlocksPoolAllocator(blockSize, 4096/blockSize + 1);
+			}
+
+			return res;
+		}();
+
+		return pools;
+	}
+
+	void* FunctionSlotsAllocator::Allocate(int count, int& capacity)
+	{
+		capacity = minPooledBlockCapacity;
+		int poolIdx = 0;
+		while (capacity < count)
+		{
+			capacity *= 2;
+			poolIdx++;
+		}
+
+		if (capacity > maxPooledBlockCapacity)
+			return DefaultAllocator::GetInstance()->Allocate(slotSize*capacity);
+
+		return GetSlotsBlocksPools()[poolIdx]->Allocate(slotSize*capacity);
+	}
+
+	void FunctionSlotsAllocator::Free(void* block, int capacity)
+	{
+		if (capacity > maxPooledBlockCapacity)
+		{
+			DefaultAllocator::GetInstance()->Deallocate(block);
+			return;
+		}
+
+		int poolIdx = 0;
+		for (int poolCapacity = minPooledBlockCapacity; poolCapacity < capacity; poolCapacity *= 2)
+			poolIdx++;
+
+		GetSlotsBlocksPools()[poolIdx]->Deallocate(block);
+	}
+}
@@ -7,6 +7,23 @@
 
 namespace o2
 {
+	// ---------------------------------------------------------------------------------------------------
+	// Allocator of functors slots blocks for delegates with many functors. Blocks with small capacity are
+	// taken from pools, so delegates combining and copying doesn't allocate memory from heap. Thread safe
+	// ---------------------------------------------------------------------------------------------------
+	class FunctionSlotsAllocator
+	{
+	public:
+		static constexpr UInt slotSize = 4*sizeof(void*); // Size of one functor slot
+
+	public:
+		// Allocates slots block for count of slots at least. Returns real block capacity in capacity
+		static void* Allocate(int count, int& capacity);
+
+		// Frees slots block with capacity
+		static void Free(void* block, int capacity);
+	};
+
 	template <typename UnusedType>
 	class IFunction;
 
@@ -26,6 +43,9 @@ namespace o2
 		// Returns cloned emplace copy of this in memory
 		virtual IFunction* Clone(void* memory) const = 0;
 
+		// Moves this into memory and returns moved copy. This stays valid, but can be empty
+		virtual IFunction* Move(void* memory) = 0;
+
 		// Invokes function with arguments
 		virtual _res_type Invoke(_args ... args) const = 0;
 
@@ -87,11 +107,17 @@ namespace o2
 		}
 
 		// Returns cloned emplace copy of this in memory
-		IFunction* Clone(void* memory) const
+		IFunction<_res_type(_args ...)>* Clone(void* memory) const
 		{
 			return new (memory) FunctionPtr(*this);
 		}
 
+		// Moves this into memory and returns moved copy. This stays valid, but can be empty
+		IFunction<_res_type(_args ...)>* Move(void* memory)
+		{
+			return new (memory) FunctionPtr(std::move(*this));
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -167,6 +193,12 @@ namespace o2
 			return new (memory) ObjFunctionPtr(*this);
 		}
 
+		// Moves this into memory and returns moved copy. This stays valid, but can be empty
+		IFunction<_res_type(_args ...)>* Move(void* memory)
+		{
+			return new (memory) ObjFunctionPtr(std::move(*this));
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -242,6 +274,12 @@ namespace o2
 			return new (memory) ObjConstFunctionPtr(*this);
 		}
 
+		// Moves this into memory and returns moved copy. This stays valid, but can be empty
+		IFunction<_res_type(_args ...)>* Move(void* memory)
+		{
+			return new (memory) ObjConstFunctionPtr(std::move(*this));
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -313,6 +351,12 @@ namespace o2
 			return new (memory) SharedLambda(*this);
 		}
 
+		// Moves this into memory and returns moved copy. This stays valid, but can be empty
+		IFunction<_res_type(_args ...)>* Move(void* memory)
+		{
+			return new (memory) SharedLambda(std::move(*this));
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -351,70 +395,285 @@ namespace o2
 	template <typename UnusedType>
 	class Function;
 
-	// --------------------------------------------------
-	// Combined delegate. Can contain many other functors
-	// --------------------------------------------------
+	// ---------------------------------------------------------------------------------------------------------
+	// Combined delegate. Can contain many other functors. Functors are stored by value in slots. First slots
+	// are inside delegate, when they are over, functors are moved into slots block from FunctionSlotsAllocator.
+	// Functors bigger than slot are allocated in heap and stored in slot by pointer.
+	// Functors aren't moved or destroyed while delegate is invoking: removed functors are marked and
+	// destroyed after invoking, when slots are over old slots are kept until invoking finishes
+	// ---------------------------------------------------------------------------------------------------------
 	template<typename _res_type, typename ... _args>
 	class Function<_res_type(_args ...)>: public IFunction<_res_type(_args ...)>
 	{
-		enum class DataType { Empty, OneFunction, CoupleOfFunctions };
+		// ----------------------------------------------------------
+		// Functor in heap, used for functors which don't fit in slot
+		// ----------------------------------------------------------
+		class HeapFunction: public IFunction<_res_type(_args ...)>
+		{
+		public:
+			IFunction<_res_type(_args ...)>* function; // Owned functor
+
+		public:
+			// Constructor, takes ownership of functor
+			HeapFunction(IFunction<_res_type(_args ...)>* function):
+				function(function)
+			{}
+
+			// Move-constructor
+			HeapFunction(HeapFunction&& other):
+				function(other.function)
+			{
+				other.function = nullptr;
+			}
 
-		static constexpr UInt payloadSize = sizeof(std::vector<void*>);
-		static constexpr UInt dataSize = payloadSize + sizeof(DataType);
+			// Destructor
+			~HeapFunction()
+			{
+				delete function;
+			}
 
-		struct TypeData
-		{
-			Byte padding[payloadSize];
-			DataType type;
+			// Returns cloned copy of this
+			IFunction<_res_type(_args ...)>* Clone() const
+			{
+				return mnew HeapFunction(function->Clone());
+			}
+
+			// Returns cloned emplace copy of this in memory
+			IFunction<_res_type(_args ...)>* Clone(void* memory) const
+			{
+				return new (memory) HeapFunction(function->Clone());
+			}
+
+			// Moves this into memory and returns moved copy. This stays valid, but can be empty
+			IFunction<_res_type(_args ...)>* Move(void* memory)
+			{
+				return new (memory) HeapFunction(std::move(*this));
+			}
+
+			// Invokes function with arguments as functor
+			_res_type Invoke(_args ... args) const
+			{
+				return function->Invoke(args ...);
+			}
+
+			// Returns true if functions is equal
+			bool Equals(const IFunction<_res_type(_args ...)>* other) const
+			{
+				return function->Equals(Unwrap(other));
+			}
+
+			// Returns size of function
+			UInt GetSizeOf() const override
+			{
+				return sizeof(*this);
+			}
 		};
 
-		struct OneFunctionData
+		// ------------------------------------------------------------------
+		// Functor slot. Aligned as malloc() result, so can store any functor
+		// ------------------------------------------------------------------
+		struct Slot
 		{
-			static constexpr UInt capacity = payloadSize - sizeof(void*);
-
-			Byte functionData[capacity];
-			void(*destructor)(IFunction<_res_type(_args ...)>*) = nullptr;
+			alignas(std::max_align_t) Byte data[FunctionSlotsAllocator::slotSize];
 		};
 
-		union Data
+		// ------------------------------------------------------------------------------------------
+		// Slots, replaced while delegate was invoking. Functors in them are destroyed after invoking
+		// ------------------------------------------------------------------------------------------
+		struct RetiredSlots
 		{
-			std::vector<IFunction<_res_type(_args ...)>*> functions;
+			Slot*         slots;    // Retired slots
+			int           count;    // Count of functors in slots
+			int           capacity; // Slots capacity
+			RetiredSlots* prev;     // Previous retired slots
+		};
 
-			OneFunctionData oneFunctionData;
+		static constexpr int inlineSlotsCount = 2; // Count of slots inside delegate
 
-			TypeData typeData;
+		Slot  mInlineSlots[inlineSlotsCount]; // Slots inside delegate
+		Slot* mSlots = mInlineSlots;          // Current slots: inside delegate or from FunctionSlotsAllocator
+		int   mCount = 0;                     // Count of functors
+		int   mCapacity = inlineSlotsCount;   // Current slots capacity
 
-			Data() { typeData.type = DataType::Empty; }
-			~Data() {}
-		};
+		mutable int                mInvokeDepth = 0;        // Depth of nested invokes, functors aren't moved when it isn't zero
+		mutable std::vector<bool>* mRemovedSlots = nullptr; // Flags of functors, removed while invoking. Created on first such removing
+		mutable RetiredSlots*      mRetired = nullptr;      // Slots, replaced while invoking
+
+		// Returns functor in slot
+		IFunction<_res_type(_args ...)>* SlotFunction(int idx) const
+		{
+			return reinterpret_cast<IFunction<_res_type(_args ...)>*>(mSlots[idx].data);
+		}
+
+		// Returns true when functor in slot was removed while invoking and waits destroying
+		bool IsRemovedSlot(int idx) const
+		{
+			return mRemovedSlots && idx < (int)mRemovedSlots->size() && (*mRemovedSlots)[idx];
+		}
+
+		// Returns functor inside heap functor wrapper, or functor itself
+		static const IFunction<_res_type(_args ...)>* Unwrap(const IFunction<_res_type(_args ...)>* function)
+		{
+			if (auto heapFunction = dynamic_cast<const HeapFunction*>(function))
+				return heapFunction->function;
 
-		Data mData;
+			return function;
+		}
 
-		IFunction<_res_type(_args ...)>& OneFunctionRef() const
+		// Returns true when functor of type can be stored in slot by value
+		template<typename _function_type>
+		static constexpr bool FitsSlot()
 		{
-			return *const_cast<Function<_res_type(_args ...)>*>(reinterpret_cast<const Function<_res_type(_args ...)>*>(mData.oneFunctionData.functionData));
+			return sizeof(_function_type) <= FunctionSlotsAllocator::slotSize && alignof(_function_type) <= alignof(Slot);
 		}
 
-		void DestroyOneFunction()
+		// Returns memory for new functor, moves functors into bigger slots when there is no free slot
+		void* NewSlot()
 		{
-			if (mData.oneFunctionData.destructor)
-				(*mData.oneFunctionData.destructor)(&OneFunctionRef());
+			if (mCount == mCapacity)
+				Reallocate(mCount + 1);
+
+			return mSlots[mCount].data;
 		}
 
-		void ConvertToCoupleFunctionsType()
+		// Moves functors into slots with capacity for count of functors at least
+		void Reallocate(int count)
 		{
-			if (mData.typeData.type == DataType::OneFunction)
+			int capacity;
+			Slot* slots = (Slot*)FunctionSlotsAllocator::Allocate(count, capacity);
+
+			if (mInvokeDepth > 0)
 			{
-				IFunction<_res_type(_args ...)>* firstFunction = OneFunctionRef().Clone();
-				DestroyOneFunction();
+				for (int i = 0; i < mCount; i++)
+					SlotFunction(i)->Clone(slots[i].data);
 
-				new (&mData.functions) std::vector<IFunction<_res_type(_args ...)>*>();
-				mData.functions.push_back(firstFunction);
+				mRetired = mnew RetiredSlots{ mSlots, mCount, mCapacity, mRetired };
 			}
 			else
-				new (&mData.functions) std::vector<IFunction<_res_type(_args ...)>*>();
+			{
+				for (int i = 0; i < mCount; i++)
+				{
+					SlotFunction(i)->Move(slots[i].data);
+					SlotFunction(i)->~IFunction<_res_type(_args ...)>();
+				}
+
+				if (mSlots != mInlineSlots)
+					FunctionSlotsAllocator::Free(mSlots, mCapacity);
+			}
+
+			mSlots = slots;
+			mCapacity = capacity;
+		}
+
+		// Removes functor from slot. When delegate is invoking, functor can be invoking now, so it is only marked
+		// as removed and destroyed after invoking
+		void RemoveSlot(int idx)
+		{
+			if (mInvokeDepth > 0)
+			{
+				if (!mRemovedSlots)
+					mRemovedSlots = mnew std::vector<bool>();
+
+				if ((int)mRemovedSlots->size() < mCount)
+					mRemovedSlots->resize(mCount, false);
+
+				(*mRemovedSlots)[idx] = true;
+				return;
+			}
+
+			SlotFunction(idx)->~IFunction<_res_type(_args ...)>();
+
+			for (int i = idx + 1; i < mCount; i++)
+			{
+				SlotFunction(i)->Move(mSlots[i - 1].data);
+				SlotFunction(i)->~IFunction<_res_type(_args ...)>();
+			}
+
+			mCount--;
+		}
+
+		// Destroys all functors and releases slots block
+		void DestroyFunctions()
+		{
+			for (int i = 0; i < mCount; i++)
+				SlotFunction(i)->~IFunction<_res_type(_args ...)>();
+
+			mCount = 0;
 
-			mData.typeData.type = DataType::CoupleOfFunctions;
+			if (mSlots != mInlineSlots && mInvokeDepth == 0)
+			{
+				FunctionSlotsAllocator::Free(mSlots, mCapacity);
+				mSlots = mInlineSlots;
+				mCapacity = inlineSlotsCount;
+			}
+		}
+
+		// It is called when invoking is finished. Destroys retired slots and removes functors, removed while invoking
+		void OnInvokeFinished()
+		{
+			while (mRetired)
+			{
+				RetiredSlots* retired = mRetired;
+				mRetired = retired->prev;
+
+				for (int i = 0; i < retired->count; i++)
+					reinterpret_cast<IFunction<_res_type(_args ...)>*>(retired->slots[i].data)->~IFunction<_res_type(_args ...)>();
+
+				if (retired->slots != mInlineSlots)
+					FunctionSlotsAllocator::Free(retired->slots, retired->capacity);
+
+				delete retired;
+			}
+
+			if (mRemovedSlots)
+			{
+				std::vector<bool>* removedSlots = mRemovedSlots;
+				mRemovedSlots = nullptr;
+
+				for (int i = (int)removedSlots->size() - 1; i >= 0; i--)
+				{
+					if (i < mCount && (*removedSlots)[i])
+						RemoveSlot(i);
+				}
+
+				delete removedSlots;
+			}
+
+			if (mCount == 0 && mSlots != mInlineSlots)
+				DestroyFunctions();
+		}
+
+		// Moves functors from other delegate. Slots block is taken when it's possible. Functors of invoking
+		// delegate are cloned, they can be invoking now
+		void MoveFrom(Function& other)
+		{
+			if (other.mSlots != other.mInlineSlots && mInvokeDepth == 0 && other.mInvokeDepth == 0 &&
+				mSlots == mInlineSlots)
+			{
+				mSlots = other.mSlots;
+				mCount = other.mCount;
+				mCapacity = other.mCapacity;
+
+				other.mSlots = other.mInlineSlots;
+				other.mCount = 0;
+				other.mCapacity = inlineSlotsCount;
+				return;
+			}
+
+			for (int i = 0; i < other.mCount; i++)
+			{
+				if (other.IsRemovedSlot(i))
+					continue;
+
+				if (other.mInvokeDepth > 0)
+					other.SlotFunction(i)->Clone(NewSlot());
+				else
+					other.SlotFunction(i)->Move(NewSlot());
+
+				mCount++;
+			}
+
+			other.Clear();
 		}
 
 	public:
@@ -423,48 +682,28 @@ namespace o2
 	public:
 		// Constructor
 		Function()
-			: mData()
 		{}
 
 		// Copy-constructor
 		Function(const Function& other)
 		{
-			if (other.mData.typeData.type == DataType::Empty)
-				return;
-
-			if (other.mData.typeData.type == DataType::OneFunction)
-			{
-				Add(other.OneFunctionRef());
-				return;
-			}
-
-			for (auto func : other.mData.functions)
-				Add(*func);
+			Add(other);
 		}
 
 		// Move-constructor
 		Function(Function&& other)
 		{
-			memcpy(&mData, &other.mData, sizeof(Data));
-			other.mData.typeData.type = DataType::Empty;
+			MoveFrom(other);
 		}
 
 		// Constructor from IFunction
 		Function(const IFunction<_res_type(_args ...)>& func)
-			: mData()
 		{
 			Add(func);
 		}
 
-		// Constructor from IFunction
-		Function(IFunction<_res_type(_args ...)>&& func)
-			: mData()
-		{
-			Emplace(func);
-		}
-
 		// Constructor from static function pointer
-		template<typename _static_func_type, typename enable = std::enable_if<std::is_function<_static_func_type>::value>::type>
+		template<typename _static_func_type, typename enable = typename std::enable_if<std::is_function<_static_func_type>::value>::type>
 		Function(const _static_func_type* func):
 			Function()
 		{
@@ -472,7 +711,7 @@ namespace o2
 		}
 
 		// Constructor from lambda
-		template<typename _lambda_type, typename enable = std::enable_if<std::is_invocable_r<_res_type, _lambda_type, _args ...>::value && !std::is_base_of<IFunction<_res_type(_args ...)>, _lambda_type>::value>::type>
+		template<typename _lambda_type, typename enable = typename std::enable_if<std::is_invocable_r<_res_type, _lambda_type, _args ...>::value && !std::is_base_of<IFunction<_res_type(_args ...)>, _lambda_type>::value>::type>
 		Function(const _lambda_type& lambda):
 			Function()
 		{
@@ -480,9 +719,9 @@ namespace o2
 		}
 
 		// Move-constructor from lambda
-		template<typename _lambda_type, typename enable = std::enable_if<
+		template<typename _lambda_type, typename enable = typename std::enable_if<
 			std::is_invocable_r<_res_type, _lambda_type, _args ...>::value &&
-			!std::is_base_of<IFunction<_res_type(_args ...)>, std::remove_reference<_lambda_type>::type>::value &&
+			!std::is_base_of<IFunction<_res_type(_args ...)>, typename std::remove_reference<_lambda_type>::type>::value &&
 			std::is_rvalue_reference<_lambda_type&&>::value
 		>::type>
 		Function(_lambda_type&& lambda):
@@ -518,7 +757,8 @@ namespace o2
 		// Destructor
 		~Function()
 		{
-			Clear();
+			DestroyFunctions();
+			delete mRemovedSlots;
 		}
 
 		// Returns cloned copy of this
@@ -533,109 +773,110 @@ namespace o2
 			return new (memory) Function(*this);
 		}
 
+		// Moves this into memory and returns moved copy. This stays valid, but can be empty
+		IFunction<_res_type(_args ...)>* Move(void* memory)
+		{
+			return new (memory) Function(std::move(*this));
+		}
+
 		// Removing all inside functions
 		void Clear()
 		{
-			if (mData.typeData.type == DataType::CoupleOfFunctions)
+			if (mInvokeDepth > 0)
 			{
-				for (auto func : mData.functions)
-					delete func;
-
-				mData.functions.clear();
-			}
-			else if (mData.typeData.type == DataType::OneFunction)
-			{
-				DestroyOneFunction();
-				mData.typeData.type = DataType::Empty;
+				for (int i = 0; i < mCount; i++)
+					RemoveSlot(i);
 			}
+			else
+				DestroyFunctions();
 		}
 
 		// Returns true when function is empty
 		bool IsEmpty() const
 		{
-			return mData.typeData.type == DataType::Empty ||
-				(mData.typeData.type == DataType::CoupleOfFunctions && mData.functions.empty());
+			return GetCount() == 0;
 		}
 
-		// Emplace function
-		template<typename _function_type, typename enabled = std::enable_if<std::is_base_of<IFunction<_res_type(_args ...)>, _function_type>::value>::type>
-		void Emplace(_function_type&& func)
+		// Returns count of functors, except removed while invoking
+		int GetCount() const
 		{
-			auto size = sizeof(_function_type);
-			if (mData.typeData.type == DataType::Empty && size <= OneFunctionData::capacity)
+			if (!mRemovedSlots)
+				return mCount;
+
+			int count = mCount;
+			for (int i = 0; i < mCount; i++)
 			{
-				new (mData.oneFunctionData.functionData) _function_type(std::forward<_function_type>(func));
-				mData.oneFunctionData.destructor = [](IFunction<_res_type(_args ...)>* f) { f->~IFunction<_res_type(_args ...)>(); };
-				mData.typeData.type = DataType::OneFunction;
+				if (IsRemovedSlot(i))
+					count--;
 			}
+
+			return count;
+		}
+
+		// Reserves slots for count of functors
+		void Reserve(int count)
+		{
+			if (count > mCapacity)
+				Reallocate(count);
+		}
+
+		// Emplace function
+		template<typename _function_type, typename enabled = typename std::enable_if<std::is_base_of<IFunction<_res_type(_args ...)>, _function_type>::value>::type>
+		void Emplace(_function_type&& func)
+		{
+			typedef typename std::decay<_function_type>::type FunctionType;
+
+			if constexpr (FitsSlot<FunctionType>())
+				new (NewSlot()) FunctionType(std::forward<_function_type>(func));
 			else
-			{
-				ConvertToCoupleFunctionsType();
-				mData.functions.push_back(mnew _function_type(func));
-			}
+				new (NewSlot()) HeapFunction(mnew FunctionType(std::forward<_function_type>(func)));
+
+			mCount++;
 		}
 
 		// Add function
 		void Add(const IFunction<_res_type(_args ...)>& func)
 		{
-			auto size = func.GetSizeOf();
-			if (mData.typeData.type == DataType::Empty && size <= OneFunctionData::capacity)
-			{
-				func.Clone(mData.oneFunctionData.functionData);
-				mData.oneFunctionData.destructor = [](IFunction<_res_type(_args ...)>* f) { f->~IFunction<_res_type(_args ...)>(); };
-				mData.typeData.type = DataType::OneFunction;
-			}
+			if (func.GetSizeOf() <= FunctionSlotsAllocator::slotSize)
+				func.Clone(NewSlot());
 			else
-			{
-				ConvertToCoupleFunctionsType();
-				mData.functions.push_back(func.Clone());
-			}
+				new (NewSlot()) HeapFunction(func.Clone());
+
+			mCount++;
 		}
 
-		// Add function pointer
+		// Add function pointer. Takes ownership of function
 		void Add(IFunction<_res_type(_args ...)>* func)
 		{
-			if (mData.typeData.type != DataType::CoupleOfFunctions)
-				ConvertToCoupleFunctionsType();
-
-			mData.functions.push_back(func);
+			new (NewSlot()) HeapFunction(func);
+			mCount++;
 		}
 
 		// Removes function
 		void Remove(const IFunction<_res_type(_args ...)>& function)
 		{
-			if (mData.typeData.type == DataType::OneFunction)
+			const IFunction<_res_type(_args ...)>* unwrapped = Unwrap(&function);
+			for (int i = 0; i < mCount; i++)
 			{
-				if (OneFunctionRef().Equals(&function))
+				if (!IsRemovedSlot(i) && SlotFunction(i)->Equals(unwrapped))
 				{
-					DestroyOneFunction();
-					mData.typeData.type = DataType::Empty;
-				}
-			}
-			else if (mData.typeData.type == DataType::CoupleOfFunctions)
-			{
-				for (auto funcIt = mData.functions.begin(); funcIt != mData.functions.end(); ++funcIt)
-				{
-					if ((*funcIt)->Equals(&function))
-					{
-						delete *funcIt;
-						mData.functions.erase(funcIt);
-						break;
-					}
+					RemoveSlot(i);
+					break;
 				}
 			}
 		}
 
-		// Removes function pointer
+		// Removes function pointer, added by Add(IFunction*). Function is deleted
 		void Remove(const IFunction<_res_type(_args ...)>* function)
 		{
-			if (mData.typeData.type == DataType::CoupleOfFunctions)
+			for (int i = 0; i < mCount; i++)
 			{
-				auto fnd = std::find(mData.functions.begin(), mData.functions.end(), function);
-				if (fnd != mData.functions.end())
-					mData.functions.erase(fnd);
-
-				delete function;
+				auto heapFunction = dynamic_cast<HeapFunction*>(SlotFunction(i));
+				if (heapFunction && heapFunction->function == function && !IsRemovedSlot(i))
+				{
+					RemoveSlot(i);
+					break;
+				}
 			}
 		}
 
@@ -656,24 +897,32 @@ namespace o2
 		// Add delegate to inside list
 		void Add(const Function& func)
 		{
-			if (func.mData.typeData.type == DataType::OneFunction)
-				Add(func.OneFunctionRef());
-			else if (func.mData.typeData.type == DataType::CoupleOfFunctions)
+			int count = func.mCount;
+			Reserve(mCount + count);
+
+			for (int i = 0; i < count; i++)
 			{
-				for (auto x : func.mData.functions)
-					Add(*x);
+				if (func.IsRemovedSlot(i))
+					continue;
+
+				func.SlotFunction(i)->Clone(NewSlot());
+				mCount++;
 			}
 		}
 
 		// Remove delegate from list
 		void Remove(const Function& func)
 		{
-			if (func.mData.typeData.type == DataType::OneFunction)
-				Remove(func.OneFunctionRef());
-			else if (func.mData.typeData.type == DataType::CoupleOfFunctions)
+			if (&func == this)
 			{
-				for (auto x : func.mData.functions)
-					Remove(*x);
+				Clear();
+				return;
+			}
+
+			for (int i = 0; i < func.mCount; i++)
+			{
+				if (!func.IsRemovedSlot(i))
+					Remove(*func.SlotFunction(i));
 			}
 		}
 
@@ -694,15 +943,11 @@ namespace o2
 		// Returns true, if this contains the delegate
 		bool Contains(const IFunction<_res_type(_args ...)>& func) const
 		{
-			if (mData.typeData.type == DataType::OneFunction)
-				return OneFunctionRef().Equals(&func);
-			else if (mData.typeData.type == DataType::CoupleOfFunctions)
+			const IFunction<_res_type(_args ...)>* unwrapped = Unwrap(&func);
+			for (int i = 0; i < mCount; i++)
 			{
-				for (auto x : mData.functions)
-				{
-					if (x->Equals(&func))
-						return true;
-				}
+				if (!IsRemovedSlot(i) && SlotFunction(i)->Equals(unwrapped))
+					return true;
 			}
 
 			return false;
@@ -717,20 +962,33 @@ namespace o2
 		// Invokes function with arguments
 		_res_type Invoke(_args ... args) const
 		{
-			if (mData.typeData.type == DataType::OneFunction)
-				return OneFunctionRef().Invoke(args ...);
-			else if (mData.typeData.type == DataType::CoupleOfFunctions)
-			{
-				if (mData.functions.size() == 0)
-					return _res_type();
+			int count = mCount;
+			if (count == 0)
+				return _res_type();
 
-				for (int i = 0; i < mData.functions.size() - 1; i++)
-					mData.functions[i]->Invoke(args ...);
+			mInvokeDepth++;
 
-				return mData.functions.back()->Invoke(args ...);
+			// Slots can be reallocated while invoking, so they are read on every step. Functors added while invoking aren't invoked,
+			// removed ones are skipped
+			for (int i = 0; i < count - 1; i++)
+			{
+				if (!IsRemovedSlot(i))
+					SlotFunction(i)->Invoke(args ...);
 			}
 
-			return _res_type();
+			if constexpr (std::is_void<_res_type>::value)
+			{
+				if (!IsRemovedSlot(count - 1))
+					SlotFunction(count - 1)->Invoke(args ...);
+
+				FinishInvoke();
+			}
+			else
+			{
+				_res_type res = IsRemovedSlot(count - 1) ? _res_type() : SlotFunction(count - 1)->Invoke(args ...);
+				FinishInvoke();
+				return res;
+			}
 		}
 
 		// Copy operator
@@ -741,17 +999,12 @@ namespace o2
 			return *this;
 		}
 
-		// Copy operator
-		Function<_res_type(_args ...)>& operator=(IFunction<_res_type(_args ...)>&& func)
-		{
-			Clear();
-			Emplace(func);
-			return *this;
-		}
-
 		// Copy operator
 		Function<_res_type(_args ...)>& operator=(const Function& other)
 		{
+			if (&other == this)
+				return *this;
+
 			Clear();
 			Add(other);
 			return *this;
@@ -760,60 +1013,23 @@ namespace o2
 		// Move operator
 		Function<_res_type(_args ...)>& operator=(Function&& other)
 		{
-			Clear();
-			memcpy(&mData, &other.mData, sizeof(Data));
-			other.mData.typeData.type = DataType::Empty;
+			if (&other == this)
+				return *this;
 
+			Clear();
+			MoveFrom(other);
 			return *this;
 		}
 
 		// Equal operator
 		bool operator==(const Function& other) const
 		{
-			if (mData.typeData.type == DataType::Empty)
-				return other.mData.typeData.type == DataType::Empty;
-
-			if (mData.typeData.type == DataType::OneFunction)
-			{
-				if (other.mData.typeData.type == DataType::OneFunction)
-					return OneFunctionRef().Equals(&other.OneFunctionRef());
-				else if (other.mData.typeData.type == DataType::CoupleOfFunctions)
-				{
-					if (other.mData.functions.size() != 1)
-						return false;
-
-					return OneFunctionRef().Equals(other.mData.functions[0]);
-				}
-
+			if (GetCount() != other.GetCount())
 				return false;
-			}
 
-			// CoupleOfFunctions
-
-			if (other.mData.typeData.type == DataType::Empty)
-				return mData.functions.empty();
-
-			if (other.mData.typeData.type == DataType::OneFunction)
+			for (int i = 0; i < mCount; i++)
 			{
-				if (mData.functions.size() != 1)
-					return false;
-
-				return mData.functions[0]->Equals(&other.OneFunctionRef());
-			}
-
-			for (auto func : mData.functions)
-			{
-				bool found = false;
-				for (auto otherFunc : other.mData.functions)
-				{
-					if (func->Equals(otherFunc))
-					{
-						found = true;
-						break;
-					}
-				}
-
-				if (!found)
+				if (!IsRemovedSlot(i) && !other.Contains(*SlotFunction(i)))
 					return false;
 			}
 
@@ -829,16 +1045,7 @@ namespace o2
 		// Equal operator
 		bool operator==(const IFunction<_res_type(_args ...)>& func) const
 		{
-			if (mData.typeData.type == DataType::Empty)
-				return false;
-
-			if (mData.typeData.type == DataType::OneFunction)
-				return OneFunctionRef().Equals(&func);
-
-			if (mData.functions.size() != 1)
-				return false;
-
-			return mData.functions[0]->Equals(&func);
+			return GetCount() == 1 && Contains(func);
 		}
 
 		// Not equal operator
@@ -928,6 +1135,14 @@ namespace o2
 		{
 			return sizeof(*this);
 		}
+
+	private:
+		// Decreases invoking depth, finishes deferred removing and slots releasing after outer invoking
+		void FinishInvoke() const
+		{
+			if (--mInvokeDepth == 0 && (mRetired || mRemovedSlots))
+				const_cast<Function*>(this)->OnInvokeFinished();
+		}
 	};
 
 	template<typename _res_type, typename ... _args>
@@ -1011,6 +1226,12 @@ namespace o2
 			return new (memory) Subscription(*this);
 		}
 
+		// Moves this into memory and returns moved copy. This stays valid, but can be empty
+		IFunction<_res_type(_args ...)>* Move(void* memory)
+		{
+			return new (memory) Subscription(*this);
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -0,0 +1,92 @@
+#include "o2/stdafx.h"
+#include "BlocksPoolAllocator.h"
+
+namespace o2
+{
+	// Blocks and chunk header are aligned as malloc() result, so blocks can store any types
+	static constexpr size_t blocksAlignment = alignof(std::max_align_t);
+	static constexpr size_t chunkHeaderSize = (sizeof(void*) + blocksAlignment - 1)/blocksAlignment*blocksAlignment;
+
+	BlocksPoolAllocator::BlocksPoolAllocator(size_t blockSize, size_t chunkBlocksCount /*= 64*/,
+											 IAllocator* baseAllocator /*= DefaultAllocator::GetInstance()*/)
+	{
+		mBaseAllocator = baseAllocator;
+		mBlockSize = (Math::Max(blockSize, sizeof(FreeBlock)) + blocksAlignment - 1)/blocksAlignment*blocksAlignment;
+		mChunkBlocksCount = Math::Max(chunkBlocksCount, (size_t)1);
+	}
+
+	BlocksPoolAllocator::~BlocksPoolAllocator()
+	{
+		Clear();
+	}
+
+	void BlocksPoolAllocator::AddChunk()
+	{
+		void* mem = mBaseAllocator->Allocate(chunkHeaderSize + mBlockSize*mChunkBlocksCount);
+		Chunk* chunk = new (mem) Chunk();
+		chunk->prev = mHead;
+		mHead = chunk;
+
+		std::byte* blocks = reinterpret_cast<std::byte*>(mem) + chunkHeaderSize;
+		for (size_t i = 0; i < mChunkBlocksCount; i++)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + i*mBlockSize);
+			block->next = mFreeBlocks;
+			mFreeBlocks = block;
+		}
+	}
+
+	void* BlocksPoolAllocator::Allocate(size_t size)
+	{
+		if (size > mBlockSize)
+			return nullptr;
+
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		if (!mFreeBlocks)
+			AddChunk();
+
+		FreeBlock* block = mFreeBlocks;
+		mFreeBlocks = block->next;
+		return block;
+	}
+
+	void BlocksPoolAllocator::Deallocate(void* ptr)
+	{
+		if (!ptr)
+			return;
+
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(ptr);
+		block->next = mFreeBlocks;
+		mFreeBlocks = block;
+	}
+
+	void* BlocksPoolAllocator::Reallocate(void* ptr, size_t oldSize, size_t newSize)
+	{
+		if (newSize <= mBlockSize)
+			return ptr;
+
+		return nullptr;
+	}
+
+	size_t BlocksPoolAllocator::GetBlockSize() const
+	{
+		return mBlockSize;
+	}
+
+	void BlocksPoolAllocator::Clear()
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		while (mHead)
+		{
+			Chunk* chunk = mHead;
+			mHead = chunk->prev;
+			mBaseAllocator->Deallocate(chunk);
+		}
+
+		mFreeBlocks = nullptr;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "o2/Utils/Memory/Allocators/IAllocator.h"
+#include "o2/Utils/Memory/Allocators/DefaultAllocator.h"
+#include <mutex>
+
+namespace o2
+{
+	class BlocksPoolAllocator: public IAllocator
+	{
+	public:
+		BlocksPoolAllocator(size_t blockSize, size_t chunkBlocksCount = 64, IAllocator* baseAllocator = DefaultAllocator::GetInstance());
+		BlocksPoolAllocator(const BlocksPoolAllocator& other) = delete;
+		~BlocksPoolAllocator() override;
+
+		BlocksPoolAllocator& operator=(const BlocksPoolAllocator& other) = delete;
+
+		void* Allocate(size_t size) override;
+		void Deallocate(void* ptr) override;
+		void* Reallocate(void* ptr, size_t oldSize, size_t newSize) override;
+
+		size_t GetBlockSize() const;
+
+		void Clear();
+
+	private:
+		struct Chunk
+		{
+			Chunk* prev;
+		};
+
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+	private:
+		IAllocator* mBaseAllocator;
+
+		size_t mBlockSize;
+		size_t mChunkBlocksCount;
+
+		Chunk*     mHead = nullptr;
+		FreeBlock* mFreeBlocks = nullptr;
+
+		std::mutex mMutex;
+
+	private:
+		void AddChunk();
+	};
+};
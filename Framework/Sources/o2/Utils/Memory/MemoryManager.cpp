@@ -75,13 +75,19 @@ void _mfree(void* allocMemory)
 
 namespace o2
 {
+	// Slot marker of removed allocation
+	static void* const removedAllocMemory = (void*)1;
+
 	MemoryManager::MemoryManager():
-		mTotalBytes(0)
+		mTotalBytes(0), mTrackingEnabled(true)
 	{}
 
 	MemoryManager::~MemoryManager()
 	{
 		DumpInfo();
+
+		for (auto& shard : mShards)
+			shard.Clear();
 	}
 
 	MemoryManager& MemoryManager::Instance()
@@ -97,25 +103,82 @@ namespace o2
 		mInstance = new MemoryManager();
 	}
 
+	void MemoryManager::SetTrackingEnabled(bool enabled)
+	{
+		if (mTrackingEnabled == enabled)
+			return;
+
+		mTrackingEnabled = enabled;
+
+		if (!enabled)
+		{
+			for (auto& shard : mShards)
+			{
+				shard.Lock();
+				shard.Clear();
+				shard.Unlock();
+			}
+
+			mTotalBytes = 0;
+		}
+	}
+
+	bool MemoryManager::IsTrackingEnabled() const
+	{
+		return mTrackingEnabled;
+	}
+
+	size_t MemoryManager::GetTotalBytes() const
+	{
+		return mTotalBytes;
+	}
+
 	void MemoryManager::OnMemoryAllocate(void* memory, size_t size, const char* source, int line)
 	{
+		if (!mTrackingEnabled || !memory)
+			return;
+
 		AllocInfo info;
 		info.memory = memory;
 		info.size = size;
 		info.sourceLine = line;
 		info.source = source;
-		mAllocs[memory] = info;
+
+		size_t hash = GetMemoryHash(memory);
+		AllocsShard& shard = mShards[hash % mShardsCount];
+
+		shard.Lock();
+		shard.Add(info, hash / mShardsCount);
+		shard.Unlock();
+
 		mTotalBytes += size;
 	}
 
 	void MemoryManager::OnMemoryRelease(void* memory)
 	{
-		std::map<void*, AllocInfo>::iterator fnd = mAllocs.find(memory);
-		if (fnd != mAllocs.end())
-		{
-			mTotalBytes -= (*fnd).second.size;
-			mAllocs.erase(fnd);
-		}
+		if (!mTrackingEnabled || !memory)
+			return;
+
+		size_t hash = GetMemoryHash(memory);
+		AllocsShard& shard = mShards[hash % mShardsCount];
+
+		size_t size = 0;
+
+		shard.Lock();
+		bool removed = shard.Remove(memory, hash / mShardsCount, size);
+		shard.Unlock();
+
+		if (removed)
+			mTotalBytes -= size;
+	}
+
+	size_t MemoryManager::GetMemoryHash(void* memory)
+	{
+		UInt64 hash = (UInt64)(size_t)memory;
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdULL;
+		hash ^= hash >> 33;
+		return (size_t)hash;
 	}
 
 	void MemoryManager::DumpInfo()
@@ -126,9 +189,9 @@ namespace o2
 
 		struct allocSrc
 		{
-			char source[128];
+			const char* source = nullptr;
 			int line = 0;
-			int size = 0;
+			size_t size = 0;
 			int count = 0;
 
 			bool operator<(const allocSrc& other) const
@@ -136,42 +199,65 @@ namespace o2
 				return size < other.size;
 			}
 		};
-		std::vector<allocSrc> allocs;
 
-		int i = 0;
-		for (auto it = mAllocs.begin(); it != mAllocs.end(); ++it, i++)
+		struct allocSrcKeyLess
 		{
-			auto& info = (*it).second;
+			bool operator()(const std::pair<const char*, int>& a, const std::pair<const char*, int>& b) const
+			{
+				if (a.second != b.second)
+					return a.second < b.second;
 
-			bool found = false;
-			for (auto& allc : allocs)
+				return strcmp(a.first, b.first) < 0;
+			}
+		};
+
+		std::map<std::pair<const char*, int>, allocSrc, allocSrcKeyLess> allocsBySource;
+
+		// Shard content is copied under lock into malloc'ed buffer: aggregating allocates memory, 
+		// and releasing memory inside the lock would deadlock on the same shard
+		for (auto& shard : mShards)
+		{
+			shard.Lock();
+
+			size_t count = shard.count;
+			AllocInfo* infos = count > 0 ? (AllocInfo*)malloc(count*sizeof(AllocInfo)) : nullptr;
+			size_t copied = 0;
+
+			if (infos)
 			{
-				if (allc.line == info.sourceLine && strcmp(allc.source, info.source) == 0)
+				for (size_t i = 0; i < shard.capacity && copied < count; i++)
 				{
-					allc.size += info.size;
-					allc.count++;
-					found = true;
-					break;
+					auto& slot = shard.table[i];
+					if (slot.memory && slot.memory != removedAllocMemory)
+						infos[copied++] = slot;
 				}
 			}
 
-			if (!found)
+			shard.Unlock();
+
+			for (size_t i = 0; i < copied; i++)
 			{
-				allocSrc allc;
+				auto& info = infos[i];
+				auto& allc = allocsBySource[std::make_pair(info.source, info.sourceLine)];
+				allc.source = info.source;
 				allc.line = info.sourceLine;
-				strncpy(allc.source, info.source, 127);
-				allc.size = info.size;
-				allc.count = 1;
-
-				allocs.push_back(allc);
+				allc.size += info.size;
+				allc.count++;
 			}
+
+			free(infos);
 		}
 
+		std::vector<allocSrc> allocs;
+		allocs.reserve(allocsBySource.size());
+		for (auto& kv : allocsBySource)
+			allocs.push_back(kv.second);
+
 		std::sort(allocs.begin(), allocs.end());
 
 		for (int i = 0; i < (int)allocs.size(); i++)
 		{
-			printf("%i: %s : %i - %i bytes (%f MB) in %i allocs\n",
+			printf("%i: %s : %i - %zu bytes (%f MB) in %i allocs\n",
 				   i, allocs[i].source, allocs[i].line, allocs[i].size,
 				   (float)allocs[i].size / 1024.0f / 1024.0f, allocs[i].count);
 		}
@@ -179,4 +265,117 @@ namespace o2
 		printf("========END==========\n");
 	}
 
+	void MemoryManager::AllocsShard::Lock()
+	{
+		while (lock.test_and_set(std::memory_order_acquire))
+		{}
+	}
+
+	void MemoryManager::AllocsShard::Unlock()
+	{
+		lock.clear(std::memory_order_release);
+	}
+
+	void MemoryManager::AllocsShard::Add(const AllocInfo& info, size_t hash)
+	{
+		if ((usedSlots + 1)*4 > capacity*3)
+		{
+			// Grow only when live allocations fill the table, otherwise just drop removed slots
+			size_t newCapacity = capacity == 0 ? 256 : capacity;
+			if ((count + 1)*2 > newCapacity)
+				newCapacity *= 2;
+
+			Rehash(newCapacity);
+		}
+
+		size_t mask = capacity - 1;
+		size_t idx = hash & mask;
+		AllocInfo* firstRemoved = nullptr;
+
+		while (table[idx].memory)
+		{
+			if (table[idx].memory == info.memory)
+			{
+				table[idx] = info;
+				return;
+			}
+
+			if (table[idx].memory == removedAllocMemory && !firstRemoved)
+				firstRemoved = &table[idx];
+
+			idx = (idx + 1) & mask;
+		}
+
+		if (firstRemoved)
+			*firstRemoved = info;
+		else
+		{
+			table[idx] = info;
+			usedSlots++;
+		}
+
+		count++;
+	}
+
+	bool MemoryManager::AllocsShard::Remove(void* memory, size_t hash, size_t& size)
+	{
+		if (count == 0)
+			return false;
+
+		size_t mask = capacity - 1;
+		size_t idx = hash & mask;
+
+		while (table[idx].memory)
+		{
+			if (table[idx].memory == memory)
+			{
+				size = table[idx].size;
+				table[idx].memory = removedAllocMemory;
+				count--;
+				return true;
+			}
+
+			idx = (idx + 1) & mask;
+		}
+
+		return false;
+	}
+
+	void MemoryManager::AllocsShard::Clear()
+	{
+		free(table);
+		table = nullptr;
+		capacity = 0;
+		count = 0;
+		usedSlots = 0;
+	}
+
+	void MemoryManager::AllocsShard::Rehash(size_t newCapacity)
+	{
+		AllocInfo* oldTable = table;
+		size_t oldCapacity = capacity;
+
+		table = (AllocInfo*)calloc(newCapacity, sizeof(AllocInfo));
+		capacity = newCapacity;
+		count = 0;
+		usedSlots = 0;
+
+		size_t mask = capacity - 1;
+		for (size_t i = 0; i < oldCapacity; i++)
+		{
+			auto& slot = oldTable[i];
+			if (!slot.memory || slot.memory == removedAllocMemory)
+				continue;
+
+			size_t idx = (GetMemoryHash(slot.memory) / mShardsCount) & mask;
+			while (table[idx].memory)
+				idx = (idx + 1) & mask;
+
+			table[idx] = slot;
+			count++;
+			usedSlots++;
+		}
+
+		free(oldTable);
+	}
 }
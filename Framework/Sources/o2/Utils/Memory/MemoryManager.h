@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <map>
 
@@ -48,6 +49,9 @@ namespace o2
 
 	// ------------------------------------------------------------------
 	// Memory manager, using for collecting garbage, tracing memory leaks
+	// Allocations are tracked only when ENALBE_MEMORY_MANAGE is true.
+	// Tracking is thread safe: allocations are stored in hash tables,
+	// sharded by address, each shard has own lock
 	// ------------------------------------------------------------------
 	class MemoryManager
 	{
@@ -64,7 +68,16 @@ namespace o2
 		// Initializes memory manager
 		static void Initialize();
 
-		// Collects information about allocated memory and prints into console
+		// Enables or disables allocations tracking at runtime. Disabling forgets all tracked allocations
+		void SetTrackingEnabled(bool enabled);
+
+		// Returns is allocations tracking enabled
+		bool IsTrackingEnabled() const;
+
+		// Returns total tracked allocated bytes
+		size_t GetTotalBytes() const;
+
+		// Collects information about allocated memory, aggregates it by source location and prints into console
 		void DumpInfo();
 
 	protected:
@@ -79,10 +92,45 @@ namespace o2
 			void*       memory;     // Pointer to allocated memory
 		};
 
+		// -------------------------------------------------------------------------------------------
+		// Allocations hash table with open addressing. Uses malloc/free for own storage, so it doesn't
+		// call memory manager recursively
+		// -------------------------------------------------------------------------------------------
+		struct AllocsShard
+		{
+			std::atomic_flag lock = ATOMIC_FLAG_INIT; // Shard spin lock
+
+			AllocInfo* table = nullptr; // Allocations slots. Empty slot has null memory
+			size_t     capacity = 0;    // Slots count, power of two
+			size_t     count = 0;       // Live allocations count
+			size_t     usedSlots = 0;   // Live and removed allocations slots count
+
+			// Locks shard
+			void Lock();
+
+			// Unlocks shard
+			void Unlock();
+
+			// Adds or replaces allocation
+			void Add(const AllocInfo& info, size_t hash);
+
+			// Removes allocation, returns false when it isn't tracked. Writes allocation size
+			bool Remove(void* memory, size_t hash, size_t& size);
+
+			// Removes all allocations and frees storage
+			void Clear();
+
+			// Rebuilds table with new capacity, dropping removed slots
+			void Rehash(size_t newCapacity);
+		};
+
+		static const int mShardsCount = 64; // Count of allocations shards
+
 		static MemoryManager* mInstance; // Instance pointer
 
-		std::map<void*, AllocInfo> mAllocs;     // Allocations info
-		size_t                     mTotalBytes; // Total managed allocated bytes
+		AllocsShard         mShards[mShardsCount];   // Allocations info, sharded by address
+		std::atomic<size_t> mTotalBytes;             // Total managed allocated bytes
+		std::atomic<bool>   mTrackingEnabled;        // Is allocations tracking enabled
 
 	protected:
 		// It is called when memory was allocated and registers allocation
@@ -91,6 +139,9 @@ namespace o2
 		// It is called when memory releasing, unregisters allocation
 		void OnMemoryRelease(void* memory);
 
+		// Returns hash of memory address
+		static size_t GetMemoryHash(void* memory);
+
 		friend void* ::operator new(size_t size, const char* location, int line);
 		friend void* ::operator new[](size_t size, const char* location, int line);
 		friend void  ::operator delete(void* allocMemory) noexcept;
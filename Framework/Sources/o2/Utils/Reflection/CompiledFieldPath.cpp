@@ -0,0 +1,188 @@
+#include "o2/stdafx.h"
+#include "CompiledFieldPath.h"
+
+#include "o2/Utils/Basic/IObject.h"
+#include "o2/Utils/Reflection/FieldInfo.h"
+#include "o2/Utils/Reflection/Type.h"
+
+namespace o2
+{
+	bool CompiledFieldPath::Compile(const Type* type, void* object, const String& path)
+	{
+		mPath = path;
+		mSteps.Clear();
+		mFieldInfo = nullptr;
+
+		mCompiled = object && CompileType(type, object, path);
+		mNotCompilable = !mCompiled;
+
+		if (!mCompiled)
+		{
+			mSteps.Clear();
+			mFieldInfo = nullptr;
+		}
+
+		return mCompiled;
+	}
+
+	bool CompiledFieldPath::IsCompiled() const
+	{
+		return mCompiled;
+	}
+
+	bool CompiledFieldPath::IsNotCompilable() const
+	{
+		return mNotCompilable;
+	}
+
+	const String& CompiledFieldPath::GetPath() const
+	{
+		return mPath;
+	}
+
+	void* CompiledFieldPath::GetFieldPtr(void* object, const FieldInfo*& fieldInfo) const
+	{
+		if (!mCompiled)
+			return nullptr;
+
+		for (auto& step : mSteps)
+		{
+			if (!object)
+				return nullptr;
+
+			switch (step.type)
+			{
+				case StepType::CastUp:
+				object = (*step.castFunc)(object);
+				break;
+
+				case StepType::Field:
+				object = step.field->GetValuePtr(object);
+				break;
+
+				case StepType::FieldStrong:
+				object = step.field->GetValuePtrStrong(object);
+				break;
+
+				case StepType::Dereference:
+				object = *(void**)object;
+				break;
+
+				case StepType::CheckType:
+				{
+					IObject* iobject = step.objectType->DynamicCastToIObject(object);
+					if (&iobject->GetType() != step.realType)
+						return nullptr;
+
+					if (step.realType != step.objectType)
+						object = step.realType->DynamicCastFromIObject(iobject);
+				}
+				break;
+			}
+		}
+
+		if (object)
+			fieldInfo = mFieldInfo;
+
+		return object;
+	}
+
+	bool CompiledFieldPath::CompileType(const Type* type, void* object, const String& path)
+	{
+		if (!object)
+			return false;
+
+		switch (type->GetUsage())
+		{
+			case Type::Usage::Object:
+			{
+				auto objectType = dynamic_cast<const ObjectType*>(type);
+				IObject* iobject = objectType->DynamicCastToIObject(object);
+				auto realType = dynamic_cast<const ObjectType*>(&iobject->GetType());
+
+				Step step;
+				step.type = StepType::CheckType;
+				step.objectType = objectType;
+				step.realType = realType;
+				mSteps.Add(step);
+
+				if (realType == objectType)
+					return CompileTypeFields(type, object, path);
+
+				return CompileTypeFields(realType, realType->DynamicCastFromIObject(iobject), path);
+			}
+
+			case Type::Usage::Pointer:
+			{
+				Step step;
+				step.type = StepType::Dereference;
+				mSteps.Add(step);
+
+				return CompileType(dynamic_cast<const PointerType*>(type)->GetUnpointedType(), *(void**)object, path);
+			}
+
+			// Containers elements are resolved by indices and can be changed, they are searched by names every time
+			case Type::Usage::Vector:
+			case Type::Usage::Map:
+			return false;
+
+			default:
+			return CompileTypeFields(type, object, path);
+		}
+	}
+
+	bool CompiledFieldPath::CompileTypeFields(const Type* type, void* object, const String& path)
+	{
+		int delPos = path.Find("/");
+		String pathPart = path.SubStr(0, delPos);
+
+		for (auto& field : type->GetFields())
+		{
+			if (field.GetName() != pathPart)
+				continue;
+
+			Step step;
+			step.field = &field;
+
+			if (delPos == -1)
+			{
+				step.type = StepType::FieldStrong;
+				mSteps.Add(step);
+
+				mFieldInfo = &field;
+				return true;
+			}
+
+			void* value = field.GetValuePtr(object);
+			const Type* fieldType = field.GetType();
+
+			if (!value || !fieldType)
+				return false;
+
+			step.type = StepType::Field;
+			mSteps.Add(step);
+
+			if (fieldType->GetUsage() == Type::Usage::Pointer)
+				fieldType = dynamic_cast<const PointerType*>(fieldType)->GetUnpointedType();
+
+			return CompileType(fieldType, value, path.SubStr(delPos + 1));
+		}
+
+		for (auto& baseType : type->GetBaseTypes())
+		{
+			int stepsCount = mSteps.Count();
+
+			Step step;
+			step.type = StepType::CastUp;
+			step.castFunc = baseType.dynamicCastUpFunc;
+			mSteps.Add(step);
+
+			if (CompileTypeFields(baseType.type, (*baseType.dynamicCastUpFunc)(object), path))
+				return true;
+
+			mSteps.RemoveRange(stepsCount, mSteps.Count());
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+	class FieldInfo;
+	class ObjectType;
+	class Type;
+
+	// -------------------------------------------------------------------------------------------------------
+	// Field path, compiled for type. Path is resolved by names once, same as Type::GetFieldPtr, and stored as
+	// chain of fields, casts and pointers dereferences. Then field of any object of that type is resolved
+	// without names searching. Real types of objects in chain are checked, when some of them are different
+	// chain can't be used and path must be resolved by names
+	// -------------------------------------------------------------------------------------------------------
+	class CompiledFieldPath
+	{
+	public:
+		// Compiles path for object of type. Returns false when path can't be resolved or compiled
+		bool Compile(const Type* type, void* object, const String& path);
+
+		// Returns true when path is compiled
+		bool IsCompiled() const;
+
+		// Returns true when compiling was tried and path can't be compiled. Such path must be resolved by names
+		bool IsNotCompilable() const;
+
+		// Returns compiled path
+		const String& GetPath() const;
+
+		// Returns field pointer by compiled chain. Returns null when object's chain differs from compiled
+		void* GetFieldPtr(void* object, const FieldInfo*& fieldInfo) const;
+
+	protected:
+		// -----------------------
+		// Compiled path step type
+		// -----------------------
+		enum class StepType { CastUp, Field, FieldStrong, Dereference, CheckType };
+
+		// ------------------
+		// Compiled path step
+		// ------------------
+		struct Step
+		{
+			typedef void*(*CastFunc)(void*);
+
+			StepType          type;                 // Type of step
+			CastFunc          castFunc = nullptr;   // Cast to base type function, used in CastUp step
+			const FieldInfo*  field = nullptr;      // Field info, used in Field and FieldStrong steps
+			const ObjectType* objectType = nullptr; // Static object type, used in CheckType step
+			const ObjectType* realType = nullptr;   // Expected real object type, used in CheckType step
+		};
+
+	protected:
+		String           mPath;                  // Compiled path
+		Vector<Step>     mSteps;                 // Steps chain
+		const FieldInfo* mFieldInfo = nullptr;   // Resolved field info
+		bool             mCompiled = false;      // Is path compiled
+		bool             mNotCompilable = false; // Is compiling tried and failed
+
+	protected:
+		// Compiles path by type usage, same as virtual Type::GetFieldPtr
+		bool CompileType(const Type* type, void* object, const String& path);
+
+		// Compiles path by type fields and base types, same as Type::GetFieldPtr
+		bool CompileTypeFields(const Type* type, void* object, const String& path);
+	};
+}
@@ -24,6 +24,7 @@ namespace o2
 	class ReflectionInitializationTypeProcessor;
 	class FieldInfo;
 	class FunctionInfo;
+	class StaticFunctionInfo;
 
 	class IObject;
 
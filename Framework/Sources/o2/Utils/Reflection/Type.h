@@ -814,6 +814,7 @@ typedef void*(*GetValuePointerFuncPtr)(void*);
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Reflection/FieldInfo.h"
 #include "o2/Utils/Reflection/FunctionInfo.h"
+#include "o2/Utils/Reflection/Reflection.h"
 #include "o2/Utils/Reflection/TypeTraits.h"
 #include "o2/Utils/Types/StringImpl.h"
 #include "o2/Utils/Types/UID.h"
@@ -821,6 +822,48 @@ typedef void*(*GetValuePointerFuncPtr)(void*);
 
 namespace o2
 {
+	// Returns type of template parameter
+	template<typename _type>
+	const Type& GetTypeOf()
+	{
+		if constexpr (std::is_pointer<_type>::value)
+		{
+			return *GetTypeOf<typename std::remove_pointer<_type>::type>().GetPointerType();
+		}
+		else if constexpr (IsVector<_type>::value)
+		{
+			return *Reflection::InitializeVectorType<typename ExtractVectorElementType<_type>::type>();
+		}
+		else if constexpr (IsStringAccessor<_type>::value)
+		{
+			return *Reflection::InitializeAccessorType<typename _type::valueType, _type>();
+		}
+		else if constexpr (IsMap<_type>::value)
+		{
+			return *Reflection::InitializeMapType<typename ExtractMapKeyType<_type>::type, typename ExtractMapValueType<_type>::type>();
+		}
+		else if constexpr (IsProperty<_type>::value)
+		{
+			return *Reflection::InitializePropertyType<typename _type::valueType, _type>();
+		}
+		else if constexpr (std::is_base_of<IObject, _type>::value)
+		{
+			return *_type::type;
+		}
+		else if constexpr (IsFundamental<_type>::value && !std::is_const<_type>::value)
+		{
+			return *FundamentalTypeContainer<_type>::type;
+		}
+		else if constexpr (std::is_enum<_type>::value && IsEnumReflectable<_type>::value)
+		{
+			return *EnumTypeContainer<_type>::type;
+		}
+		else
+		{
+			return *Type::Dummy::type;
+		}
+	}
+
 	// -------------------
 	// Type implementation
 	// -------------------
@@ -1114,11 +1157,11 @@ namespace o2
 		data["Size"].Get(newSize);
 		type.SetObjectVectorSize(object, newSize);
 
-		if (auto elementsData = data.GetMember("Elements"))
+		if (auto elementsData = data.FindMember("Elements"))
 		{
 			for (int i = size; i < newSize; i++)
 			{
-				if (auto elementData = elementsData->GetMember("Element" + (WString)i))
+				if (auto elementData = elementsData->FindMember("Element" + (String)i))
 				{
 					void* elementPtr = type.GetObjectVectorElementPtr(object, i);
 					type.mElementFieldInfo->Deserialize(elementPtr, *elementData);
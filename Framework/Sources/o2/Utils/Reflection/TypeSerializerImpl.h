@@ -0,0 +1,53 @@
+#pragma once
+
+#include "o2/Utils/Reflection/TypeSerializer.h"
+#include "o2/Utils/Reflection/TypeTraits.h"
+#include "o2/Utils/Serialization/DataValue.h"
+
+namespace o2
+{
+	template<typename _type>
+	bool TypeSerializer<_type>::IsDefault(void* object) const
+	{
+		if constexpr (std::is_default_constructible<_type>::value && SupportsEqualOperator<_type>::value)
+			return Math::Equals(*(_type*)object, _type());
+
+		return false;
+	}
+
+	template<typename _type>
+	void TypeSerializer<_type>::Serialize(void* object, DataValue& data) const
+	{
+		if constexpr (DataValue::IsSupports<_type>::value)
+			data.Set(*(_type*)object);
+	}
+
+	template<typename _type>
+	void TypeSerializer<_type>::Deserialize(void* object, const DataValue& data) const
+	{
+		if constexpr (DataValue::IsSupports<_type>::value)
+			data.Get(*(_type*)object);
+	}
+
+	template<typename _type>
+	bool TypeSerializer<_type>::Equals(void* objectA, void* objectB) const
+	{
+		if constexpr (SupportsEqualOperator<_type>::value)
+			return Math::Equals(*(_type*)objectA, *(_type*)objectB);
+
+		return false;
+	}
+
+	template<typename _type>
+	void TypeSerializer<_type>::Copy(void* objectA, void* objectB) const
+	{
+		if constexpr (std::is_assignable<_type&, _type>::value)
+			*(_type*)objectA = *(_type*)objectB;
+	}
+
+	template<typename _type>
+	ITypeSerializer* TypeSerializer<_type>::Clone() const
+	{
+		return mnew TypeSerializer();
+	}
+}
@@ -0,0 +1,343 @@
+#include "o2/stdafx.h"
+#include "BinaryDataFormat.h"
+
+namespace o2
+{
+	const char BinaryDataFormat::magic[4] = { 'o', '2', 'B', 'D' };
+	const UInt BinaryDataFormat::version = 1;
+	const UInt BinaryDataFormat::headerSize = sizeof(magic) + sizeof(version);
+
+	bool IsBinaryData(const char* data, UInt size)
+	{
+		return size >= BinaryDataFormat::headerSize && memcmp(data, BinaryDataFormat::magic, sizeof(BinaryDataFormat::magic)) == 0;
+	}
+
+	bool ParseBinaryInplace(char* data, UInt size, DataDocument& document)
+	{
+		BinaryDataFormat::Reader reader(data, size, false, document);
+		return reader.Read();
+	}
+
+	bool ParseBinary(const char* data, UInt size, DataDocument& document)
+	{
+		BinaryDataFormat::Reader reader(data, size, true, document);
+		return reader.Read();
+	}
+
+	void WriteBinary(String& str, const DataDocument& document)
+	{
+		BinaryDataFormat::Writer writer;
+		document.Write(writer);
+		writer.GetResult(str);
+	}
+
+	BinaryDataFormat::Writer::Writer()
+	{}
+
+	void BinaryDataFormat::Writer::GetResult(o2::String& result) const
+	{
+		std::string buffer;
+		buffer.reserve(headerSize + sizeof(UInt) + mKeys.Count()*16 + mValues.size());
+
+		buffer.append(magic, sizeof(magic));
+		buffer.append((const char*)&version, sizeof(version));
+
+		UInt keysCount = mKeys.Count();
+		buffer.append((const char*)&keysCount, sizeof(keysCount));
+
+		for (auto& key : mKeys)
+			WriteString(buffer, key.Data(), key.Length());
+
+		buffer.append(mValues);
+
+		result = o2::String(buffer);
+	}
+
+	bool BinaryDataFormat::Writer::Null()
+	{
+		WriteType(ValueType::Null);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::Bool(bool value)
+	{
+		WriteType(value ? ValueType::BoolTrue : ValueType::BoolFalse);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::Int(int value)
+	{
+		WriteType(ValueType::Int);
+		WriteData(value);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::Uint(unsigned value)
+	{
+		WriteType(ValueType::UInt);
+		WriteData(value);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::Int64(int64_t value)
+	{
+		WriteType(ValueType::Int64);
+		WriteData(value);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::Uint64(uint64_t value)
+	{
+		WriteType(ValueType::UInt64);
+		WriteData(value);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::Double(double value)
+	{
+		WriteType(ValueType::Double);
+		WriteData(value);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::String(const char* str, unsigned length, bool copy)
+	{
+		WriteType(ValueType::String);
+		WriteString(mValues, str, length);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::StartObject()
+	{
+		WriteType(ValueType::Object);
+		mCountsPositions.Add((UInt)mValues.size());
+		WriteData((UInt)0);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::Key(const char* str, unsigned length, bool copy)
+	{
+		o2::String key = std::string(str, length);
+
+		UInt keyIdx;
+		if (!mKeysIdx.TryGetValue(key, keyIdx))
+		{
+			keyIdx = mKeys.Count();
+			mKeys.Add(key);
+			mKeysIdx.Add(key, keyIdx);
+		}
+
+		WriteData(keyIdx);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::EndObject(unsigned memberCount)
+	{
+		WriteCount(memberCount);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::StartArray()
+	{
+		WriteType(ValueType::Array);
+		mCountsPositions.Add((UInt)mValues.size());
+		WriteData((UInt)0);
+		return true;
+	}
+
+	bool BinaryDataFormat::Writer::EndArray(unsigned elementCount)
+	{
+		WriteCount(elementCount);
+		return true;
+	}
+
+	void BinaryDataFormat::Writer::WriteType(ValueType type)
+	{
+		mValues.push_back((char)type);
+	}
+
+	template<typename _type>
+	void BinaryDataFormat::Writer::WriteData(const _type& value)
+	{
+		mValues.append((const char*)&value, sizeof(_type));
+	}
+
+	void BinaryDataFormat::Writer::WriteString(std::string& buffer, const char* str, unsigned length)
+	{
+		UInt len = length;
+		buffer.append((const char*)&len, sizeof(len));
+		buffer.append(str, length);
+		buffer.push_back('\0');
+	}
+
+	void BinaryDataFormat::Writer::WriteCount(unsigned count)
+	{
+		UInt position = mCountsPositions.PopBack();
+		UInt value = count;
+		memcpy(&mValues[position], &value, sizeof(value));
+	}
+
+	BinaryDataFormat::Reader::Reader(const char* data, UInt size, bool copyStrings, DataDocument& document):
+		mData(data), mEnd(data + size), mCopyStrings(copyStrings), mHandler(document)
+	{}
+
+	bool BinaryDataFormat::Reader::Read()
+	{
+		if (!IsBinaryData(mData, (UInt)(mEnd - mData)))
+			return false;
+
+		mData += sizeof(magic);
+
+		UInt dataVersion;
+		if (!ReadData(dataVersion) || dataVersion != version)
+			return false;
+
+		UInt keysCount;
+		if (!ReadData(keysCount))
+			return false;
+
+		mKeys.Reserve(keysCount);
+		mKeysLength.Reserve(keysCount);
+
+		for (UInt i = 0; i < keysCount; i++)
+		{
+			const char* key;
+			UInt length;
+			if (!ReadString(key, length))
+				return false;
+
+			mKeys.Add(key);
+			mKeysLength.Add(length);
+		}
+
+		if (!ReadValue())
+			return false;
+
+		(DataValue&)mHandler.document = std::move(*mHandler.stack.Pop<DataValue>());
+		return true;
+	}
+
+	template<typename _type>
+	bool BinaryDataFormat::Reader::ReadData(_type& value)
+	{
+		if (mEnd - mData < (std::ptrdiff_t)sizeof(_type))
+			return false;
+
+		// Values are not aligned in buffer, so they're copied
+		memcpy(&value, mData, sizeof(_type));
+		mData += sizeof(_type);
+		return true;
+	}
+
+	bool BinaryDataFormat::Reader::ReadString(const char*& str, UInt& length)
+	{
+		if (!ReadData(length))
+			return false;
+
+		if ((UInt)(mEnd - mData) <= length || mData[length] != '\0')
+			return false;
+
+		str = mData;
+		mData += length + 1;
+		return true;
+	}
+
+	bool BinaryDataFormat::Reader::ReadValue()
+	{
+		ValueType type;
+		if (!ReadData(type))
+			return false;
+
+		switch (type)
+		{
+			case ValueType::Null:
+			return mHandler.Null();
+
+			case ValueType::BoolTrue:
+			return mHandler.Bool(true);
+
+			case ValueType::BoolFalse:
+			return mHandler.Bool(false);
+
+			case ValueType::Int:
+			{
+				int value;
+				return ReadData(value) && mHandler.Int(value);
+			}
+
+			case ValueType::UInt:
+			{
+				unsigned value;
+				return ReadData(value) && mHandler.Uint(value);
+			}
+
+			case ValueType::Int64:
+			{
+				int64_t value;
+				return ReadData(value) && mHandler.Int64(value);
+			}
+
+			case ValueType::UInt64:
+			{
+				uint64_t value;
+				return ReadData(value) && mHandler.Uint64(value);
+			}
+
+			case ValueType::Double:
+			{
+				double value;
+				return ReadData(value) && mHandler.Double(value);
+			}
+
+			case ValueType::String:
+			{
+				const char* str;
+				UInt length;
+				return ReadString(str, length) && mHandler.String(str, length, mCopyStrings);
+			}
+
+			case ValueType::Array:
+			{
+				UInt count;
+				if (!ReadData(count))
+					return false;
+
+				mHandler.StartArray();
+
+				for (UInt i = 0; i < count; i++)
+				{
+					if (!ReadValue())
+						return false;
+				}
+
+				return mHandler.EndArray(count);
+			}
+
+			case ValueType::Object:
+			{
+				UInt count;
+				if (!ReadData(count))
+					return false;
+
+				mHandler.StartObject();
+
+				for (UInt i = 0; i < count; i++)
+				{
+					UInt keyIdx;
+					if (!ReadData(keyIdx) || keyIdx >= (UInt)mKeys.Count())
+						return false;
+
+					// Keys are referenced to keys table, so same keys share one string
+					mHandler.Key(mKeys[keyIdx], mKeysLength[keyIdx], mCopyStrings);
+
+					if (!ReadValue())
+						return false;
+				}
+
+				return mHandler.EndObject(count);
+			}
+		}
+
+		return false;
+	}
+}
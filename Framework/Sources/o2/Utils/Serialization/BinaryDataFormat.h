@@ -0,0 +1,117 @@
+#pragma once
+#include "DataValue.h"
+#include "o2/Utils/Serialization/JsonDataFormat.h"
+
+namespace o2
+{
+	// Returns true when data starts with binary data document header
+	bool IsBinaryData(const char* data, UInt size);
+
+	// Parses binary document into DataDocument. Strings are referenced to buffer, so buffer must live while document is used
+	bool ParseBinaryInplace(char* data, UInt size, DataDocument& document);
+
+	// Parses binary document into DataDocument. Strings are copied
+	bool ParseBinary(const char* data, UInt size, DataDocument& document);
+
+	// Writes data into binary string
+	void WriteBinary(String& str, const DataDocument& document);
+
+	// ------------------------------------------------------------------------------------------------------
+	// Binary data document format. Document starts with header and interned keys table, then root value goes.
+	// Each value starts with type byte. Strings are length-prefixed and null-terminated, so they can be
+	// referenced directly in loaded buffer. Arrays and objects are prefixed with elements count, object
+	// members are stored as key index and value
+	// ------------------------------------------------------------------------------------------------------
+	class BinaryDataFormat
+	{
+	public:
+		enum class ValueType : unsigned char { Null, BoolTrue, BoolFalse, Int, UInt, Int64, UInt64, Double, String, Array, Object };
+
+		static const char magic[4];   // Document header magic
+		static const UInt version;    // Format version
+		static const UInt headerSize; // Size of magic and version
+
+	public:
+		// ------------------------------------------------------------
+		// Binary data writer. Has same interface as rapidjson writers,
+		// so it's used with DataValue::Write
+		// ------------------------------------------------------------
+		class Writer
+		{
+		public:
+			// Default constructor
+			Writer();
+
+			// Writes header, keys table and values into result
+			void GetResult(o2::String& result) const;
+
+			bool Null();
+			bool Bool(bool value);
+			bool Int(int value);
+			bool Uint(unsigned value);
+			bool Int64(int64_t value);
+			bool Uint64(uint64_t value);
+			bool Double(double value);
+			bool String(const char* str, unsigned length, bool copy);
+			bool StartObject();
+			bool Key(const char* str, unsigned length, bool copy);
+			bool EndObject(unsigned memberCount);
+			bool StartArray();
+			bool EndArray(unsigned elementCount);
+
+		private:
+			std::string           mValues;          // Written values
+			Vector<o2::String>    mKeys;            // Interned keys in order of appearance
+			Map<o2::String, UInt> mKeysIdx;         // Interned keys indices
+			Vector<UInt>          mCountsPositions; // Positions of started arrays and objects counts, filled at the end
+
+		private:
+			// Writes value type
+			void WriteType(ValueType type);
+
+			// Writes plain data
+			template<typename _type>
+			void WriteData(const _type& value);
+
+			// Writes length-prefixed null-terminated string
+			static void WriteString(std::string& buffer, const char* str, unsigned length);
+
+			// Writes count of last started array or object
+			void WriteCount(unsigned count);
+		};
+
+		// --------------------------------------------------------------------------
+		// Binary data reader. Reads document and builds DOM with json parser handler
+		// --------------------------------------------------------------------------
+		class Reader
+		{
+		public:
+			// Constructor
+			Reader(const char* data, UInt size, bool copyStrings, DataDocument& document);
+
+			// Reads document. Returns false when data is corrupted
+			bool Read();
+
+		private:
+			const char* mData;        // Current read position
+			const char* mEnd;         // End of data
+			bool        mCopyStrings; // Are strings copied into document, otherwise they are referenced to data
+
+			Vector<const char*> mKeys;       // Interned keys
+			Vector<UInt>        mKeysLength; // Interned keys lengths
+
+			JsonDataDocumentParseHandler mHandler; // DOM builder
+
+		private:
+			// Reads plain data. Returns false when data is over
+			template<typename _type>
+			bool ReadData(_type& value);
+
+			// Reads length-prefixed null-terminated string
+			bool ReadString(const char*& str, UInt& length);
+
+			// Reads value with type
+			bool ReadValue();
+		};
+	};
+}
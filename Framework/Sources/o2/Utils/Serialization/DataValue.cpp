@@ -2,6 +2,7 @@
 #include "DataValue.h"
 
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/Serialization/JsonDataFormat.h"
 
 #include "rapidjson/document.h"
@@ -466,8 +467,9 @@ namespace o2
 			}
 		}
 
+		DataValue value(*mDocument);
 		DataMember* newMember =
-			new (mData.objectData.members + mData.objectData.count) DataMember(name, DataValue(*mDocument));
+			new (mData.objectData.members + mData.objectData.count) DataMember(name, value);
 
 		mData.objectData.count++;
 
@@ -833,6 +835,10 @@ namespace o2
 		char* data = (char*)mAllocator.Allocate(size);
 		file.ReadData(data, size);
 
+		// Built assets can be stored in binary format, it is detected by header. Strings are referenced to loaded buffer
+		if (format == Format::Binary || IsBinaryData(data, size))
+			return ParseBinaryInplace(data, size, *this);
+
 		if (format == Format::JSON)
 			return ParseJsonInplace(data, *this);
 
@@ -841,6 +847,9 @@ namespace o2
 
 	bool DataDocument::LoadFromData(const String& data, Format format /*= Format::JSON*/)
 	{
+		if (format == Format::Binary || IsBinaryData(data.Data(), data.Length()))
+			return ParseBinary(data.Data(), data.Length(), *this);
+
 		if (format == Format::JSON)
 			return ParseJson(data.Data(), *this);
 
@@ -857,7 +866,7 @@ namespace o2
 
 		file.WriteData(data.Data(), data.Length());
 
-		return false;
+		return true;
 	}
 
 	String DataDocument::SaveAsString(Format format /*= Format::JSON*/) const
@@ -869,6 +878,13 @@ namespace o2
 			return buf;
 		}
 
+		if (format == Format::Binary)
+		{
+			String buf;
+			WriteBinary(buf, *this);
+			return buf;
+		}
+
 		return "";
 		//return XmlDataFormat::SaveDataDoc(*this);
 	}
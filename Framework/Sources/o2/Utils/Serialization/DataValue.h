@@ -432,10 +432,10 @@ namespace o2
 		template<typename _type>
 		DataDocument& operator=(const _type& value);
 
-		// Loads data structure from file
+		// Loads data structure from file. Binary data is detected by header regardless of format
 		bool LoadFromFile(const String& fileName, Format format = Format::JSON);
 
-		// Loads data structure from string
+		// Loads data structure from string. Binary data is detected by header regardless of format
 		bool LoadFromData(const String& data, Format format = Format::JSON);
 
 		// Saves data to file with specified format
@@ -495,8 +495,8 @@ namespace o2
 
 		BaseMemberIterator<_const>& operator++() { ++mPointer; return *this; }
 		BaseMemberIterator<_const>& operator--() { --mPointer; return *this; }
-		BaseMemberIterator<_const>  operator++(int) { Iterator old(*this); ++mPointer; return old; }
-		BaseMemberIterator<_const>  operator--(int) { Iterator old(*this); --mPointer; return old; }
+		BaseMemberIterator<_const>  operator++(int) { BaseMemberIterator<_const> old(*this); ++mPointer; return old; }
+		BaseMemberIterator<_const>  operator--(int) { BaseMemberIterator<_const> old(*this); --mPointer; return old; }
 
 		BaseMemberIterator<_const> operator+(int n) const { return Iterator(mPointer+n); }
 		BaseMemberIterator<_const> operator-(int n) const { return Iterator(mPointer-n); }
@@ -1186,16 +1186,16 @@ namespace o2
 	struct DataValue::Converter<T, typename std::enable_if<std::is_pointer<T>::value && !std::is_const<T>::value &&
 		!std::is_base_of<o2::IObject, typename std::remove_pointer<T>::type>::value && !std::is_same<void*, T>::value>::type>
 	{
-		static constexpr bool isSupported = DataValue::Converter<std::remove_pointer<T>::type>::isSupported;
+		static constexpr bool isSupported = DataValue::Converter<typename std::remove_pointer<T>::type>::isSupported;
 
 		static void Write(const T& value, DataValue& data)
 		{
-			DataValue::Converter<std::remove_pointer<T>::type>::Write(*value, data);
+			DataValue::Converter<typename std::remove_pointer<T>::type>::Write(*value, data);
 		}
 
 		static void Read(T& value, const DataValue& data)
 		{
-			DataValue::Converter<std::remove_pointer<T>::type>::Read(*value, data);
+			DataValue::Converter<typename std::remove_pointer<T>::type>::Read(*value, data);
 		}
 	};
 
@@ -1212,7 +1212,10 @@ namespace o2
 			data.mData.arrayData.capacity = 0;
 
 			for (auto& v : value)
-				data.AddElement(DataValue(v, *data.mDocument));
+			{
+				DataValue element(v, *data.mDocument);
+				data.AddElement(element);
+			}
 		}
 
 		static void Read(Vector<T>& value, const DataValue& data)
@@ -1309,85 +1312,10 @@ namespace o2
 			value.Set(val);
 		}
 	};
-
-	template<typename T>
-	struct DataValue::Converter<T, typename std::enable_if<std::is_base_of<IObject, T>::value || std::is_same<IObject, T>::value>::type>
-	{
-		static constexpr bool isSupported = true;
-
-		static void Write(const T& value, DataValue& data)
-		{
-			struct helper
-			{
-				static void WriteObject(void* object, const ObjectType& type, DataValue& node)
-				{
-					for (auto baseType : type.GetBaseTypes())
-					{
-						const ObjectType* baseObjectType = dynamic_cast<const ObjectType*>(baseType.type);
-						if (!baseObjectType)
-							continue;
-
-						void* baseObject = (*baseType.dynamicCastUpFunc)(object);
-						WriteObject(baseObject, *baseObjectType, node);
-					}
-
-					for (auto& field : type.GetFields())
-					{
-						auto srlzAttribute = field.GetAttribute<SerializableAttribute>();
-						if (srlzAttribute && field.CheckSerializable(object))
-							field.SerializeFromObject(object, node.AddMember(field.GetName()));
-					}
-				}
-			};
-
-			if (value.GetType().IsBasedOn(TypeOf(ISerializable)))
-				dynamic_cast<const ISerializable&>(value).OnSerialize(data);
-
-			const ObjectType& type = dynamic_cast<const ObjectType&>(value.GetType());
-			void* objectPtr = type.DynamicCastFromIObject(const_cast<IObject*>(dynamic_cast<const IObject*>(&value)));
-
-			helper::WriteObject(objectPtr, type, data);
-		}
-
-		static void Read(T& value, const DataValue& data)
-		{
-			struct helper
-			{
-				static void ReadObject(void* object, const ObjectType& type, const DataValue& node)
-				{
-					for (auto baseType : type.GetBaseTypes())
-					{
-						const ObjectType* baseObjectType = dynamic_cast<const ObjectType*>(baseType.type);
-						if (!baseObjectType)
-							continue;
-
-						void* baseObject = (*baseType.dynamicCastUpFunc)(object);
-						ReadObject(baseObject, *baseObjectType, node);
-					}
-
-					for (auto& field : type.GetFields())
-					{
-						auto srlzAttribute = field.GetAttribute<SerializableAttribute>();
-						if (srlzAttribute)
-						{
-							auto fldNode = node.FindMember(field.GetName());
-							if (fldNode)
-								field.DeserializeFromObject(object, *fldNode);
-						}
-					}
-				}
-			};
-
-			const ObjectType& type = dynamic_cast<const ObjectType&>(value.GetType());
-			void* objectPtr = type.DynamicCastFromIObject(dynamic_cast<IObject*>(&value));
-			helper::ReadObject(objectPtr, type, data);
-
-			if (value.GetType().IsBasedOn(TypeOf(ISerializable)))
-				dynamic_cast<ISerializable&>(value).OnDeserialized(data);
-		}
-	};
 }
 
 PRE_ENUM_META(o2::DataValue::Flags);
 
 PRE_ENUM_META(o2::DataDocument::Format);
+
+#include "o2/Utils/Reflection/TypeSerializerImpl.h"
@@ -94,6 +94,83 @@ namespace o2
 
 #define SERIALIZABLE_ATTRIBUTE() \
     AddAttribute(new SerializableAttribute())
+
+	template<typename T>
+	struct DataValue::Converter<T, typename std::enable_if<std::is_base_of<IObject, T>::value || std::is_same<IObject, T>::value>::type>
+	{
+		static constexpr bool isSupported = true;
+
+		static void Write(const T& value, DataValue& data)
+		{
+			struct helper
+			{
+				static void WriteObject(void* object, const ObjectType& type, DataValue& node)
+				{
+					for (auto baseType : type.GetBaseTypes())
+					{
+						const ObjectType* baseObjectType = dynamic_cast<const ObjectType*>(baseType.type);
+						if (!baseObjectType)
+							continue;
+
+						void* baseObject = (*baseType.dynamicCastUpFunc)(object);
+						WriteObject(baseObject, *baseObjectType, node);
+					}
+
+					for (auto& field : type.GetFields())
+					{
+						auto srlzAttribute = field.GetAttribute<SerializableAttribute>();
+						if (srlzAttribute && field.CheckSerializable(object))
+							field.SerializeFromObject(object, node.AddMember(field.GetName()));
+					}
+				}
+			};
+
+			if (value.GetType().IsBasedOn(TypeOf(ISerializable)))
+				dynamic_cast<const ISerializable&>(value).OnSerialize(data);
+
+			const ObjectType& type = dynamic_cast<const ObjectType&>(value.GetType());
+			void* objectPtr = type.DynamicCastFromIObject(const_cast<IObject*>(dynamic_cast<const IObject*>(&value)));
+
+			helper::WriteObject(objectPtr, type, data);
+		}
+
+		static void Read(T& value, const DataValue& data)
+		{
+			struct helper
+			{
+				static void ReadObject(void* object, const ObjectType& type, const DataValue& node)
+				{
+					for (auto baseType : type.GetBaseTypes())
+					{
+						const ObjectType* baseObjectType = dynamic_cast<const ObjectType*>(baseType.type);
+						if (!baseObjectType)
+							continue;
+
+						void* baseObject = (*baseType.dynamicCastUpFunc)(object);
+						ReadObject(baseObject, *baseObjectType, node);
+					}
+
+					for (auto& field : type.GetFields())
+					{
+						auto srlzAttribute = field.GetAttribute<SerializableAttribute>();
+						if (srlzAttribute)
+						{
+							auto fldNode = node.FindMember(field.GetName());
+							if (fldNode)
+								field.DeserializeFromObject(object, *fldNode);
+						}
+					}
+				}
+			};
+
+			const ObjectType& type = dynamic_cast<const ObjectType&>(value.GetType());
+			void* objectPtr = type.DynamicCastFromIObject(dynamic_cast<IObject*>(&value));
+			helper::ReadObject(objectPtr, type, data);
+
+			if (value.GetType().IsBasedOn(TypeOf(ISerializable)))
+				dynamic_cast<ISerializable&>(value).OnDeserialized(data);
+		}
+	};
 }
 
 CLASS_BASES_META(o2::ISerializable)
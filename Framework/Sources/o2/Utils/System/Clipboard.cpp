@@ -8,6 +8,10 @@
 
 namespace o2
 {
+#if defined PLATFORM_LINUX
+	// There is no system clipboard in headless application, text is kept inside process
+	static WString clipboardText;
+#endif
 
 	void Clipboard::SetText(const WString& text)
 	{
@@ -24,6 +28,8 @@ namespace o2
 			SetClipboardData(CF_UNICODETEXT, hgBuffer);
 			CloseClipboard();
 		}
+#elif defined PLATFORM_LINUX
+		clipboardText = text;
 #endif
 	}
 
@@ -44,6 +50,8 @@ namespace o2
 		return res;
 #elif PLATFORM_ANDROID
         return WString();
+#elif defined PLATFORM_LINUX
+		return clipboardText;
 #endif
 	}
 
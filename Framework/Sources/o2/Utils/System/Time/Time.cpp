@@ -5,6 +5,8 @@
 
 #ifdef PLATFORM_WINDOWS
 #include <Windows.h>
+#elif defined PLATFORM_LINUX
+#include <time.h>
 #endif
 
 namespace o2
@@ -87,6 +89,12 @@ namespace o2
 		return TimeStamp(tm.wSecond, tm.wMinute, tm.wHour, tm.wDay, tm.wMonth, tm.wYear);
 #elif defined PLATFORM_ANDROID
         return TimeStamp();
+#elif defined PLATFORM_LINUX
+		time_t now = time(nullptr);
+		struct tm tm;
+		gmtime_r(&now, &tm);
+
+		return TimeStamp(tm.tm_sec, tm.tm_min, tm.tm_hour, tm.tm_mday, tm.tm_mon + 1, tm.tm_year + 1900);
 #endif
 	}
 
@@ -71,4 +71,32 @@ namespace o2
 		return deltaTime;
 	}
 #endif
+
+#ifdef PLATFORM_LINUX
+	void Timer::Reset()
+	{
+		clock_gettime(CLOCK_MONOTONIC, &mStartTime);
+		mLastElapsedTime = mStartTime;
+	}
+
+	float Timer::GetTime()
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		float res = (float)((double)(now.tv_sec - mStartTime.tv_sec) + (double)(now.tv_nsec - mStartTime.tv_nsec)/1000000000.0);
+		mLastElapsedTime = now;
+
+		return res;
+	}
+
+	float Timer::GetDeltaTime()
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		float res = (float)((double)(now.tv_sec - mLastElapsedTime.tv_sec) + (double)(now.tv_nsec - mLastElapsedTime.tv_nsec)/1000000000.0);
+		mLastElapsedTime = now;
+
+		return res;
+	}
+#endif
 }
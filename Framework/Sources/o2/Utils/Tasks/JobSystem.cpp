@@ -0,0 +1,309 @@
+#include "o2/stdafx.h"
+#include "JobSystem.h"
+
+#include "o2/Utils/Math/Math.h"
+
+namespace o2
+{
+	// Job system, that owns current worker thread
+	static thread_local JobSystem* currentWorkerJobSystem = nullptr;
+
+	// Index of current worker thread in it's job system
+	static thread_local int currentWorkerIdx = -1;
+
+	Job::Job():
+		pendingDependencies(0), done(false)
+	{}
+
+	JobHandle::JobHandle()
+	{}
+
+	bool JobHandle::operator==(const JobHandle& other) const
+	{
+		return mJob == other.mJob;
+	}
+
+	bool JobHandle::operator!=(const JobHandle& other) const
+	{
+		return mJob != other.mJob;
+	}
+
+	bool JobHandle::IsValid() const
+	{
+		return mJob != nullptr;
+	}
+
+	bool JobHandle::IsDone() const
+	{
+		return !mJob || mJob->done;
+	}
+
+	JobSystem::JobSystem(int workersCount /*= 0*/):
+		mNextQueue(0), mQueuedJobs(0), mStopping(false)
+	{
+		if (workersCount <= 0)
+			workersCount = Math::Max((int)std::thread::hardware_concurrency() - 1, 1);
+
+		for (int i = 0; i < workersCount; i++)
+			mQueues.Add(mnew WorkerQueue());
+
+		for (int i = 0; i < workersCount; i++)
+			mWorkers.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mStopping = true;
+		}
+
+		mSleepCondition.notify_all();
+
+		for (auto& worker : mWorkers)
+			worker.join();
+
+		for (auto queue : mQueues)
+			delete queue;
+	}
+
+	int JobSystem::GetWorkersCount() const
+	{
+		return (int)mWorkers.size();
+	}
+
+	bool JobSystem::IsWorkerThread() const
+	{
+		return currentWorkerJobSystem == this;
+	}
+
+	JobHandle JobSystem::Run(const Function<void()>& job)
+	{
+		return Run(job, Vector<JobHandle>());
+	}
+
+	JobHandle JobSystem::Run(const Function<void()>& job, const JobHandle& dependency)
+	{
+		if (!dependency.IsValid())
+			return Run(job, Vector<JobHandle>());
+
+		return Run(job, Vector<JobHandle>({ dependency }));
+	}
+
+	JobHandle JobSystem::Run(const Function<void()>& job, const Vector<JobHandle>& dependencies)
+	{
+		auto newJob = std::make_shared<Job>();
+		newJob->function = job;
+
+		// One extra dependency keeps job from starting until all dependencies are registered
+		newJob->pendingDependencies = 1;
+
+		for (auto& dependency : dependencies)
+		{
+			if (dependency.mJob && AddContinuation(dependency.mJob, newJob))
+				newJob->pendingDependencies++;
+		}
+
+		if (--newJob->pendingDependencies == 0)
+			Enqueue(newJob);
+
+		JobHandle handle;
+		handle.mJob = newJob;
+		return handle;
+	}
+
+	JobHandle JobSystem::Combine(const Vector<JobHandle>& jobs)
+	{
+		return Run(Function<void()>(), jobs);
+	}
+
+	JobHandle JobSystem::ParallelForAsync(int begin, int end, const Function<void(int)>& func, int grainSize /*= 0*/,
+										  const JobHandle& dependency /*= JobHandle()*/)
+	{
+		int count = end - begin;
+		if (count <= 0)
+			return Run(Function<void()>(), dependency);
+
+		if (grainSize <= 0)
+			grainSize = Math::Max(count/(GetWorkersCount()*4), 1);
+
+		// Function is shared between all chunks instead of copying it into each one
+		auto sharedFunc = std::make_shared<Function<void(int)>>(func);
+
+		Vector<JobHandle> chunks;
+		for (int chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+		{
+			int chunkEnd = Math::Min(chunkBegin + grainSize, end);
+			chunks.Add(Run([=]() {
+				for (int i = chunkBegin; i < chunkEnd; i++)
+					(*sharedFunc)(i);
+			}, dependency));
+		}
+
+		return Combine(chunks);
+	}
+
+	void JobSystem::ParallelFor(int begin, int end, const Function<void(int)>& func, int grainSize /*= 0*/)
+	{
+		Wait(ParallelForAsync(begin, end, func, grainSize));
+	}
+
+	void JobSystem::Wait(const JobHandle& job)
+	{
+		while (!job.IsDone())
+		{
+			if (!ExecuteOneJob())
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::Wait(const Vector<JobHandle>& jobs)
+	{
+		for (auto& job : jobs)
+			Wait(job);
+	}
+
+	void JobSystem::RunOnMainThread(const Function<void()>& func)
+	{
+		std::unique_lock<std::mutex> lock(mMainThreadMutex);
+		mMainThreadJobs.Add(func);
+	}
+
+	void JobSystem::ExecuteMainThreadJobs()
+	{
+		Vector<Function<void()>> jobs;
+
+		{
+			std::unique_lock<std::mutex> lock(mMainThreadMutex);
+			jobs.swap(mMainThreadJobs);
+		}
+
+		for (auto& job : jobs)
+			job();
+	}
+
+	void JobSystem::WorkerLoop(int workerIdx)
+	{
+		currentWorkerJobSystem = this;
+		currentWorkerIdx = workerIdx;
+
+		while (!mStopping)
+		{
+			if (ExecuteOneJob())
+				continue;
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [&]() { return mStopping || mQueuedJobs > 0; });
+		}
+
+		currentWorkerJobSystem = nullptr;
+		currentWorkerIdx = -1;
+	}
+
+	void JobSystem::Enqueue(const std::shared_ptr<Job>& job)
+	{
+		int queueIdx;
+		if (IsWorkerThread())
+			queueIdx = currentWorkerIdx;
+		else
+			queueIdx = (mNextQueue++ & 0x7fffffff) % mQueues.Count();
+
+		{
+			WorkerQueue* queue = mQueues[queueIdx];
+			std::unique_lock<std::mutex> lock(queue->mutex);
+			queue->jobs.push_back(job);
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mQueuedJobs++;
+		}
+
+		mSleepCondition.notify_one();
+	}
+
+	std::shared_ptr<Job> JobSystem::TakeJob()
+	{
+		if (mQueuedJobs == 0)
+			return nullptr;
+
+		int queuesCount = mQueues.Count();
+		int ownIdx = IsWorkerThread() ? currentWorkerIdx : -1;
+
+		if (ownIdx >= 0)
+		{
+			WorkerQueue* queue = mQueues[ownIdx];
+			std::unique_lock<std::mutex> lock(queue->mutex);
+			if (!queue->jobs.empty())
+			{
+				auto job = queue->jobs.back();
+				queue->jobs.pop_back();
+				mQueuedJobs--;
+				return job;
+			}
+		}
+
+		int startIdx = ownIdx >= 0 ? ownIdx + 1 : 0;
+		for (int i = 0; i < queuesCount; i++)
+		{
+			int idx = (startIdx + i) % queuesCount;
+			if (idx == ownIdx)
+				continue;
+
+			WorkerQueue* queue = mQueues[idx];
+			std::unique_lock<std::mutex> lock(queue->mutex);
+			if (!queue->jobs.empty())
+			{
+				auto job = queue->jobs.front();
+				queue->jobs.pop_front();
+				mQueuedJobs--;
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool JobSystem::ExecuteOneJob()
+	{
+		auto job = TakeJob();
+		if (!job)
+			return false;
+
+		Execute(job);
+		return true;
+	}
+
+	void JobSystem::Execute(const std::shared_ptr<Job>& job)
+	{
+		if (!job->function.IsEmpty())
+		{
+			job->function();
+			job->function.Clear();
+		}
+
+		std::vector<std::shared_ptr<Job>> continuations;
+
+		{
+			std::unique_lock<std::mutex> lock(job->continuationsMutex);
+			job->done = true;
+			continuations.swap(job->continuations);
+		}
+
+		for (auto& continuation : continuations)
+		{
+			if (--continuation->pendingDependencies == 0)
+				Enqueue(continuation);
+		}
+	}
+
+	bool JobSystem::AddContinuation(const std::shared_ptr<Job>& dependency, const std::shared_ptr<Job>& job)
+	{
+		std::unique_lock<std::mutex> lock(dependency->continuationsMutex);
+		if (dependency->done)
+			return false;
+
+		dependency->continuations.push_back(job);
+		return true;
+	}
+}
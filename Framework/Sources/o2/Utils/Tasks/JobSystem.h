@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "o2/Utils/Function.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class JobSystem;
+
+	// ---------------------------------------------------------------------------
+	// Job, executing on worker thread. Can wait other jobs before starting
+	// ---------------------------------------------------------------------------
+	struct Job
+	{
+		Function<void()> function; // Job function
+
+		std::atomic<int>  pendingDependencies; // Count of not finished dependencies. Job runs when it reaches zero
+		std::atomic<bool> done;                // Is job finished
+
+		std::mutex                        continuationsMutex; // Continuations list and done flag mutex
+		std::vector<std::shared_ptr<Job>> continuations;      // Jobs, waiting for this job
+
+		// Default constructor
+		Job();
+	};
+
+	// -------------------------------------------------------------
+	// Handle of scheduled job. Can be waited or used as dependency
+	// -------------------------------------------------------------
+	class JobHandle
+	{
+	public:
+		// Default constructor, empty handle
+		JobHandle();
+
+		// Check equals operator
+		bool operator==(const JobHandle& other) const;
+
+		// Check not equals operator
+		bool operator!=(const JobHandle& other) const;
+
+		// Returns true when handle refers a job
+		bool IsValid() const;
+
+		// Returns true when job finished. Empty handle is always done
+		bool IsDone() const;
+
+	protected:
+		std::shared_ptr<Job> mJob; // Referenced job
+
+		friend class JobSystem;
+	};
+
+	// -------------------------------------------------------------------------------------------------
+	// Work-stealing jobs pool. Each worker thread has own jobs queue, takes newest jobs from it and
+	// steals oldest jobs from other workers when it is empty. Waiting thread executes jobs while waiting
+	// -------------------------------------------------------------------------------------------------
+	class JobSystem
+	{
+	public:
+		// Constructor. Starts worker threads. Zero workers count means hardware threads count minus one
+		JobSystem(int workersCount = 0);
+
+		// Destructor. Finishes workers threads, not started jobs are dropped
+		~JobSystem();
+
+		// Returns count of worker threads
+		int GetWorkersCount() const;
+
+		// Returns true when it is called from worker thread
+		bool IsWorkerThread() const;
+
+		// Schedules job to run on worker thread
+		JobHandle Run(const Function<void()>& job);
+
+		// Schedules job to run on worker thread after dependency finished
+		JobHandle Run(const Function<void()>& job, const JobHandle& dependency);
+
+		// Schedules job to run on worker thread after all dependencies finished
+		JobHandle Run(const Function<void()>& job, const Vector<JobHandle>& dependencies);
+
+		// Returns handle that finishes when all jobs finished
+		JobHandle Combine(const Vector<JobHandle>& jobs);
+
+		// Schedules function call for each index in range [begin, end) on worker threads. Indices are split into
+		// chunks of grainSize; zero grain size splits range evenly between workers
+		JobHandle ParallelForAsync(int begin, int end, const Function<void(int)>& func, int grainSize = 0,
+								   const JobHandle& dependency = JobHandle());
+
+		// Calls function for each index in range [begin, end) on worker threads and waits for finish
+		void ParallelFor(int begin, int end, const Function<void(int)>& func, int grainSize = 0);
+
+		// Waits job finish. Executes other jobs while waiting
+		void Wait(const JobHandle& job);
+
+		// Waits all jobs finish. Executes other jobs while waiting
+		void Wait(const Vector<JobHandle>& jobs);
+
+		// Schedules function call on main thread, in next ExecuteMainThreadJobs
+		void RunOnMainThread(const Function<void()>& func);
+
+		// Executes jobs scheduled for main thread
+		void ExecuteMainThreadJobs();
+
+	protected:
+		// -----------------------------------
+		// Worker jobs queue with own mutex
+		// -----------------------------------
+		struct WorkerQueue
+		{
+			std::mutex                       mutex; // Queue mutex
+			std::deque<std::shared_ptr<Job>> jobs;  // Jobs queue. Owner takes from back, thieves take from front
+		};
+
+		std::vector<std::thread> mWorkers;    // Worker threads
+		Vector<WorkerQueue*>     mQueues;     // Jobs queues, one per worker
+		std::atomic<int>         mNextQueue;  // Next queue index for jobs scheduled from not worker threads
+		std::atomic<int>         mQueuedJobs; // Count of jobs in queues
+		std::atomic<bool>        mStopping;   // True when workers must finish
+
+		std::mutex              mSleepMutex;     // Mutex for sleeping workers
+		std::condition_variable mSleepCondition; // Condition for waking workers
+
+		std::mutex               mMainThreadMutex; // Main thread jobs mutex
+		Vector<Function<void()>> mMainThreadJobs;  // Jobs scheduled on main thread
+
+	protected:
+		// Worker thread function
+		void WorkerLoop(int workerIdx);
+
+		// Puts job into queue and wakes worker
+		void Enqueue(const std::shared_ptr<Job>& job);
+
+		// Takes job from own queue or steals from others
+		std::shared_ptr<Job> TakeJob();
+
+		// Takes and executes one job. Returns false when there were no jobs
+		bool ExecuteOneJob();
+
+		// Executes job and schedules continuations
+		void Execute(const std::shared_ptr<Job>& job);
+
+		// Adds job as continuation of dependency. Returns false if dependency already finished
+		bool AddContinuation(const std::shared_ptr<Job>& dependency, const std::shared_ptr<Job>& job);
+	};
+}
@@ -50,17 +50,42 @@ namespace o2
 		task->doTask = func;
 	}
 
+	JobHandle TaskManager::RunJob(const Function<void()>& job)
+	{
+		return mJobSystem->Run(job);
+	}
+
+	JobHandle TaskManager::RunJob(const Function<void()>& job, const JobHandle& dependency)
+	{
+		return mJobSystem->Run(job, dependency);
+	}
+
+	void TaskManager::ParallelFor(int begin, int end, const Function<void(int)>& func, int grainSize /*= 0*/)
+	{
+		mJobSystem->ParallelFor(begin, end, func, grainSize);
+	}
+
+	JobSystem& TaskManager::GetJobSystem() const
+	{
+		return *mJobSystem;
+	}
+
 	TaskManager::TaskManager():
 		mLastTaskId(0)
-	{}
+	{
+		mJobSystem = mnew JobSystem();
+	}
 
 	TaskManager::~TaskManager()
 	{
 		StopAllTasks();
+		delete mJobSystem;
 	}
 
 	void TaskManager::Update(float dt)
 	{
+		mJobSystem->ExecuteMainThreadJobs();
+
 		Vector<Task*> doneTasks;
 		for (auto task : mTasks)
 		{
@@ -3,10 +3,14 @@
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Singleton.h"
 #include "o2/Utils/Function.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 
 // Task manager access macros
 #define o2Tasks o2::TaskManager::Instance()
 
+// Job system access macros
+#define o2Jobs o2::TaskManager::Instance().GetJobSystem()
+
 namespace o2
 {
 	class Task;
@@ -36,12 +40,25 @@ namespace o2
 		// It is called function after delay
 		void Invoke(const Function<void()> func, float delay);
 
-		// Updates tasks and checking for done
+		// Schedules job to run on worker thread
+		JobHandle RunJob(const Function<void()>& job);
+
+		// Schedules job to run on worker thread after dependency finished
+		JobHandle RunJob(const Function<void()>& job, const JobHandle& dependency);
+
+		// Calls function for each index in range [begin, end) on worker threads and waits for finish
+		void ParallelFor(int begin, int end, const Function<void(int)>& func, int grainSize = 0);
+
+		// Returns multi-threaded job system
+		JobSystem& GetJobSystem() const;
+
+		// Updates tasks and checking for done, executes jobs scheduled on main thread
 		void Update(float dt);
 
 	protected:
 		Vector<Task*> mTasks;      // All tasks array
 		int           mLastTaskId; // Last given task id
+		JobSystem*    mJobSystem;  // Worker threads jobs system
 		
 	protected:
 		// Default constructor
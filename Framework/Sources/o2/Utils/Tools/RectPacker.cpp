@@ -4,7 +4,7 @@
 namespace o2
 {
 	RectsPacker::RectsPacker(const Vec2F& maxSize):
-		mMaxSize(maxSize), mRectsPool(25, 25)
+		mMaxSize(maxSize), mRectsPool(25, 25), mHeuristic(Heuristic::BestShortSideFit), mRotationEnabled(false)
 	{
 	}
 
@@ -18,6 +18,8 @@ namespace o2
 		Rect* newRect = mRectsPool.Take();
 		newRect->size = size;
 		newRect->rect = RectF();
+		newRect->page = -1;
+		newRect->rotated = false;
 		mRects.Add(newRect);
 		return newRect;
 	}
@@ -34,6 +36,7 @@ namespace o2
 			mRectsPool.Free(rt);
 
 		mRects.Clear();
+		mFreeRects.Clear();
 	}
 
 	void RectsPacker::SetMaxSize(const Vec2F& maxSize)
@@ -46,6 +49,26 @@ namespace o2
 		return mMaxSize;
 	}
 
+	void RectsPacker::SetHeuristic(Heuristic heuristic)
+	{
+		mHeuristic = heuristic;
+	}
+
+	RectsPacker::Heuristic RectsPacker::GetHeuristic() const
+	{
+		return mHeuristic;
+	}
+
+	void RectsPacker::SetRotationEnabled(bool enabled)
+	{
+		mRotationEnabled = enabled;
+	}
+
+	bool RectsPacker::IsRotationEnabled() const
+	{
+		return mRotationEnabled;
+	}
+
 	int RectsPacker::GetPagesCount() const
 	{
 		if (mRects.IsEmpty())
@@ -54,122 +77,277 @@ namespace o2
 		return mRects.Max<int>([&](Rect* rt) { return rt->page; })->page + 1;
 	}
 
-	bool RectsPacker::Pack()
+	float RectsPacker::GetOccupancy() const
 	{
-		for (auto node : mQuadNodes)
-			delete node;
-
-		mQuadNodes.Clear();
-
-		mRects.ForEach([](Rect* rt) { rt->page = -1; rt->rect = RectI(); });
-		mRects.Sort([](auto a, auto b) { return a->size.y > b->size.y; });
+		int pagesCount = GetPagesCount();
+		if (pagesCount == 0)
+			return 0.0f;
 
+		float usedArea = 0.0f;
 		for (auto rt : mRects)
 		{
-			if (!InsertRect(*rt))
-				return false;
+			if (rt->page >= 0)
+				usedArea += rt->size.x*rt->size.y;
 		}
 
-		return true;
+		return usedArea/(mMaxSize.x*mMaxSize.y*(float)pagesCount);
 	}
 
-
-	void RectsPacker::CreateNewPage()
+	bool RectsPacker::Pack()
 	{
-		int maxPage = -1;
-		for (auto rt : mRects)
-			maxPage = Math::Max(maxPage, rt->page);
+		mFreeRects.Clear();
 
-		mQuadNodes.Add(mnew QuadNode(maxPage + 1, RectF(Vec2F(), mMaxSize)));
+		mRects.ForEach([](Rect* rt) { rt->page = -1; rt->rect = RectF(); rt->rotated = false; });
+
+		return PackNotPlacedRects();
 	}
 
-	bool RectsPacker::InsertRect(Rect& rt)
+	bool RectsPacker::PackIncremental()
 	{
-		for (auto node : mQuadNodes)
+		mFreeRects.Clear();
+
+		for (auto rt : mRects)
 		{
-			if (TryInsertRect(rt, node))
-				return true;
+			if (rt->page < 0)
+				continue;
+
+			Vec2F placedSize = rt->rotated ? Vec2F(rt->size.y, rt->size.x) : rt->size;
+			bool isValidPlacement = Math::Equals(rt->rect.Width(), placedSize.x) &&
+				Math::Equals(rt->rect.Height(), placedSize.y) &&
+				rt->rect.left >= 0 && rt->rect.bottom >= 0 &&
+				rt->rect.right <= mMaxSize.x && rt->rect.top <= mMaxSize.y;
+
+			if (!isValidPlacement)
+			{
+				rt->page = -1;
+				rt->rotated = false;
+				continue;
+			}
+
+			while (mFreeRects.Count() <= rt->page)
+				CreateNewPage();
 		}
 
-		for (auto node : mQuadNodes)
+		// Placed rectangles can overlap when they were set outside; such rectangles are placed again
+		Vector<Rect*> placedRects;
+		for (auto rt : mRects)
 		{
-			if (TryInsertRectInChilds(rt, node))
-				return true;
+			if (rt->page < 0)
+				continue;
+
+			bool overlaps = placedRects.Any([&](Rect* other) {
+				return other->page == rt->page &&
+					rt->rect.left < other->rect.right && rt->rect.right > other->rect.left &&
+					rt->rect.bottom < other->rect.top && rt->rect.top > other->rect.bottom;
+			});
+
+			if (overlaps)
+			{
+				rt->page = -1;
+				rt->rotated = false;
+				continue;
+			}
+
+			placedRects.Add(rt);
+			SplitFreeRects(rt->page, rt->rect);
 		}
 
-		CreateNewPage();
+		for (int i = 0; i < mFreeRects.Count(); i++)
+			PruneFreeRects(i);
 
-		for (auto node : mQuadNodes)
-		{
-			if (TryInsertRect(rt, node))
-				return true;
-		}
+		return PackNotPlacedRects();
+	}
 
-		for (auto node : mQuadNodes)
+	bool RectsPacker::PackNotPlacedRects()
+	{
+		Vector<Rect*> notPlacedRects = mRects.FindAll([](Rect* rt) { return rt->page < 0; });
+		notPlacedRects.Sort([](Rect* a, Rect* b) {
+			float aMax = Math::Max(a->size.x, a->size.y), bMax = Math::Max(b->size.x, b->size.y);
+			if (!Math::Equals(aMax, bMax))
+				return aMax > bMax;
+
+			return a->size.x*a->size.y > b->size.x*b->size.y;
+		});
+
+		for (auto rt : notPlacedRects)
 		{
-			if (TryInsertRectInChilds(rt, node))
-				return true;
+			if (!InsertRect(*rt))
+				return false;
 		}
 
-		return false;
+		return true;
 	}
 
-	bool RectsPacker::TryInsertRect(Rect& rt, QuadNode* node)
+	void RectsPacker::CreateNewPage()
 	{
-		if (node->free && node->rect.Width() >= rt.size.x &&
-			node->rect.Height() >= rt.size.y)
-		{
-			Vec2F leftDown = node->rect.LeftBottom();
-			Vec2F center = leftDown + rt.size;
-			Vec2F rightTop = node->rect.RightTop();
+		Vector<RectF> pageFreeRects;
+		pageFreeRects.Add(RectF(0.0f, mMaxSize.y, mMaxSize.x, 0.0f));
+		mFreeRects.Add(pageFreeRects);
+	}
 
-			node->free = false;
-			node->AddChild(mnew QuadNode(node->page, RectF(leftDown.x, rightTop.y, rightTop.x, center.y)));
-			node->AddChild(mnew QuadNode(node->page, RectF(center.x, center.y, rightTop.x, leftDown.y)));
+	bool RectsPacker::InsertRect(Rect& rt)
+	{
+		bool fitsPage = (rt.size.x <= mMaxSize.x && rt.size.y <= mMaxSize.y) ||
+			(mRotationEnabled && rt.size.y <= mMaxSize.x && rt.size.x <= mMaxSize.y);
 
-			rt.page = node->page;
-			rt.rect = RectF(leftDown, center);
+		if (!fitsPage)
+			return false;
 
-			return true;
+		// Pages are filled in order, so first pages become dense and last page keeps the most free space
+		for (int page = 0; page <= mFreeRects.Count(); page++)
+		{
+			if (page == mFreeRects.Count())
+				CreateNewPage();
+
+			float bestScore = FLT_MAX, bestSecondScore = FLT_MAX;
+			RectF position;
+			bool found = FindPosition(page, rt.size, position, bestScore, bestSecondScore);
+			bool rotated = false;
+
+			if (mRotationEnabled && FindPosition(page, Vec2F(rt.size.y, rt.size.x), position, bestScore, bestSecondScore))
+			{
+				found = true;
+				rotated = true;
+			}
+
+			if (found)
+			{
+				PlaceRect(rt, page, position, rotated);
+				return true;
+			}
 		}
 
 		return false;
 	}
 
-
-	bool RectsPacker::TryInsertRectInChilds(Rect& rt, QuadNode* node)
+	bool RectsPacker::FindPosition(int page, const Vec2F& size, RectF& position, float& bestScore, float& bestSecondScore) const
 	{
-		for (auto childNode : node->GetChilds())
+		bool found = false;
+
+		for (auto& freeRect : mFreeRects[page])
 		{
-			if (TryInsertRect(rt, childNode))
-				return true;
+			if (freeRect.Width() < size.x || freeRect.Height() < size.y)
+				continue;
+
+			float score, secondScore;
+			CalculateScore(freeRect, size, score, secondScore);
+
+			if (score < bestScore || (score == bestScore && secondScore < bestSecondScore))
+			{
+				bestScore = score;
+				bestSecondScore = secondScore;
+				position = RectF(freeRect.left, freeRect.bottom + size.y, freeRect.left + size.x, freeRect.bottom);
+				found = true;
+			}
 		}
 
-		for (auto childNode : node->GetChilds())
+		return found;
+	}
+
+	void RectsPacker::CalculateScore(const RectF& freeRect, const Vec2F& size, float& score, float& secondScore) const
+	{
+		float leftoverX = freeRect.Width() - size.x;
+		float leftoverY = freeRect.Height() - size.y;
+
+		switch (mHeuristic)
 		{
-			if (TryInsertRectInChilds(rt, childNode))
-				return true;
+			case Heuristic::BestShortSideFit:
+			score = Math::Min(leftoverX, leftoverY);
+			secondScore = Math::Max(leftoverX, leftoverY);
+			break;
+
+			case Heuristic::BestLongSideFit:
+			score = Math::Max(leftoverX, leftoverY);
+			secondScore = Math::Min(leftoverX, leftoverY);
+			break;
+
+			case Heuristic::BestAreaFit:
+			score = freeRect.Width()*freeRect.Height() - size.x*size.y;
+			secondScore = Math::Min(leftoverX, leftoverY);
+			break;
+
+			case Heuristic::BottomLeft:
+			default:
+			score = freeRect.bottom + size.y;
+			secondScore = freeRect.left;
+			break;
 		}
-
-		return false;
 	}
 
-	RectsPacker::QuadNode::QuadNode(int page /*= 0*/, const RectF& rect /*= RectF()*/):
-		page(page), rect(rect), free(true)
-	{}
+	void RectsPacker::PlaceRect(Rect& rt, int page, const RectF& position, bool rotated)
+	{
+		rt.page = page;
+		rt.rect = position;
+		rt.rotated = rotated;
+
+		SplitFreeRects(page, position);
+		PruneFreeRects(page);
+	}
 
-	void RectsPacker::QuadNode::OnChildAdded(QuadNode* child)
+	void RectsPacker::SplitFreeRects(int page, const RectF& usedRect)
 	{
-		child->page = page;
+		Vector<RectF>& freeRects = mFreeRects[page];
+		Vector<RectF> splittedFreeRects;
+		splittedFreeRects.Reserve(freeRects.Count() + 4);
+
+		for (auto& freeRect : freeRects)
+		{
+			bool intersects = usedRect.left < freeRect.right && usedRect.right > freeRect.left &&
+				usedRect.bottom < freeRect.top && usedRect.top > freeRect.bottom;
+
+			if (!intersects)
+			{
+				splittedFreeRects.Add(freeRect);
+				continue;
+			}
+
+			// Free rectangle is replaced by up to four maximal rectangles around used one
+			if (usedRect.left > freeRect.left)
+				splittedFreeRects.Add(RectF(freeRect.left, freeRect.top, usedRect.left, freeRect.bottom));
+
+			if (usedRect.right < freeRect.right)
+				splittedFreeRects.Add(RectF(usedRect.right, freeRect.top, freeRect.right, freeRect.bottom));
+
+			if (usedRect.bottom > freeRect.bottom)
+				splittedFreeRects.Add(RectF(freeRect.left, usedRect.bottom, freeRect.right, freeRect.bottom));
+
+			if (usedRect.top < freeRect.top)
+				splittedFreeRects.Add(RectF(freeRect.left, freeRect.top, freeRect.right, usedRect.top));
+		}
+
+		freeRects = splittedFreeRects;
 	}
 
-	bool RectsPacker::QuadNode::operator==(const QuadNode& other)
+	void RectsPacker::PruneFreeRects(int page)
 	{
-		return rect == other.rect && page == other.page && free == other.free;
+		Vector<RectF>& freeRects = mFreeRects[page];
+
+		auto isContained = [](const RectF& inner, const RectF& outer) {
+			return inner.left >= outer.left && inner.right <= outer.right &&
+				inner.bottom >= outer.bottom && inner.top <= outer.top;
+		};
+
+		for (int i = 0; i < freeRects.Count(); i++)
+		{
+			for (int j = i + 1; j < freeRects.Count(); )
+			{
+				if (isContained(freeRects[i], freeRects[j]))
+				{
+					freeRects.RemoveAt(i);
+					i--;
+					break;
+				}
+
+				if (isContained(freeRects[j], freeRects[i]))
+					freeRects.RemoveAt(j);
+				else
+					j++;
+			}
+		}
 	}
 
 	RectsPacker::Rect::Rect(const Vec2F& size /*= Vec2F()*/):
-		size(size), page(-1)
+		size(size), page(-1), rotated(false)
 	{}
 
 }
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "o2/Utils/Basic/ITree.h"
 #include "o2/Utils/Math/Rect.h"
 #include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Types/Containers/Pool.h"
@@ -8,20 +7,33 @@
 
 namespace o2
 {
-	// -----------------
-	// Rectangles packer
-	// -----------------
+	// ----------------------------------------------------------------------------------------------
+	// Rectangles packer. Uses MaxRects algorithm: keeps list of maximal free rectangles on each page
+	// and places each rectangle into free rectangle, selected by heuristic
+	// ----------------------------------------------------------------------------------------------
 	class RectsPacker
 	{
 	public:
+		// ----------------------------------
+		// Free rectangle selection heuristic
+		// ----------------------------------
+		enum class Heuristic
+		{
+			BestShortSideFit, // Minimizes shorter leftover side of free rectangle
+			BestLongSideFit,  // Minimizes longer leftover side of free rectangle
+			BestAreaFit,      // Minimizes leftover area of free rectangle
+			BottomLeft        // Places rectangle as low and left as possible
+		};
+
 		// -----------------
 		// Packing rectangle
 		// -----------------
 		struct Rect
 		{
-			int   page; // Page index
-			RectF rect; // Rectangle on page
-			Vec2F size; // Size of rectangle
+			int   page;    // Page index. Rectangles with page >= 0 keep their placement in incremental packing
+			RectF rect;    // Rectangle on page
+			Vec2F size;    // Size of rectangle
+			bool  rotated; // Is rectangle rotated by 90 degrees on page
 
 		public:
 			// Constructor
@@ -41,7 +53,7 @@ namespace o2
 		// Removes rectangle
 		void RemoveRect(Rect* remRect);
 
-		// Removes all rectangles and quads
+		// Removes all rectangles and pages
 		void Clear();
 
 		// Sets page maximum size
@@ -50,47 +62,60 @@ namespace o2
 		// Returns page maximum size
 		Vec2F GetMaxSize() const;
 
+		// Sets free rectangle selection heuristic
+		void SetHeuristic(Heuristic heuristic);
+
+		// Returns free rectangle selection heuristic
+		Heuristic GetHeuristic() const;
+
+		// Sets rectangles rotation enabled. Rotated rectangles have rotated flag
+		void SetRotationEnabled(bool enabled);
+
+		// Returns is rectangles rotation enabled
+		bool IsRotationEnabled() const;
+
 		// Returns pages count
 		int GetPagesCount() const;
 
+		// Returns used area of pages in range 0...1
+		float GetOccupancy() const;
+
 		// Tries to pack, returns true if packed successfully
 		bool Pack();
 
+		// Tries to pack keeping placements of rectangles with page >= 0. Other rectangles are placed in free space.
+		// Placed rectangles with wrong size or out of page are placed again. Returns true if packed successfully
+		bool PackIncremental();
+
 	protected:
-		// ---------
-		// Quad node
-		// ---------
-		struct QuadNode: public ITreeNode<QuadNode>
-		{
-			RectF rect; // Quad rectangle on page
-			int   page; // Page index
-			bool  free; // Is quad free
+		Pool<Rect>            mRectsPool;       // Rectangles pool
+		Vector<Rect*>         mRects;           // Rectangles
+		Vector<Vector<RectF>> mFreeRects;       // Maximal free rectangles of each page
+		Vec2F                 mMaxSize;         // Max page size
+		Heuristic             mHeuristic;       // Free rectangle selection heuristic
+		bool                  mRotationEnabled; // Is rectangles rotation enabled
 
-		public:
-			// Constructor
-			QuadNode(int page = 0, const RectF& rect = RectF());
+	protected:
+		// Sorts rectangles by decreasing longer side and packs not placed ones
+		bool PackNotPlacedRects();
 
-			//Calls when child quad was added
-			void OnChildAdded(QuadNode* child);
+		// Tries to insert rectangle
+		bool InsertRect(Rect& rt);
 
-			// Check equals operator
-			bool operator==(const QuadNode& other);
-		};
+		// Searches best free rectangle on page. Returns false when rectangle doesn't fit
+		bool FindPosition(int page, const Vec2F& size, RectF& position, float& bestScore, float& bestSecondScore) const;
 
-		Pool<Rect>        mRectsPool; // Rectangles pool
-		Vector<Rect*>     mRects;     // Rectangles
-		Vector<QuadNode*> mQuadNodes; // Quad nodes 
-		Vec2F             mMaxSize;   // Max page size
+		// Calculates free rectangle score for size by heuristic. Smaller scores are better
+		void CalculateScore(const RectF& freeRect, const Vec2F& size, float& score, float& secondScore) const;
 
-	protected:
-		// Tries to insert rectangle
-		bool InsertRect(Rect& rt);
+		// Places rectangle on page and splits free rectangles
+		void PlaceRect(Rect& rt, int page, const RectF& position, bool rotated);
 
-		// Tries to insert rectangle in specified node
-		bool TryInsertRect(Rect& rt, QuadNode* node);
+		// Splits free rectangles of page intersecting with used rectangle
+		void SplitFreeRects(int page, const RectF& usedRect);
 
-		// Tries to insert rectangle in specified node
-		bool TryInsertRectInChilds(Rect& rt, QuadNode* node);
+		// Removes free rectangles of page contained in other free rectangles
+		void PruneFreeRects(int page);
 
 		// Creates new page
 		void CreateNewPage();
@@ -107,6 +107,7 @@ END_ENUM_META;
 ENUM_META(o2::Platform)
 {
 	ENUM_ENTRY(Android);
+	ENUM_ENTRY(Linux);
 	ENUM_ENTRY(MacOSX);
 	ENUM_ENTRY(Windows);
 	ENUM_ENTRY(iOS);
@@ -130,6 +131,7 @@ END_ENUM_META;
 
 ENUM_META(o2::PixelFormat)
 {
+	ENUM_ENTRY(A8);
 	ENUM_ENTRY(R8G8B8);
 	ENUM_ENTRY(R8G8B8A8);
 }
@@ -42,13 +42,13 @@ namespace o2
 
 	enum class ProtectSection { Public, Private, Protected };
 
-	enum class Platform { Windows, MacOSX, iOS, Android };
+	enum class Platform { Windows, MacOSX, iOS, Android, Linux };
 
 	enum class LineType { Solid, Dash };
 
 	enum class PrimitiveType { Polygon, PolygonWire, Line };
 
-	enum class PixelFormat { R8G8B8A8, R8G8B8 };
+	enum class PixelFormat { R8G8B8A8, R8G8B8, A8 };
 
 	enum class Loop { None, Repeat, PingPong };
 
@@ -0,0 +1,590 @@
+#pragma once
+
+#include "o2/Utils/Debug/Assert.h"
+#include "o2/Utils/Function.h"
+#include "o2/Utils/Math/Math.h"
+#include "o2/Utils/Types/Containers/Pair.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+#include "o2/Utils/Types/UID.h"
+#include <functional>
+#include <type_traits>
+
+namespace o2
+{
+	// Mixes bits of value, so near values give far hashes
+	inline UInt64 MixHashBits(UInt64 value)
+	{
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdULL;
+		value ^= value >> 33;
+		return value;
+	}
+
+	// Returns FNV-1a hash of bytes
+	inline UInt64 GetBytesHash(const void* data, size_t size)
+	{
+		UInt64 res = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < size; i++)
+		{
+			res ^= ((const UInt8*)data)[i];
+			res *= 0x100000001b3ULL;
+		}
+
+		return res;
+	}
+
+	// -------------------------------------------------------------------------------------------------------
+	// Keys hash function. Integers, enums and pointers bits are mixed, because std::hash usually returns them
+	// as is and near keys fall into same buckets. Other types are hashed by std::hash
+	// -------------------------------------------------------------------------------------------------------
+	template<typename _type>
+	struct Hash
+	{
+		UInt64 operator()(const _type& value) const
+		{
+			if constexpr (std::is_integral<_type>::value || std::is_enum<_type>::value)
+				return MixHashBits((UInt64)value);
+			else if constexpr (std::is_pointer<_type>::value)
+				return MixHashBits((UInt64)(size_t)value);
+			else
+				return (UInt64)std::hash<_type>()(value);
+		}
+	};
+
+	// -----------------------------------------------------
+	// String hash function, hashes characters data in place
+	// -----------------------------------------------------
+	template<>
+	struct Hash<String>
+	{
+		UInt64 operator()(const String& value) const { return GetBytesHash(value.Data(), value.Length()); }
+	};
+
+	// ----------------------------------------------------------
+	// Wide string hash function, hashes characters data in place
+	// ----------------------------------------------------------
+	template<>
+	struct Hash<WString>
+	{
+		UInt64 operator()(const WString& value) const { return GetBytesHash(value.Data(), value.Length()*sizeof(wchar_t)); }
+	};
+
+	// -------------------------------------------------------------------------------
+	// UID hash function. UID is random already, so its halves are just mixed together
+	// -------------------------------------------------------------------------------
+	template<>
+	struct Hash<UID>
+	{
+		UInt64 operator()(const UID& value) const
+		{
+			UInt64 halves[2];
+			memcpy(halves, value.data, sizeof(halves));
+			return MixHashBits(halves[0] ^ halves[1]);
+		}
+	};
+
+	// -------------------------------------------------------------------------------------------------------
+	// Hash dictionary with open addressing. Has same API as Map, but keys are not sorted. Key-value pairs are
+	// stored densely in vector in adding order, so iteration is as fast as vector iteration. Buckets table
+	// with linear probing stores pairs indices and keys hashes. Removing moves last pair into removed pair
+	// place, so removing changes order and invalidates iterators. Keys must not be changed through iterators
+	// -------------------------------------------------------------------------------------------------------
+	template<typename _key_type, typename _value_type, typename _hash_type = Hash<_key_type>>
+	class UnorderedMap
+	{
+	public:
+		using KeyValuePair = Pair<_key_type, _value_type>;
+		using Iterator = typename Vector<KeyValuePair>::iterator;
+		using ConstIterator = typename Vector<KeyValuePair>::const_iterator;
+
+	public:
+		// Default constructor
+		UnorderedMap();
+
+		// Copy-constructor
+		UnorderedMap(const UnorderedMap& other);
+
+		// Move-constructor
+		UnorderedMap(UnorderedMap&& other);
+
+		// Constructor from initializer list
+		UnorderedMap(std::initializer_list<KeyValuePair> init);
+
+		// Destructor
+		~UnorderedMap();
+
+		// Check equals operator
+		bool operator==(const UnorderedMap& other) const;
+
+		// Check not equals operator
+		bool operator!=(const UnorderedMap& other) const;
+
+		// Copy-operator
+		UnorderedMap& operator=(const UnorderedMap& other);
+
+		// Move-operator
+		UnorderedMap& operator=(UnorderedMap&& other);
+
+		// Returns value reference by key. Adds default value when key isn't contained
+		_value_type& operator[](const _key_type& key);
+
+		// Adds element. Does nothing when key is already contained
+		void Add(const _key_type& key, const _value_type& value);
+
+		// Adds element. Does nothing when key is already contained
+		void Add(const KeyValuePair& keyValue);
+
+		// Adds elements from other dictionary
+		void Add(const UnorderedMap& other);
+
+		// Removes element by key
+		void Remove(const _key_type& key);
+
+		// Removes all which pass function
+		void RemoveAll(const Function<bool(const _key_type&, const _value_type&)>& match);
+
+		// Removes all elements. Buckets table memory isn't released
+		void Clear();
+
+		// Reserves memory for elements count
+		void Reserve(int count);
+
+		// Returns true if contains element with specified key
+		bool ContainsKey(const _key_type& key) const;
+
+		// Returns true if contains element with specified value
+		bool ContainsValue(const _value_type& value) const;
+
+		// Returns element by key
+		KeyValuePair FindKey(const _key_type& key) const;
+
+		// Returns element by value
+		KeyValuePair FindValue(const _value_type& value) const;
+
+		// Sets value by key
+		void Set(const _key_type& key, const _value_type& value);
+
+		// Returns value reference by key
+		_value_type& Get(const _key_type& key);
+
+		// Returns constant value reference by key
+		const _value_type& Get(const _key_type& key) const;
+
+		// Tries to get value by key, returns true if found
+		bool TryGetValue(const _key_type& key, _value_type& output) const;
+
+		// Returns count of elements
+		int Count() const;
+
+		// Returns true when no elements
+		bool IsEmpty() const;
+
+		// Invokes function for all elements
+		void ForEach(const Function<void(const _key_type&, _value_type&)>& func);
+
+		// Returns begin iterator
+		Iterator Begin() { return mPairs.begin(); }
+
+		// Returns end iterator
+		Iterator End() { return mPairs.end(); }
+
+		// Returns constant begin iterator
+		ConstIterator Begin() const { return mPairs.cbegin(); }
+
+		// Returns constant end iterator
+		ConstIterator End() const { return mPairs.cend(); }
+
+		// Returns begin iterator, used in range-based for
+		Iterator begin() { return mPairs.begin(); }
+
+		// Returns end iterator, used in range-based for
+		Iterator end() { return mPairs.end(); }
+
+		// Returns constant begin iterator, used in range-based for
+		ConstIterator begin() const { return mPairs.cbegin(); }
+
+		// Returns constant end iterator, used in range-based for
+		ConstIterator end() const { return mPairs.cend(); }
+
+	protected:
+		// --------------------------------------------------------
+		// Buckets table cell. Empty bucket has negative pair index
+		// --------------------------------------------------------
+		struct Bucket
+		{
+			UInt64 hash = 0;   // Key hash
+			int    index = -1; // Pair index in pairs vector
+		};
+
+	protected:
+		static constexpr int mMinBucketsCount = 16; // Minimal count of buckets in not empty table
+
+		Vector<KeyValuePair> mPairs;   // Key-value pairs in adding order
+		Vector<Bucket>       mBuckets; // Buckets table, count is power of two
+		_hash_type           mHasher;  // Keys hash function
+
+	protected:
+		// Returns bucket index of key, or -1 when key isn't contained
+		int FindBucket(const _key_type& key, UInt64 hash) const;
+
+		// Adds pair and its bucket. Key must not be contained
+		_value_type& Insert(const _key_type& key, const _value_type& value, UInt64 hash);
+
+		// Places pair index into first empty bucket from key hash
+		void PlaceBucket(UInt64 hash, int index);
+
+		// Empties bucket and shifts next buckets of same probe sequence back
+		void RemoveBucket(int bucketIdx);
+
+		// Rebuilds buckets table with new buckets count, keys aren't hashed again
+		void Rehash(int bucketsCount);
+	};
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	UnorderedMap<_key_type, _value_type, _hash_type>::UnorderedMap()
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	UnorderedMap<_key_type, _value_type, _hash_type>::UnorderedMap(const UnorderedMap& other):
+		mPairs(other.mPairs), mBuckets(other.mBuckets)
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	UnorderedMap<_key_type, _value_type, _hash_type>::UnorderedMap(UnorderedMap&& other):
+		mPairs(std::move(other.mPairs)), mBuckets(std::move(other.mBuckets))
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	UnorderedMap<_key_type, _value_type, _hash_type>::UnorderedMap(std::initializer_list<KeyValuePair> init)
+	{
+		Reserve((int)init.size());
+
+		for (auto& kv : init)
+			Add(kv);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	UnorderedMap<_key_type, _value_type, _hash_type>::~UnorderedMap()
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	bool UnorderedMap<_key_type, _value_type, _hash_type>::operator==(const UnorderedMap& other) const
+	{
+		if (Count() != other.Count())
+			return false;
+
+		for (auto& kv : mPairs)
+		{
+			int bucketIdx = other.FindBucket(kv.first, mHasher(kv.first));
+			if (bucketIdx < 0 || !(other.mPairs[other.mBuckets[bucketIdx].index].second == kv.second))
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	bool UnorderedMap<_key_type, _value_type, _hash_type>::operator!=(const UnorderedMap& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	UnorderedMap<_key_type, _value_type, _hash_type>& UnorderedMap<_key_type, _value_type, _hash_type>::operator=(const UnorderedMap& other)
+	{
+		mPairs = other.mPairs;
+		mBuckets = other.mBuckets;
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	UnorderedMap<_key_type, _value_type, _hash_type>& UnorderedMap<_key_type, _value_type, _hash_type>::operator=(UnorderedMap&& other)
+	{
+		mPairs = std::move(other.mPairs);
+		mBuckets = std::move(other.mBuckets);
+		return *this;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	_value_type& UnorderedMap<_key_type, _value_type, _hash_type>::operator[](const _key_type& key)
+	{
+		UInt64 hash = mHasher(key);
+		int bucketIdx = FindBucket(key, hash);
+		if (bucketIdx >= 0)
+			return mPairs[mBuckets[bucketIdx].index].second;
+
+		return Insert(key, _value_type(), hash);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Add(const _key_type& key, const _value_type& value)
+	{
+		UInt64 hash = mHasher(key);
+		if (FindBucket(key, hash) < 0)
+			Insert(key, value, hash);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Add(const KeyValuePair& keyValue)
+	{
+		Add(keyValue.first, keyValue.second);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Add(const UnorderedMap& other)
+	{
+		Reserve(Count() + other.Count());
+
+		for (auto& kv : other.mPairs)
+			Add(kv.first, kv.second);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Remove(const _key_type& key)
+	{
+		int bucketIdx = FindBucket(key, mHasher(key));
+		if (bucketIdx < 0)
+			return;
+
+		int index = mBuckets[bucketIdx].index;
+		RemoveBucket(bucketIdx);
+
+		int lastIndex = mPairs.Count() - 1;
+		if (index != lastIndex)
+		{
+			int mask = mBuckets.Count() - 1;
+			for (int i = (int)(mHasher(mPairs[lastIndex].first) & mask); ; i = (i + 1) & mask)
+			{
+				if (mBuckets[i].index == lastIndex)
+				{
+					mBuckets[i].index = index;
+					break;
+				}
+			}
+
+			mPairs[index] = std::move(mPairs[lastIndex]);
+		}
+
+		mPairs.PopBack();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::RemoveAll(const Function<bool(const _key_type&, const _value_type&)>& match)
+	{
+		for (int i = mPairs.Count() - 1; i >= 0; i--)
+		{
+			if (match(mPairs[i].first, mPairs[i].second))
+			{
+				_key_type key = mPairs[i].first;
+				Remove(key);
+			}
+		}
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Clear()
+	{
+		if (mPairs.IsEmpty())
+			return;
+
+		mPairs.Clear();
+
+		for (auto& bucket : mBuckets)
+			bucket.index = -1;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Reserve(int count)
+	{
+		mPairs.Reserve(count);
+
+		int bucketsCount = Math::Max(mMinBucketsCount, mBuckets.Count());
+		while (count*4 > bucketsCount*3)
+			bucketsCount *= 2;
+
+		if (bucketsCount != mBuckets.Count())
+			Rehash(bucketsCount);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	bool UnorderedMap<_key_type, _value_type, _hash_type>::ContainsKey(const _key_type& key) const
+	{
+		return FindBucket(key, mHasher(key)) >= 0;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	bool UnorderedMap<_key_type, _value_type, _hash_type>::ContainsValue(const _value_type& value) const
+	{
+		for (auto& kv : mPairs)
+		{
+			if (kv.second == value)
+				return true;
+		}
+
+		return false;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	typename UnorderedMap<_key_type, _value_type, _hash_type>::KeyValuePair UnorderedMap<_key_type, _value_type, _hash_type>::FindKey(const _key_type& key) const
+	{
+		int bucketIdx = FindBucket(key, mHasher(key));
+		if (bucketIdx >= 0)
+			return mPairs[mBuckets[bucketIdx].index];
+
+		return KeyValuePair();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	typename UnorderedMap<_key_type, _value_type, _hash_type>::KeyValuePair UnorderedMap<_key_type, _value_type, _hash_type>::FindValue(const _value_type& value) const
+	{
+		for (auto& kv : mPairs)
+		{
+			if (kv.second == value)
+				return kv;
+		}
+
+		return KeyValuePair();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Set(const _key_type& key, const _value_type& value)
+	{
+		(*this)[key] = value;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	_value_type& UnorderedMap<_key_type, _value_type, _hash_type>::Get(const _key_type& key)
+	{
+		int bucketIdx = FindBucket(key, mHasher(key));
+		if (bucketIdx >= 0)
+			return mPairs[mBuckets[bucketIdx].index].second;
+
+		Assert(false, "Failed to get value from dictionary: not found key");
+
+		static _value_type fake;
+		return fake;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	const _value_type& UnorderedMap<_key_type, _value_type, _hash_type>::Get(const _key_type& key) const
+	{
+		int bucketIdx = FindBucket(key, mHasher(key));
+		if (bucketIdx >= 0)
+			return mPairs[mBuckets[bucketIdx].index].second;
+
+		Assert(false, "Failed to get value from dictionary: not found key");
+
+		static _value_type fake;
+		return fake;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	bool UnorderedMap<_key_type, _value_type, _hash_type>::TryGetValue(const _key_type& key, _value_type& output) const
+	{
+		int bucketIdx = FindBucket(key, mHasher(key));
+		if (bucketIdx >= 0)
+		{
+			output = mPairs[mBuckets[bucketIdx].index].second;
+			return true;
+		}
+
+		return false;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	int UnorderedMap<_key_type, _value_type, _hash_type>::Count() const
+	{
+		return mPairs.Count();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	bool UnorderedMap<_key_type, _value_type, _hash_type>::IsEmpty() const
+	{
+		return mPairs.IsEmpty();
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::ForEach(const Function<void(const _key_type&, _value_type&)>& func)
+	{
+		for (auto& kv : mPairs)
+			func(kv.first, kv.second);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	int UnorderedMap<_key_type, _value_type, _hash_type>::FindBucket(const _key_type& key, UInt64 hash) const
+	{
+		if (mBuckets.IsEmpty())
+			return -1;
+
+		int mask = mBuckets.Count() - 1;
+		for (int i = (int)(hash & mask); ; i = (i + 1) & mask)
+		{
+			const Bucket& bucket = mBuckets[i];
+			if (bucket.index < 0)
+				return -1;
+
+			if (bucket.hash == hash && mPairs[bucket.index].first == key)
+				return i;
+		}
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	_value_type& UnorderedMap<_key_type, _value_type, _hash_type>::Insert(const _key_type& key, const _value_type& value, UInt64 hash)
+	{
+		if ((mPairs.Count() + 1)*4 > mBuckets.Count()*3)
+			Rehash(Math::Max(mMinBucketsCount, mBuckets.Count()*2));
+
+		mPairs.Add(KeyValuePair(key, value));
+		PlaceBucket(hash, mPairs.Count() - 1);
+
+		return mPairs.Last().second;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::PlaceBucket(UInt64 hash, int index)
+	{
+		int mask = mBuckets.Count() - 1;
+		int i = (int)(hash & mask);
+		while (mBuckets[i].index >= 0)
+			i = (i + 1) & mask;
+
+		mBuckets[i].hash = hash;
+		mBuckets[i].index = index;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::RemoveBucket(int bucketIdx)
+	{
+		int mask = mBuckets.Count() - 1;
+		int hole = bucketIdx;
+
+		// Bucket can be moved back into hole when hole is not before its ideal position in probe sequence
+		for (int i = (hole + 1) & mask; mBuckets[i].index >= 0; i = (i + 1) & mask)
+		{
+			int ideal = (int)(mBuckets[i].hash & mask);
+			if (((i - ideal) & mask) >= ((i - hole) & mask))
+			{
+				mBuckets[hole] = mBuckets[i];
+				hole = i;
+			}
+		}
+
+		mBuckets[hole].index = -1;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hash_type>
+	void UnorderedMap<_key_type, _value_type, _hash_type>::Rehash(int bucketsCount)
+	{
+		Vector<Bucket> oldBuckets = std::move(mBuckets);
+
+		mBuckets = Vector<Bucket>();
+		mBuckets.Resize(bucketsCount);
+
+		for (auto& bucket : oldBuckets)
+		{
+			if (bucket.index >= 0)
+				PlaceBucket(bucket.hash, bucket.index);
+		}
+	}
+}
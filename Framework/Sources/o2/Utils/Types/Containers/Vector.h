@@ -1,6 +1,8 @@
 #pragma once
 
 #include "o2/Utils/Debug/Assert.h"
+#include "o2/Utils/Function.h"
+#include "o2/Utils/Math/Math.h"
 #include "o2/Utils/Memory/MemoryManager.h"
 #include <vector>
 #include <algorithm>
@@ -297,9 +299,7 @@ namespace o2
 
 	template<typename _type>
 	Vector<_type>::~Vector()
-	{
-		std::vector<_type>::~vector<_type>();
-	}
+	{}
 
 	template<typename _type>
 	_type* Vector<_type>::Data()
@@ -467,7 +467,7 @@ namespace o2
 	template<typename _type>
 	void Vector<_type>::Add(const Vector<_type>& arr)
 	{
-		insert(end(), arr.begin(), arr.end());
+		this->insert(this->end(), arr.begin(), arr.end());
 	}
 
 	template<typename _type>
@@ -481,72 +481,72 @@ namespace o2
 	template<typename _type>
 	_type& Vector<_type>::Insert(const _type& value, int position)
 	{
-		insert(begin() + position, value);
-		return at(position);
+		this->insert(this->begin() + position, value);
+		return this->at(position);
 	}
 
 	template<typename _type>
 	void Vector<_type>::Insert(const Vector<_type>& arr, int position)
 	{
-		insert(begin() + position, arr.begin(), arr.end());
+		this->insert(this->begin() + position, arr.begin(), arr.end());
 	}
 
 	template<typename _type>
 	int Vector<_type>::IndexOf(const _type& value) const
 	{
-		auto fnd = std::find(begin(), end(), value);
-		if (fnd == end())
+		auto fnd = std::find(this->begin(), this->end(), value);
+		if (fnd == this->end())
 			return -1;
 
-		return fnd - begin();
+		return fnd - this->begin();
 	}
 
 	template<typename _type>
 	bool Vector<_type>::Contains(const _type& value) const
 	{
-		return std::find(begin(), end(), value) != end();
+		return std::find(this->begin(), this->end(), value) != this->end();
 	}
 
 	template<typename _type>
 	void Vector<_type>::RemoveAt(int idx)
 	{
-		erase(begin() + idx);
+		this->erase(this->begin() + idx);
 	}
 
 	template<typename _type>
 	void Vector<_type>::RemoveRange(int first, int last)
 	{
-		erase(begin() + first, begin() + last);
+		this->erase(this->begin() + first, this->begin() + last);
 	}
 
 	template<typename _type>
 	void Vector<_type>::Remove(const _type& value)
 	{
-		auto fnd = std::find(begin(), end(), value);
-		if (fnd != end())
-			erase(fnd);
+		auto fnd = std::find(this->begin(), this->end(), value);
+		if (fnd != this->end())
+			this->erase(fnd);
 	}
 
 	template<typename _type>
 	typename Vector<_type>::Iterator Vector<_type>::Remove(const Iterator& first, const Iterator& last)
 	{
-		return erase(first, last);
+		return this->erase(first, last);
 	}
 
 	template<typename _type>
 	typename Vector<_type>::Iterator Vector<_type>::Remove(const Iterator& it)
 	{
-		return erase(it);
+		return this->erase(it);
 	}
 
 	template<typename _type>
 	void Vector<_type>::RemoveFirst(const Function<bool(const _type&)>& match)
 	{
-		for (auto it = begin(); it != end(); ++it)
+		for (auto it = this->begin(); it != this->end(); ++it)
 		{
 			if (match(*it))
 			{
-				erase(it);
+				this->erase(it);
 				return;
 			}
 		}
@@ -555,43 +555,43 @@ namespace o2
 	template<typename _type>
 	void Vector<_type>::Clear()
 	{
-		clear();
+		this->clear();
 	}
 
 	template<typename _type>
 	bool Vector<_type>::IsEmpty() const
 	{
-		return empty();
+		return this->empty();
 	}
 
 	template<typename _type>
 	_type& Vector<_type>::First()
 	{
-		return front();
+		return this->front();
 	}
 
 	template<typename _type>
 	const _type& Vector<_type>::First() const
 	{
-		return front();
+		return this->front();
 	}
 
 	template<typename _type>
 	const _type& Vector<_type>::Last() const
 	{
-		return back();
+		return this->back();
 	}
 
 	template<typename _type>
 	_type& Vector<_type>::Last()
 	{
-		return back();
+		return this->back();
 	}
 
 	template<typename _type>
 	void Vector<_type>::Sort(const Function<bool(const _type&, const _type&)>& pred /*= Math::Fewer*/)
 	{
-		std::sort(begin(), end(), pred);
+		std::sort(this->begin(), this->end(), pred);
 	}
 
 	template<typename _type>
@@ -605,25 +605,25 @@ namespace o2
 	template<typename _type>
 	typename Vector<_type>::Iterator Vector<_type>::Begin()
 	{
-		return begin();
+		return this->begin();
 	}
 
 	template<typename _type>
 	typename Vector<_type>::Iterator Vector<_type>::End()
 	{
-		return end();
+		return this->end();
 	}
 
 	template<typename _type>
 	typename Vector<_type>::ConstIterator Vector<_type>::Begin() const
 	{
-		return cbegin();
+		return this->cbegin();
 	}
 
 	template<typename _type>
 	typename Vector<_type>::ConstIterator Vector<_type>::End() const
 	{
-		return cend();
+		return this->cend();
 	}
 
 	template<typename _type>
@@ -728,10 +728,10 @@ namespace o2
 	template<typename _type>
 	void Vector<_type>::RemoveAll(const Function<bool(const _type&)>& match)
 	{
-		for (auto it = begin(); it != end();)
+		for (auto it = this->begin(); it != this->end();)
 		{
 			if (match(*it))
-				it = erase(it);
+				it = this->erase(it);
 			else
 				++it;
 		}
@@ -842,10 +842,10 @@ namespace o2
 	template<typename _type>
 	int Vector<_type>::LastIndexOf(const Function<bool(const _type&)>& match) const
 	{
-		for (auto it = rbegin(); it != rend(); it--)
+		for (auto it = this->rbegin(); it != this->rend(); it--)
 		{
 			if (match(*it))
-				return it - begin();
+				return it - this->begin();
 		}
 
 		return -1;
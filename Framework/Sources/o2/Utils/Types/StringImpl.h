@@ -267,109 +267,99 @@ namespace o2
 		return std::stoull(*this);
 	}
 
-	template<typename T>
-	TString<T>::operator Vec2F() const
+	namespace StringParsing
 	{
-		if constexpr (std::is_same<T, char>)
+		// Parses number from str, moves str after it and after values separator
+		template<typename T, typename _number_type>
+		_number_type ParseNumber(const T*& str)
 		{
-			wchar_t *px = c_str(), *py;
-			return Vec2F(wcstof(px, &py), wcstof(py, nullptr));
-		}
-		else
-		{
-			char *px = c_str(), *py;
-			return Vec2F(strtof(px, &py), strtof(py, nullptr));
+			T* end;
+			_number_type res;
+
+			if constexpr (std::is_same<T, wchar_t>::value)
+				res = std::is_floating_point<_number_type>::value ? (_number_type)wcstof(str, &end) : (_number_type)wcstol(str, &end, 10);
+			else
+				res = std::is_floating_point<_number_type>::value ? (_number_type)strtof(str, &end) : (_number_type)strtol(str, &end, 10);
+
+			str = end;
+			if (*str == ';')
+				str++;
+
+			return res;
 		}
 	}
 
+	template<typename T>
+	TString<T>::operator Vec2F() const
+	{
+		const T* str = std::basic_string<T>::c_str();
+		float x = StringParsing::ParseNumber<T, float>(str);
+		float y = StringParsing::ParseNumber<T, float>(str);
+		return Vec2F(x, y);
+	}
+
 	template<typename T>
 	TString<T>::operator Vec2I() const
 	{
-		if constexpr (std::is_same<T, wchar_t>)
-		{
-			wchar_t *px = c_str(), *py;
-			return Vec2F((int)wcstol(px, &py), (int)wcstol(py, nullptr));
-		}
-		else
-		{
-			char *px = c_str(), *py;
-			return Vec2F((int)strtol(px, &py), (int)strtol(py, nullptr));
-		}
+		const T* str = std::basic_string<T>::c_str();
+		int x = StringParsing::ParseNumber<T, int>(str);
+		int y = StringParsing::ParseNumber<T, int>(str);
+		return Vec2I(x, y);
 	}
 
 	template<typename T>
 	TString<T>::operator RectF() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF(wcstof(pl, &pb), wcstof(pb, &pr), wcstof(pr, &pt), wcstof(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF(strtof(pl, &pb), strtof(pb, &pr), strtof(pr, &pt), strtof(pt, nullptr));
-		}
+		const T* str = std::basic_string<T>::c_str();
+		float left = StringParsing::ParseNumber<T, float>(str);
+		float top = StringParsing::ParseNumber<T, float>(str);
+		float right = StringParsing::ParseNumber<T, float>(str);
+		float bottom = StringParsing::ParseNumber<T, float>(str);
+		return RectF(left, top, right, bottom);
 	}
 
 	template<typename T>
 	TString<T>::operator RectI() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)wcstol(pl, &pb), (int)wcstol(pb, &pr), (int)wcstol(pr, &pt), (int)wcstol(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)strtol(pl, &pb), (int)strtol(pb, &pr), (int)strtol(pr, &pt), (int)strtol(pt, nullptr));
-		}
+		const T* str = std::basic_string<T>::c_str();
+		int left = StringParsing::ParseNumber<T, int>(str);
+		int top = StringParsing::ParseNumber<T, int>(str);
+		int right = StringParsing::ParseNumber<T, int>(str);
+		int bottom = StringParsing::ParseNumber<T, int>(str);
+		return RectI(left, top, right, bottom);
 	}
 
 	template<typename T>
 	TString<T>::operator BorderF() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF(wcstof(pl, &pb), wcstof(pb, &pr), wcstof(pr, &pt), wcstof(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF(strtof(pl, &pb), strtof(pb, &pr), strtof(pr, &pt), strtof(pt, nullptr));
-		}
+		const T* str = std::basic_string<T>::c_str();
+		float left = StringParsing::ParseNumber<T, float>(str);
+		float top = StringParsing::ParseNumber<T, float>(str);
+		float right = StringParsing::ParseNumber<T, float>(str);
+		float bottom = StringParsing::ParseNumber<T, float>(str);
+		return BorderF(left, bottom, right, top);
 	}
 
 	template<typename T>
 	TString<T>::operator BorderI() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)wcstol(pl, &pb), (int)wcstol(pb, &pr), (int)wcstol(pr, &pt), (int)wcstol(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)strtol(pl, &pb), (int)strtol(pb, &pr), (int)strtol(pr, &pt), (int)strtol(pt, nullptr));
-		}
+		const T* str = std::basic_string<T>::c_str();
+		int left = StringParsing::ParseNumber<T, int>(str);
+		int top = StringParsing::ParseNumber<T, int>(str);
+		int right = StringParsing::ParseNumber<T, int>(str);
+		int bottom = StringParsing::ParseNumber<T, int>(str);
+		return BorderI(left, bottom, right, top);
 	}
 
 	template<typename T>
 	TString<T>::operator Color4() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pr = c_str(), *pg, *pb, *pa;
-			return RectF((int)wcstol(pr, &pg), (int)wcstol(pg, &pb), (int)wcstol(pb, &pa), (int)wcstol(pa, nullptr));
-		}
-		else
-		{
-			char *pr = c_str(), *pg, *pb, *pa;
-			return RectF((int)strtol(pr, &pg), (int)strtol(pg, &pb), (int)strtol(pb, &pa), (int)strtol(pa, nullptr));
-		}
+		const T* str = std::basic_string<T>::c_str();
+		int r = StringParsing::ParseNumber<T, int>(str);
+		int g = StringParsing::ParseNumber<T, int>(str);
+		int b = StringParsing::ParseNumber<T, int>(str);
+		int a = StringParsing::ParseNumber<T, int>(str);
+		return Color4(r, g, b, a);
 	}
 
 	template<typename T>
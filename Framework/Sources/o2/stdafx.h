@@ -1,5 +1,8 @@
 #pragma once
 
+// Reflection headers include each other, they must be included before headers using them
+#include "o2/Utils/Reflection/Reflection.h"
+
 #include "o2/Utils/Types/CommonTypes.h"
 #include "o2/Animation/Tracks/AnimationFloatTrack.h"
 #include "o2/Animation/Tracks/AnimationVec2FTrack.h"